@@ -211,6 +211,14 @@ class stats( Gaffer.Application ) :
 					defaultValue = False,
 				),
 
+				IECore.BoolParameter(
+					name = "cacheMonitor",
+					description = "Turns on a cache monitor to provide statistics about "
+						"the hit rates of the hash and compute caches for each type "
+						"of node, and the number of values evicted from the caches.",
+					defaultValue = False,
+				),
+
 				IECore.StringParameter(
 					name = "contextMonitorRoot",
 					description = "The name of a node or plug to provide a root for the "
@@ -324,6 +332,11 @@ class stats( Gaffer.Application ) :
 		else :
 			self.__contextMonitor = None
 
+		if args["cacheMonitor"].value :
+			self.__cacheMonitor = Gaffer.CacheMonitor()
+		else :
+			self.__cacheMonitor = None
+
 		if args["vtune"].value :
 			try:
 				self.__vtuneMonitor = Gaffer.VTuneMonitor()
@@ -384,6 +397,10 @@ class stats( Gaffer.Application ) :
 
 		self.__output.write( "\n" )
 
+		self.__writeCache( args )
+
+		self.__output.write( "\n" )
+
 		self.__output.close()
 
 		if args["annotatedScript"].value :
@@ -507,7 +524,7 @@ class stats( Gaffer.Application ) :
 		memory = _Memory.maxRSS()
 		# We don't expect serialisation to trigger any processes that the monitors would see,
 		# but we definitely want to know if they do.
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext(), self.__cacheMonitor or contextlib.nullcontext() :
 			with _Timer() as timer :
 				script.serialise()
 
@@ -563,7 +580,7 @@ class stats( Gaffer.Application ) :
 			computeScene()
 
 		memory = _Memory.maxRSS()
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext(), self.__cacheMonitor or contextlib.nullcontext() :
 			with contextSanitiser :
 				with _Timer() as sceneTimer :
 					computeScene()
@@ -605,7 +622,7 @@ class stats( Gaffer.Application ) :
 			computeImage()
 
 		memory = _Memory.maxRSS()
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext(), self.__cacheMonitor or contextlib.nullcontext() :
 			with contextSanitiser :
 				with _Timer() as imageTimer :
 					computeImage()
@@ -641,7 +658,7 @@ class stats( Gaffer.Application ) :
 
 		memory = _Memory.maxRSS()
 		with _Timer() as taskTimer :
-			with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+			with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext(), self.__cacheMonitor or contextlib.nullcontext() :
 				with self.__context( script, args ) as context :
 					for frame in self.__frames( script, args ) :
 						context.setFrame( frame )
@@ -717,6 +734,44 @@ class stats( Gaffer.Application ) :
 
 			self.__writeItems( items )
 
+	def __writeCache( self, args ) :
+
+		if self.__cacheMonitor is None :
+			return
+
+		self.__output.write( "Cache :\n\n" )
+
+		def hitRate( hits, misses, waits ) :
+			total = hits + misses + waits
+			return "{:.1f}% ({} hits, {} misses, {} waits)".format(
+				100.0 * hits / total if total else 0.0, hits, misses, waits
+			)
+
+		combined = self.__cacheMonitor.combinedStatistics()
+		self.__writeItems( [
+			( "Hash hit rate", hitRate( combined.hashHits, combined.hashMisses, combined.hashWaits ) ),
+			( "Compute hit rate", hitRate( combined.computeHits, combined.computeMisses, combined.computeWaits ) ),
+			( "", "" ),
+			( "Hash evictions", self.__cacheMonitor.hashCacheEvictions() ),
+			( "Compute evictions", self.__cacheMonitor.computeCacheEvictions() ),
+			( "Compute evicted memory", _Memory( self.__cacheMonitor.computeCacheEvictedMemory() ) ),
+		] )
+
+		stats = list( self.__cacheMonitor.allStatistics().items() )
+		n = args["maxLinesPerMetric"].value
+
+		self.__output.write( "\nHash misses by node type :\n\n" )
+		stats.sort( key = lambda x : x[1].hashMisses + x[1].hashWaits, reverse = True )
+		self.__writeItems( [
+			( name, hitRate( s.hashHits, s.hashMisses, s.hashWaits ) ) for name, s in stats[:n]
+		] )
+
+		self.__output.write( "\nCompute misses by node type :\n\n" )
+		stats.sort( key = lambda x : x[1].computeMisses + x[1].computeWaits, reverse = True )
+		self.__writeItems( [
+			( name, hitRate( s.computeHits, s.computeMisses, s.computeWaits ) ) for name, s in stats[:n]
+		] )
+
 class _Timer( object ) :
 
 	def __enter__( self ) :
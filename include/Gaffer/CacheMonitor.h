@@ -0,0 +1,134 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Monitor.h"
+
+#include "tbb/enumerable_thread_specific.h"
+
+#include <map>
+#include <unordered_map>
+
+namespace Gaffer
+{
+
+/// A monitor which collects statistics about the effectiveness of the
+/// hash and compute caches, counting the cache hits, misses and waits
+/// for each type of node.
+class GAFFER_API CacheMonitor : public Monitor
+{
+
+	public :
+
+		CacheMonitor();
+		~CacheMonitor() override;
+
+		IE_CORE_DECLAREMEMBERPTR( CacheMonitor )
+
+		struct GAFFER_API Statistics
+		{
+
+			Statistics(
+				size_t hashHits = 0, size_t hashMisses = 0, size_t hashWaits = 0,
+				size_t computeHits = 0, size_t computeMisses = 0, size_t computeWaits = 0
+			);
+
+			size_t hashHits;
+			size_t hashMisses;
+			size_t hashWaits;
+			size_t computeHits;
+			size_t computeMisses;
+			size_t computeWaits;
+
+			Statistics & operator += ( const Statistics &rhs );
+
+			bool operator == ( const Statistics &rhs ) const;
+			bool operator != ( const Statistics &rhs ) const;
+
+		};
+
+		/// Maps from node type name to statistics.
+		using StatisticsMap = std::map<std::string, Statistics>;
+
+		/// Query functions. These are not thread-safe, and must be called
+		/// only when the Monitor is not active (as defined by `Monitor::Scope`).
+		const StatisticsMap &allStatistics() const;
+		const Statistics &nodeTypeStatistics( const std::string &nodeTypeName ) const;
+		const Statistics &combinedStatistics() const;
+
+		/// Returns the number of values discarded from the compute cache since
+		/// the monitor was constructed. Evictions are a global property of the
+		/// cache, so this includes evictions caused by computations performed
+		/// while the monitor was not active.
+		size_t computeCacheEvictions() const;
+		/// As above, but returning the total memory usage of the discarded values.
+		size_t computeCacheEvictedMemory() const;
+		/// Returns the number of entries discarded from the hash caches since
+		/// the monitor was constructed.
+		size_t hashCacheEvictions() const;
+
+	protected :
+
+		void processStarted( const Process *process ) override;
+		void processFinished( const Process *process ) override;
+		void cacheLookup( const Plug *plug, const IECore::InternedString &processType, CacheLookup lookup ) override;
+
+	private :
+
+		// We collect statistics into a per-thread data structure to avoid contention,
+		// keyed by TypeId because it is cheaper to obtain than the type name.
+		struct ThreadData
+		{
+			using StatisticsPerType = std::unordered_map<IECore::TypeId, Statistics>;
+			StatisticsPerType statistics;
+		};
+		mutable tbb::enumerable_thread_specific<ThreadData> m_threadData;
+
+		// Then when we want to query it, we collate it into `m_statistics`.
+		void collate() const;
+		mutable StatisticsMap m_statistics;
+		mutable Statistics m_combinedStatistics;
+
+		const size_t m_initialComputeCacheEvictions;
+		const size_t m_initialComputeCacheEvictedMemory;
+		const size_t m_initialHashCacheEvictions;
+
+};
+
+IE_CORE_DECLAREPTR( CacheMonitor )
+
+} // namespace Gaffer
@@ -83,6 +83,17 @@ class GAFFER_API ComputeNode : public DependencyNode
 		/// Called to determine how calls to `compute()` should be cached. If `compute( output )`
 		/// will spawn TBB tasks then one of the task-based policies _must_ be used.
 		virtual ValuePlug::CachePolicy computeCachePolicy( const ValuePlug *output ) const;
+		/// Called to determine how values of `output` should be encoded when they are
+		/// stored in the compute cache. This is called in the context of the compute, and
+		/// may return `nullptr` to store values unencoded, which is the default behaviour.
+		virtual const ValuePlug::CacheCodec *computeCacheCodec( const ValuePlug *output ) const;
+		/// Called to determine whether values of `output` may be stored in the disk
+		/// and shared memory caches, for reuse by other processes. This is only
+		/// considered for `CachePolicy::TaskCollaboration`. Implementations should only
+		/// return true if values round-trip exactly via `IECore::Object::save()`, and
+		/// if `hash( output )` doesn't depend on process-specific state such as
+		/// pointers. The default implementation returns false.
+		virtual bool computeCacheShareable( const ValuePlug *output ) const;
 
 	private :
 
@@ -47,6 +47,7 @@
 #include "IECore/StringAlgo.h"
 
 #include "boost/container/flat_map.hpp"
+#include "boost/container/small_vector.hpp"
 
 namespace Gaffer
 {
@@ -82,6 +83,12 @@ class GAFFER_API Context : public IECore::RefCounted
 
 		IE_CORE_DECLAREMEMBERPTR( Context )
 
+		/// Contexts are allocated from a small per-thread pool, because huge
+		/// numbers of short-lived contexts are created by EditableScopes during
+		/// computation.
+		static void *operator new( size_t size );
+		static void operator delete( void *p, size_t size );
+
 		using ChangedSignal = Signals::Signal<void ( const Context *context, const IECore::InternedString & ), Signals::CatchingCombiner<void>>;
 
 		/// Sets a variable to the specified value. A copy is taken so that
@@ -160,6 +167,10 @@ class GAFFER_API Context : public IECore::RefCounted
 		/// Return the hash of a particular variable ( or a default MurmurHash() if not present )
 		/// Note that this hash includes the name of the variable
 		IECore::MurmurHash variableHash( const IECore::InternedString &name ) const;
+		/// Returns the type of the data held by a variable, or `IECore::InvalidTypeId`
+		/// if it doesn't exist. Combined with `get<T>()`, this allows variables of
+		/// unknown type to be accessed without the allocation made by `getAsData()`.
+		IECore::TypeId variableTypeId( const IECore::InternedString &name ) const;
 
 		bool operator == ( const Context &other ) const;
 		bool operator != ( const Context &other ) const;
@@ -223,6 +234,16 @@ class GAFFER_API Context : public IECore::RefCounted
 				template<typename T>
 				void set( const IECore::InternedString &name, const T *value );
 
+				/// Specialised form of `set()` for hierarchical paths such as
+				/// `scene:path`, for use when the variable currently holds the
+				/// parent of `value`. This is typically the case when the scope
+				/// was constructed from the context for the parent location. The
+				/// hash is then derived from the parent's hash in constant time,
+				/// rather than by hashing the full path. If the variable is not
+				/// yet set, this is equivalent to `set()`. The lifetime requirements
+				/// are the same as for `set()`.
+				void setChildPath( const IECore::InternedString &name, const std::vector<IECore::InternedString> *value );
+
 				/// Sets a variable from a copy of `value`. This is more expensive than the
 				/// pointer version above, and should be avoided where possible.
 				template<typename T, typename Enabler = std::enable_if_t<!std::is_pointer<T>::value > >
@@ -298,6 +319,9 @@ class GAFFER_API Context : public IECore::RefCounted
 			template<typename T>
 			Value( const IECore::InternedString &name, const T *value );
 			Value( const IECore::InternedString &name, const IECore::Data *value );
+			// Specialised constructor for paths, where `parent` holds all but
+			// the last element of `value`. Used by `EditableScope::setChildPath()`.
+			Value( const std::vector<IECore::InternedString> *value, const Value &parent );
 			Value( const Value &other ) = default;
 
 			Value &operator = ( const Value &other ) = default;
@@ -329,6 +353,10 @@ class GAFFER_API Context : public IECore::RefCounted
 
 				Value( IECore::TypeId typeId, const void *value, const IECore::MurmurHash &hash );
 
+				// Returns false if the name is excluded from hashing,
+				// in which case the hash has been zeroed.
+				bool appendNameHash( const IECore::InternedString &name );
+
 				IECore::TypeId m_typeId;
 				const void *m_value;
 				IECore::MurmurHash m_hash;
@@ -358,13 +386,24 @@ class GAFFER_API Context : public IECore::RefCounted
 		const Value &internalGet( const IECore::InternedString &name ) const;
 		// Returns nullptr if variable doesn't exist.
 		const Value *internalGetIfExists( const IECore::InternedString &name ) const;
-
-		using Map = boost::container::flat_map<IECore::InternedString, Value>;
+		// Updates `m_hash` to account for a variable changing from `oldVariableHash`
+		// to `newVariableHash`. The context hash is the sum of the variable hashes,
+		// so this is O(1), which is important for EditableScopes that repeatedly
+		// change a single variable during scene traversal.
+		void updateHash( const IECore::MurmurHash &oldVariableHash, const IECore::MurmurHash &newVariableHash );
+
+		// Storage for a typical number of variables is held inline, so that
+		// an EditableScope doesn't need to allocate any memory for the map.
+		using Map = boost::container::flat_map<
+			IECore::InternedString, Value, std::less<IECore::InternedString>,
+			boost::container::small_vector<std::pair<IECore::InternedString, Value>, 12>
+		>;
 
 		Map m_map;
 		ChangedSignal *m_changedSignal;
-		mutable IECore::MurmurHash m_hash;
-		mutable bool m_hashValid;
+		// Sum of the hashes of all variables in `m_map`, maintained
+		// incrementally by `updateHash()`.
+		IECore::MurmurHash m_hash;
 		const IECore::Canceller *m_canceller;
 
 		// The alloc map holds a smart pointer to data that we allocate.  It must keep the entries
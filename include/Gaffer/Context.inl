@@ -37,9 +37,14 @@
 #pragma once
 
 #include "IECore/SimpleTypedData.h"
+#include "IECore/VectorTypedData.h"
 
 #include "fmt/format.h"
 
+#include <algorithm>
+#include <cassert>
+#include <type_traits>
+
 namespace Gaffer
 {
 
@@ -109,6 +114,39 @@ template<typename T>
 Context::Value::Value( const IECore::InternedString &name, const T *value )
 	:	m_typeId( Detail::DataTraits<T>::DataType::staticTypeId() ),
 		m_value( value )
+{
+	if constexpr( std::is_same_v<T, std::vector<IECore::InternedString>> )
+	{
+		// Paths are hashed element by element following the name, so
+		// that `EditableScope::setChildPath()` can derive the hash of a
+		// path from the hash of its parent.
+		if( appendNameHash( name ) )
+		{
+			for( const auto &element : *value )
+			{
+				m_hash.append( element );
+			}
+		}
+	}
+	else
+	{
+		m_hash.append( *value );
+		appendNameHash( name );
+	}
+}
+
+inline Context::Value::Value( const std::vector<IECore::InternedString> *value, const Value &parent )
+	:	m_typeId( IECore::InternedStringVectorData::staticTypeId() ),
+		m_value( value ),
+		m_hash( parent.m_hash )
+{
+	if( m_hash != IECore::MurmurHash( 0, 0 ) )
+	{
+		m_hash.append( value->back() );
+	}
+}
+
+inline bool Context::Value::appendNameHash( const IECore::InternedString &name )
 {
 	const std::string &nameStr = name.string();
 	if( nameStr.size() > 2 && nameStr[0] == 'u' && nameStr[1] == 'i' && nameStr[2] == ':' )
@@ -118,13 +156,12 @@ Context::Value::Value( const IECore::InternedString &name, const T *value )
 		/// keeping the special handling for a little longer in case third parties
 		/// got into the same bad habits we did.
 		m_hash = IECore::MurmurHash( 0, 0 );
+		return false;
 	}
-	else
-	{
-		m_hash.append( *value );
-		m_hash.append( m_typeId );
-		m_hash.append( (uint64_t)&nameStr );
-	}
+
+	m_hash.append( m_typeId );
+	m_hash.append( (uint64_t)&nameStr );
+	return true;
 }
 
 template<typename T>
@@ -184,32 +221,49 @@ void Context::set( const IECore::InternedString &name, const T &value )
 
 inline void Context::internalSet( const IECore::InternedString &name, const Value &value )
 {
-	if( !m_changedSignal )
+	auto [it, inserted] = m_map.try_emplace( name, value );
+	if( inserted )
+	{
+		updateHash( IECore::MurmurHash( 0, 0 ), value.hash() );
+		if( m_changedSignal )
+		{
+			(*m_changedSignal)( this, name );
+		}
+	}
+	else if( !m_changedSignal )
 	{
 		// Fast path, typically in an EditableScope, where we
 		// expect the value to have changed and don't want the
 		// expense of checking.
-		m_map[name] = value;
-		m_hashValid = false;
+		updateHash( it->second.hash(), value.hash() );
+		it->second = value;
 	}
 	else
 	{
 		// Always assign to the value, because the caller might have updated
 		// `m_allocMap` already (removing the previous value).
-		Value &v = m_map[name];
+		Value &v = it->second;
 		const bool changed = v != value;
+		updateHash( v.hash(), value.hash() );
 		v = value;
 		if( changed )
 		{
 			// But avoid emitting `changedSignal` if the value hasn't
 			// actually changed. We want to avoid expensive re-evaluations
 			// that might otherwise be triggered in the UI.
-			m_hashValid = false;
 			(*m_changedSignal)( this, name );
 		}
 	}
 }
 
+inline void Context::updateHash( const IECore::MurmurHash &oldVariableHash, const IECore::MurmurHash &newVariableHash )
+{
+	m_hash = IECore::MurmurHash(
+		m_hash.h1() - oldVariableHash.h1() + newVariableHash.h1(),
+		m_hash.h2() - oldVariableHash.h2() + newVariableHash.h2()
+	);
+}
+
 inline void Context::internalSetWithOwner( const IECore::InternedString &name, const Value &value, IECore::ConstDataPtr &&owner )
 {
 	IECore::ConstDataPtr &currentOwner = m_allocMap[name];
@@ -264,6 +318,11 @@ const T &Context::get( const IECore::InternedString &name, const T &defaultValue
 	return defaultValue;
 }
 
+inline IECore::MurmurHash Context::hash() const
+{
+	return m_hash;
+}
+
 inline IECore::MurmurHash Context::variableHash( const IECore::InternedString &name ) const
 {
 	if( const Value *value = internalGetIfExists( name ) )
@@ -273,6 +332,15 @@ inline IECore::MurmurHash Context::variableHash( const IECore::InternedString &n
 	return IECore::MurmurHash();
 }
 
+inline IECore::TypeId Context::variableTypeId( const IECore::InternedString &name ) const
+{
+	if( const Value *value = internalGetIfExists( name ) )
+	{
+		return value->typeId();
+	}
+	return IECore::InvalidTypeId;
+}
+
 template<typename T>
 const T *Context::getIfExists( const IECore::InternedString &name ) const
 {
@@ -289,6 +357,23 @@ void Context::EditableScope::set( const IECore::InternedString &name, const T *v
 	m_context->internalSet( name, Value( name, value ) );
 }
 
+inline void Context::EditableScope::setChildPath( const IECore::InternedString &name, const std::vector<IECore::InternedString> *value )
+{
+	const Value *parent = m_context->internalGetIfExists( name );
+	if(
+		!parent || value->empty() ||
+		parent->typeId() != IECore::InternedStringVectorData::staticTypeId() ||
+		parent->value<std::vector<IECore::InternedString>>().size() + 1 != value->size()
+	)
+	{
+		set( name, value );
+		return;
+	}
+
+	assert( std::equal( value->begin(), value->end() - 1, parent->value<std::vector<IECore::InternedString>>().begin() ) );
+	m_context->internalSet( name, Value( value, *parent ) );
+}
+
 template<typename T, typename Enabler>
 void Context::EditableScope::setAllocated( const IECore::InternedString &name, const T &value )
 {
@@ -0,0 +1,101 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Export.h"
+
+#include <functional>
+#include <string>
+
+namespace Gaffer
+{
+
+/// Utilities for adapting the size of caches to the memory available
+/// to the process. This allows the same cache limits to be used
+/// safely for processes running on hosts with differing amounts of
+/// memory, or sharing a host with other processes.
+namespace MemoryPressure
+{
+
+/// Returns the amount of memory available to the process in bytes.
+/// On Linux this is the lowest cgroup v2 `memory.max` limit applying
+/// to the process, or the total physical memory if there is no such
+/// limit. Returns 0 on other platforms.
+GAFFER_API size_t memoryLimit();
+/// Returns the amount of memory in use in bytes, measured against
+/// `memoryLimit()`. For a cgroup this is the working set of the group
+/// (excluding reclaimable file cache), and otherwise it is the memory
+/// in use by all processes on the host. Returns 0 on other platforms.
+GAFFER_API size_t memoryUsage();
+
+/// Enables or disables adaptive cache limits. When enabled, memory usage
+/// is sampled periodically during computation, and registered handlers are
+/// called to shrink or grow their caches as appropriate. Cache limits set
+/// explicitly (such as by `ValuePlug::setCacheMemoryLimit()`) are treated as
+/// upper bounds. Disabled by default.
+GAFFER_API void setEnabled( bool enabled );
+GAFFER_API bool getEnabled();
+
+/// The fraction of `memoryLimit()` that memory usage is kept below.
+/// Defaults to 0.85.
+GAFFER_API void setTargetFraction( float fraction );
+GAFFER_API float getTargetFraction();
+
+/// Called with the current memory usage and the target usage, both in
+/// bytes. When usage exceeds the target, handlers should remove items
+/// from their cache immediately, and otherwise they may allow their cache
+/// to grow back towards its upper bound. Handlers may be called concurrently
+/// with computation on other threads, but never concurrently with each other.
+using Handler = std::function<void ( size_t usage, size_t target )>;
+/// Registers a handler to adapt a cache. Any existing handler
+/// with the same name is replaced. When the handler is deregistered
+/// or adaptive limits are disabled, it is called with a `usage` and
+/// `target` of 0, meaning that the cache should be returned to its
+/// upper bound.
+GAFFER_API void registerHandler( const std::string &name, const Handler &handler );
+GAFFER_API void deregisterHandler( const std::string &name );
+
+/// Samples memory usage and calls the registered handlers, provided that
+/// adaptive limits are enabled and the previous sample was taken long enough
+/// ago. This is cheap enough to call frequently, and is called automatically
+/// by ValuePlug after each cache miss. Pass `force = true` to take a sample
+/// regardless of the time since the last one.
+GAFFER_API void update( bool force = false );
+
+} // namespace MemoryPressure
+
+} // namespace Gaffer
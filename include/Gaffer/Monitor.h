@@ -84,6 +84,20 @@ class GAFFER_API Monitor : public IECore::RefCounted
 		/// on this thread.
 		static const MonitorSet &current();
 
+		/// The outcome of a cache lookup made on behalf of a plug.
+		enum class CacheLookup
+		{
+			/// The result was already in the cache.
+			Hit,
+			/// The result was not in the cache, so a process
+			/// was launched to compute it.
+			Miss,
+			/// The result was not in the cache, but was already
+			/// being computed by another thread, so that process
+			/// was waited on.
+			Wait
+		};
+
 	protected :
 
 		Monitor();
@@ -105,6 +119,12 @@ class GAFFER_API Monitor : public IECore::RefCounted
 		/// may allow skipping the execution ( obviously, this is much slower than using the caches )
 		virtual bool forceMonitoring( const Gaffer::Plug *plug, const IECore::InternedString &processType );
 
+		/// Called when a cache lookup is made on behalf of `plug`. Cache hits do
+		/// not launch processes, so this is the only way they can be monitored.
+		/// Implementations must be safe to call concurrently. The default
+		/// implementation does nothing.
+		virtual void cacheLookup( const Gaffer::Plug *plug, const IECore::InternedString &processType, CacheLookup lookup );
+
 };
 
 IE_CORE_DECLAREPTR( Monitor )
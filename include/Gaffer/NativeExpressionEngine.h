@@ -0,0 +1,77 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Export.h"
+
+#include <string>
+
+namespace Gaffer
+{
+
+class Expression;
+
+/// The "native" expression engine implements a small typed language
+/// with Python-like syntax, covering plug access, context access,
+/// arithmetic on numbers, vectors and colours, string formatting and
+/// conditionals. Expressions are compiled to bytecode when they are set,
+/// and are evaluated without the Python GIL, so they scale with the
+/// number of threads.
+///
+/// ```
+/// frame = context.getFrame()
+/// if frame > 10 :
+/// 	parent["node"]["scale"] = V3f( 1, 2, 3 ) * ( frame - 10 )
+/// parent["node"]["fileName"] = "render.{:04d}.exr".format( int( frame ) )
+/// parent["node"]["label"] = "{}_{}".format( context.get( "shot", "none" ), parent["node"]["name"] )
+/// ```
+namespace NativeExpressionEngine
+{
+
+/// Returns the equivalent of `pythonExpression` in the native language, or an
+/// empty string if the expression uses features the native language does not
+/// support. Common idioms such as `imath` and `math` module usage, imports,
+/// `%` and `str.format()` formatting and f-strings are translated.
+GAFFER_API std::string convertPythonExpression( const std::string &pythonExpression );
+/// Converts a Python expression on `expression` to the native language, returning
+/// `true` on success and `false` if the expression is not a Python expression or
+/// cannot be converted, in which case it is left unchanged.
+GAFFER_API bool convertPythonExpression( Expression *expression );
+
+} // namespace NativeExpressionEngine
+
+} // namespace Gaffer
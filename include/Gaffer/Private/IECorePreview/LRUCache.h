@@ -40,6 +40,8 @@
 #include "boost/noncopyable.hpp"
 #include "boost/variant.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <optional>
 
 namespace IECorePreview
@@ -51,16 +53,28 @@ namespace LRUCachePolicy
 /// Not threadsafe. Either use from only a single thread
 /// or protect with an external mutex. Key type must have
 /// a `hash_value` implementation as described in the boost
-/// documentation.
+/// documentation. Always evicts in exact LRU order, ignoring
+/// the EvictionPolicy.
 template<typename LRUCache>
 class Serial;
 
 /// Threadsafe, `get()` blocks if another thread is already
 /// computing the value. Key type must have a `hash_value`
 /// implementation as described in the boost documentation.
+/// Supports all EvictionPolicies.
 template<typename LRUCache>
 class Parallel;
 
+/// As Parallel, but additionally maintains a table of recently used
+/// items which `getIfCached()` reads without taking any locks or
+/// writing to shared memory. This allows lookups of frequently used
+/// items to scale with the number of threads. Key and Value are copied
+/// bytewise into the table, so must be trivially destructible, must not
+/// depend on their own address, and must have an alignment no greater
+/// than that of `uint64_t`.
+template<typename LRUCache>
+class ParallelLockFreeRead;
+
 /// Threadsafe, `get()` collaborates on TBB tasks if another
 /// thread is already computing the value. Key type must have
 /// a `hash_value` implementation as described in the boost
@@ -70,6 +84,8 @@ class Parallel;
 /// > mechanism, so if it is known that tasks will not be spawned for
 /// > `GetterFunction( getterKey )` you may define a `bool spawnsTasks( const GetterKey & )`
 /// > function that will be used to avoid the overhead.
+///
+/// Supports all EvictionPolicies.
 template<typename LRUCache>
 class TaskParallel;
 
@@ -100,6 +116,23 @@ class LRUCache : private boost::noncopyable
 
 		using Cost = size_t;
 		using KeyType = Key;
+		using ValueType = Value;
+		/// Time taken to compute a value, used by `EvictionPolicy::CostAware`.
+		using ComputeTime = std::chrono::nanoseconds;
+
+		/// Determines which items are discarded when the cache
+		/// exceeds its maximum cost.
+		enum class EvictionPolicy
+		{
+			/// Items are discarded in approximately least-recently-used order.
+			LRU,
+			/// Items that were expensive to compute relative to their cost are
+			/// retained in preference to items that were cheap to compute. This is
+			/// an approximation of the GreedyDual-Size algorithm, where an item survives
+			/// a number of eviction sweeps proportional to the logarithm of its
+			/// compute time per unit cost.
+			CostAware
+		};
 
 		/// The GetterFunction is responsible for computing the value and cost for a cache entry
 		/// when given the key. It should throw a descriptive exception if it can't get the data for
@@ -129,15 +162,16 @@ class LRUCache : private boost::noncopyable
 		/// Returns true for success and false on failure - failure can occur
 		/// if the cost exceeds the maximum cost for the cache. Note that even
 		/// when true is returned, the item may be removed from the cache by a
-		/// subsequent (or concurrent) operation.
-		bool set( const Key &key, const Value &value, Cost cost );
+		/// subsequent (or concurrent) operation. The `computeTime` is used
+		/// by `EvictionPolicy::CostAware` to prioritise expensive items.
+		bool set( const Key &key, const Value &value, Cost cost, ComputeTime computeTime = ComputeTime::zero() );
 		/// As above, but only if the item is not cached already. This avoids
 		/// calling a potentially expensive cost function in the case that the
 		/// item is cached already.
 		/// \todo Ideally we wouldn't need the cost calculation to be duplicated
 		/// between CostFunction and GetterFunction.
 		template<typename CostFunction>
-		bool setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction );
+		bool setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, ComputeTime computeTime = ComputeTime::zero() );
 
 		/// Returns true if the object is in the cache. Note that the
 		/// return value may be invalidated immediately by operations performed
@@ -163,13 +197,27 @@ class LRUCache : private boost::noncopyable
 		/// Returns the current cost of all cached items.
 		Cost currentCost() const;
 
+		/// Sets the policy used to choose items for removal. Changes
+		/// take effect for items added or accessed subsequently.
+		void setEvictionPolicy( EvictionPolicy evictionPolicy );
+		EvictionPolicy getEvictionPolicy() const;
+
+		/// Returns the number of items that have been removed from
+		/// the cache to keep it within the maximum cost.
+		size_t evictions() const;
+		/// Returns the total cost of all items that have been removed
+		/// from the cache to keep it within the maximum cost.
+		Cost evictedCost() const;
+
 	private :
 
 		// Data
 		//////////////////////////////////////////////////////////////////////////
 
-		// Give Policy access to CacheEntry definitions.
+		// Give Policy access to CacheEntry definitions. Parallel is also
+		// given access because it is the base class for ParallelLockFreeRead.
 		friend class Policy<LRUCache>;
+		template<typename> friend class LRUCachePolicy::Parallel;
 
 		// A function for computing values, and one for notifying of removals.
 		GetterFunction m_getter;
@@ -198,6 +246,10 @@ class LRUCache : private boost::noncopyable
 
 			State state;
 			Cost cost; // the cost for this item
+			// The number of eviction sweeps this item survives
+			// after being accessed. Used by the Parallel and
+			// TaskParallel policies.
+			unsigned char retention;
 
 			Status status() const;
 
@@ -209,13 +261,20 @@ class LRUCache : private boost::noncopyable
 
 		Cost m_maxCost;
 		bool m_cacheErrors;
+		std::atomic<EvictionPolicy> m_evictionPolicy;
+		std::atomic<size_t> m_evictions;
+		std::atomic<Cost> m_evictedCost;
 
 		// Methods
 		// =======
 
 		// Updates the cached value and updates the current
 		// total cost.
-		bool setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost );
+		bool setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost, ComputeTime computeTime );
+
+		// Returns the value for `CacheEntry::retention`, according
+		// to the current EvictionPolicy.
+		unsigned char computeRetention( Cost cost, ComputeTime computeTime ) const;
 
 		// Removes any cached value and updates the current total
 		// cost.
@@ -49,9 +49,14 @@
 #include "tbb/spin_mutex.h"
 #include "tbb/spin_rw_mutex.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <new>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace IECorePreview
@@ -302,16 +307,17 @@ class Parallel
 
 		struct Item
 		{
-			Item() : recentlyUsed() {}
-			Item( const Key &key ) : key( key ), recentlyUsed() {}
-			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), recentlyUsed() {}
+			Item() : chances() {}
+			Item( const Key &key ) : key( key ), chances() {}
+			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), chances() {}
 			Key key;
 			mutable CacheEntry cacheEntry;
 			// Mutex to protect cacheEntry.
 			using Mutex = tbb::spin_rw_mutex;
 			mutable Mutex mutex;
-			// Flag used in second-chance algorithm.
-			mutable std::atomic_bool recentlyUsed;
+			// Number of remaining chances in second-chance algorithm.
+			// Reset to `cacheEntry.retention` when the item is used.
+			mutable std::atomic<unsigned char> chances;
 		};
 
 		// We would love to use one of TBB's concurrent containers as
@@ -391,6 +397,11 @@ class Parallel
 				return m_writable;
 			}
 
+			const Key &key() const
+			{
+				return m_item->key;
+			}
+
 			template<typename F>
 			void execute( F &&f )
 			{
@@ -503,14 +514,34 @@ class Parallel
 		void push( Handle &handle )
 		{
 			// Simply mark the item as having been used
-			// recently. We will then give it a second chance
+			// recently. We will then give it further chances
 			// in pop(), so it will not be evicted immediately.
 			// We don't need the handle to be writable to write
-			// here, because `recentlyUsed` is atomic.
-			handle.m_item->recentlyUsed.store( true, std::memory_order_release );
+			// here, because `chances` is atomic. We avoid the
+			// store if it wouldn't change anything, so that
+			// threads repeatedly reading the same item don't
+			// contend for its cache line.
+			const unsigned char retention = handle.m_item->cacheEntry.retention;
+			if( handle.m_item->chances.load( std::memory_order_relaxed ) != retention )
+			{
+				handle.m_item->chances.store( retention, std::memory_order_release );
+			}
 		}
 
 		bool pop( Key &key, CacheEntry &cacheEntry )
+		{
+			return popInternal( key, cacheEntry, [] ( const Key &key ) { return false; } );
+		}
+
+		AtomicCost currentCost;
+
+	protected :
+
+		// Implementation of `pop()`, allowing derived classes to provide a
+		// `recentlyUsed( key )` function to save items from eviction when they
+		// have been used without a call to `push()`.
+		template<typename RecentlyUsedFunction>
+		bool popInternal( Key &key, CacheEntry &cacheEntry, RecentlyUsedFunction &&recentlyUsed )
 		{
 			// Popping works by iterating the map until an item
 			// that has not been recently used is found. We store
@@ -552,8 +583,8 @@ class Parallel
 						{
 							// We're not empty, but we've been around and around
 							// without finding anything to pop. This could happen
-							// if other threads are frantically setting
-							// the `recentlyUsed` flag or if `clear()` is
+							// if other threads are frantically resetting
+							// `chances` or if `clear()` is
 							// called from `get()`, while `get()` holds the lock
 							// on the only item we could pop.
 							return false;
@@ -563,7 +594,15 @@ class Parallel
 
 				if( itemLock.try_acquire( m_popIterator->mutex ) )
 				{
-					if( !m_popIterator->recentlyUsed.load( std::memory_order_acquire ) )
+					const unsigned char chances = m_popIterator->chances.load( std::memory_order_acquire );
+					if( !chances && recentlyUsed( m_popIterator->key ) )
+					{
+						// Item has been used without our knowledge. Give it
+						// the same chances it would have had from `push()`.
+						m_popIterator->chances.store( m_popIterator->cacheEntry.retention, std::memory_order_release );
+						itemLock.release();
+					}
+					else if( !chances )
 					{
 						// Pop this item.
 						key = m_popIterator->key;
@@ -581,10 +620,10 @@ class Parallel
 					}
 					else
 					{
-						// Item has been used recently. Flag it so we
-						// can pop it next time round, unless another
-						// thread resets the flag.
-						m_popIterator->recentlyUsed.store( false, std::memory_order_release );
+						// Item has been used recently. Use up one of its
+						// chances so we can pop it eventually, unless another
+						// thread resets them.
+						m_popIterator->chances.store( chances - 1, std::memory_order_release );
 						itemLock.release();
 					}
 				}
@@ -599,8 +638,6 @@ class Parallel
 			}
 		}
 
-		AtomicCost currentCost;
-
 	private :
 
 		Bins m_bins;
@@ -621,6 +658,293 @@ class Parallel
 };
 
 
+// A fixed-size, direct-mapped table of keys and values which can be read
+// without taking any locks. Each slot is protected by a sequence lock :
+// writers mark the sequence number before and after modifying the slot,
+// and readers copy the slot optimistically, discarding the copy if the
+// sequence number changed in the meantime. Readers never write to the slot
+// (other than to set the `used` flag the first time), so threads reading
+// the same item don't contend for its cache line. Keys and values are
+// copied bytewise, so must be trivially destructible and must not depend
+// on their own address.
+template<typename Key, typename Value>
+class LockFreeTable : private boost::noncopyable
+{
+
+	public :
+
+		LockFreeTable( size_t numSlots )
+			:	m_slots( new Slot[numSlots] ), m_mask( numSlots - 1 )
+		{
+			assert( ( numSlots & m_mask ) == 0 ); // Power of two
+		}
+
+		std::optional<Value> find( const Key &key ) const
+		{
+			const Slot &slot = this->slot( key );
+			Words<Key> slotKey;
+			Words<Value> slotValue;
+			if( !read( slot, slotKey, &slotValue ) || !( slotKey.get() == key ) )
+			{
+				return std::nullopt;
+			}
+
+			if( !slot.used.load( std::memory_order_relaxed ) )
+			{
+				slot.used.store( true, std::memory_order_relaxed );
+			}
+			return slotValue.get();
+		}
+
+		void insert( const Key &key, const Value &value )
+		{
+			Slot &slot = this->slot( key );
+
+			Words<Key> slotKey;
+			if( read( slot, slotKey ) && slotKey.get() == key )
+			{
+				// Already present. Avoid writing, since the whole point is
+				// to allow threads to share the cache line.
+				return;
+			}
+
+			uint64_t sequence = slot.sequence.load( std::memory_order_relaxed );
+			if( ( sequence & g_writing ) || !slot.sequence.compare_exchange_strong( sequence, sequence | g_writing, std::memory_order_acquire ) )
+			{
+				// Another thread is writing to the slot. Since the table is
+				// only an optimisation, we just leave them to it.
+				return;
+			}
+			std::atomic_thread_fence( std::memory_order_release );
+
+			Words<Key>( key ).store( slot.key );
+			Words<Value>( value ).store( slot.value );
+			slot.used.store( false, std::memory_order_relaxed );
+
+			slot.sequence.store( nextSequence( sequence ) | g_valid, std::memory_order_release );
+		}
+
+		// Removes `key` from the table. We return without waiting if another
+		// thread is writing to the slot, so if it is important that the key is
+		// gone, the caller must prevent concurrent calls to `insert( key )`.
+		// That way we know the other thread is replacing the key with another.
+		void erase( const Key &key )
+		{
+			Slot &slot = this->slot( key );
+			while( true )
+			{
+				const uint64_t sequence = slot.sequence.load( std::memory_order_acquire );
+				Words<Key> slotKey;
+				if( !read( slot, slotKey ) || !( slotKey.get() == key ) )
+				{
+					return;
+				}
+
+				uint64_t expected = sequence;
+				if( slot.sequence.compare_exchange_strong( expected, sequence | g_writing, std::memory_order_acquire ) )
+				{
+					slot.sequence.store( nextSequence( sequence ), std::memory_order_release );
+					return;
+				}
+			}
+		}
+
+		// Returns true if `key` has been returned by `find()` since it was
+		// inserted or last passed to this function.
+		bool testAndClearUsed( const Key &key ) const
+		{
+			const Slot &slot = this->slot( key );
+			Words<Key> slotKey;
+			if( !read( slot, slotKey ) || !( slotKey.get() == key ) )
+			{
+				return false;
+			}
+			return slot.used.exchange( false, std::memory_order_relaxed );
+		}
+
+	private :
+
+		static_assert( std::is_trivially_destructible_v<Key> && std::is_trivially_destructible_v<Value> );
+
+		// Storage for a bytewise copy of `T`, as a sequence of
+		// words which can be stored atomically.
+		template<typename T>
+		struct Words
+		{
+
+			static_assert( alignof( T ) <= alignof( uint64_t ) );
+			static constexpr size_t size = ( sizeof( T ) + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t );
+			using Atomic = std::atomic<uint64_t>[size];
+
+			Words()
+			{
+			}
+
+			Words( const T &t )
+			{
+				std::fill( std::begin( words ), std::end( words ), 0 );
+				std::memcpy( words, &t, sizeof( T ) );
+			}
+
+			void load( const Atomic &source )
+			{
+				for( size_t i = 0; i < size; ++i )
+				{
+					words[i] = source[i].load( std::memory_order_relaxed );
+				}
+			}
+
+			void store( Atomic &destination ) const
+			{
+				for( size_t i = 0; i < size; ++i )
+				{
+					destination[i].store( words[i], std::memory_order_relaxed );
+				}
+			}
+
+			const T &get() const
+			{
+				return *std::launder( reinterpret_cast<const T *>( words ) );
+			}
+
+			uint64_t words[size];
+
+		};
+
+		// Bits of `Slot::sequence`. The remaining bits are
+		// incremented each time a write is completed.
+		static constexpr uint64_t g_writing = 1;
+		static constexpr uint64_t g_valid = 2;
+		static constexpr uint64_t g_increment = 4;
+
+		static uint64_t nextSequence( uint64_t sequence )
+		{
+			return ( sequence & ~( g_writing | g_valid ) ) + g_increment;
+		}
+
+		struct Slot
+		{
+			Slot() : sequence( 0 ), used( false ) {}
+			std::atomic<uint64_t> sequence;
+			mutable std::atomic<bool> used;
+			typename Words<Key>::Atomic key;
+			typename Words<Value>::Atomic value;
+		};
+
+		// Copies the contents of the slot, returning false if
+		// it is empty or is modified while we are reading it.
+		static bool read( const Slot &slot, Words<Key> &key, Words<Value> *value = nullptr )
+		{
+			const uint64_t sequence = slot.sequence.load( std::memory_order_acquire );
+			if( ( sequence & ( g_writing | g_valid ) ) != g_valid )
+			{
+				return false;
+			}
+
+			key.load( slot.key );
+			if( value )
+			{
+				value->load( slot.value );
+			}
+
+			std::atomic_thread_fence( std::memory_order_acquire );
+			return slot.sequence.load( std::memory_order_relaxed ) == sequence;
+		}
+
+		Slot &slot( const Key &key ) const
+		{
+			return m_slots[boost::hash<Key>()( key ) & m_mask];
+		}
+
+		std::unique_ptr<Slot[]> m_slots;
+		const size_t m_mask;
+
+};
+
+// Extends the Parallel policy with a LockFreeTable of recently
+// used items, which is consulted by `LRUCache::getIfCached()`
+// before acquiring any locks.
+template<typename LRUCache>
+class ParallelLockFreeRead : public Parallel<LRUCache>
+{
+
+	public :
+
+		using Base = Parallel<LRUCache>;
+		using CacheEntry = typename LRUCache::CacheEntry;
+		using Key = typename LRUCache::KeyType;
+		using Value = typename LRUCache::ValueType;
+		using Handle = typename Base::Handle;
+
+		ParallelLockFreeRead()
+			:	m_table( 16384 )
+		{
+		}
+
+		bool acquire( const Key &key, Handle &handle, AcquireMode mode, const IECore::Canceller *canceller )
+		{
+			if( !Base::acquire( key, handle, mode, canceller ) )
+			{
+				return false;
+			}
+
+			if( handle.isWritable() )
+			{
+				// The CacheEntry may be about to change, so we must stop
+				// lock-free readers from seeing the current value. It will be
+				// reinstated by `push()` if appropriate. Since the handle
+				// holds a write lock on the item, no other thread can be
+				// inserting the same key concurrently.
+				m_table.erase( key );
+			}
+
+			return true;
+		}
+
+		void push( Handle &handle )
+		{
+			Base::push( handle );
+			const CacheEntry &cacheEntry = handle.readable();
+			if( cacheEntry.status() == LRUCache::Cached )
+			{
+				m_table.insert( handle.key(), boost::get<Value>( cacheEntry.state ) );
+			}
+		}
+
+		bool pop( Key &key, CacheEntry &cacheEntry )
+		{
+			// Reads via `find()` don't call `push()`, so we consult the
+			// table to avoid evicting items that are in constant use.
+			if( !Base::popInternal( key, cacheEntry, [this] ( const Key &key ) { return m_table.testAndClearUsed( key ); } ) )
+			{
+				return false;
+			}
+
+			// The item has been removed from the map, so no other thread
+			// can insert it into the table until it has been recreated.
+			m_table.erase( key );
+			return true;
+		}
+
+		std::optional<Value> find( const Key &key ) const
+		{
+			return m_table.find( key );
+		}
+
+	private :
+
+		LockFreeTable<Key, Value> m_table;
+
+};
+
+// Detects policies providing a `find()` method that can be used by
+// `LRUCache::getIfCached()` to read values without acquiring a Handle.
+template<typename Policy, typename = void>
+struct HasFind : std::false_type {};
+
+template<typename Policy>
+struct HasFind<Policy, std::void_t<decltype( std::declval<const Policy &>().find( std::declval<const typename Policy::Key &>() ) )>> : std::true_type {};
+
 /// Used to determine if `GetterFunction( key )` will spawn tasks.
 /// If it is specialised to return false for certain keys, then
 /// some significant TBB task sharing overhead is avoided.
@@ -648,16 +972,17 @@ class TaskParallel
 
 		struct Item
 		{
-			Item() : recentlyUsed() {}
-			Item( const Key &key ) : key( key ), recentlyUsed() {}
-			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), recentlyUsed() {}
+			Item() : chances() {}
+			Item( const Key &key ) : key( key ), chances() {}
+			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), chances() {}
 			Key key;
 			mutable CacheEntry cacheEntry;
 			// Mutex to protect cacheEntry.
 			using Mutex = TaskMutex;
 			mutable Mutex mutex;
-			// Flag used in second-chance algorithm.
-			mutable std::atomic_bool recentlyUsed;
+			// Number of remaining chances in second-chance algorithm.
+			// Reset to `cacheEntry.retention` when the item is used.
+			mutable std::atomic<unsigned char> chances;
 		};
 
 		// We would love to use one of TBB's concurrent containers as
@@ -888,11 +1213,18 @@ class TaskParallel
 		void push( Handle &handle )
 		{
 			// Simply mark the item as having been used
-			// recently. We will then give it a second chance
+			// recently. We will then give it further chances
 			// in pop(), so it will not be evicted immediately.
 			// We don't need the handle to be writable to write
-			// here, because `recentlyUsed` is atomic.
-			handle.m_item->recentlyUsed.store( true, std::memory_order_release );
+			// here, because `chances` is atomic. We avoid the
+			// store if it wouldn't change anything, so that
+			// threads repeatedly reading the same item don't
+			// contend for its cache line.
+			const unsigned char retention = handle.m_item->cacheEntry.retention;
+			if( handle.m_item->chances.load( std::memory_order_relaxed ) != retention )
+			{
+				handle.m_item->chances.store( retention, std::memory_order_release );
+			}
 		}
 
 		bool pop( Key &key, CacheEntry &cacheEntry )
@@ -937,8 +1269,8 @@ class TaskParallel
 						{
 							// We're not empty, but we've been around and around
 							// without finding anything to pop. This could happen
-							// if other threads are frantically setting
-							// the `recentlyUsed` flag or if `clear()` is
+							// if other threads are frantically resetting
+							// `chances` or if `clear()` is
 							// called from `get()`, while `get()` holds the lock
 							// on the only item we could pop.
 							return false;
@@ -948,7 +1280,8 @@ class TaskParallel
 
 				if( itemLock.tryAcquire( m_popIterator->mutex ) )
 				{
-					if( !m_popIterator->recentlyUsed.load( std::memory_order_acquire ) )
+					const unsigned char chances = m_popIterator->chances.load( std::memory_order_acquire );
+					if( !chances )
 					{
 						// Pop this item.
 						key = m_popIterator->key;
@@ -966,10 +1299,10 @@ class TaskParallel
 					}
 					else
 					{
-						// Item has been used recently. Flag it so we
-						// can pop it next time round, unless another
-						// thread resets the flag.
-						m_popIterator->recentlyUsed.store( false, std::memory_order_release );
+						// Item has been used recently. Use up one of its
+						// chances so we can pop it eventually, unless another
+						// thread resets them.
+						m_popIterator->chances.store( chances - 1, std::memory_order_release );
 						itemLock.release();
 					}
 				}
@@ -1012,7 +1345,7 @@ class TaskParallel
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 LRUCache<Key, Value, Policy, GetterKey>::CacheEntry::CacheEntry()
-	:	cost( 0 )
+	:	cost( 0 ), retention( 1 )
 {
 }
 
@@ -1027,7 +1360,7 @@ typename LRUCache<Key, Value, Policy, GetterKey>::Status LRUCache<Key, Value, Po
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 LRUCache<Key, Value, Policy, GetterKey>::LRUCache( GetterFunction getter, Cost maxCost, RemovalCallback removalCallback, bool cacheErrors )
-	:	m_getter( getter ), m_removalCallback( removalCallback ), m_maxCost( maxCost ), m_cacheErrors( cacheErrors )
+	:	m_getter( getter ), m_removalCallback( removalCallback ), m_maxCost( maxCost ), m_cacheErrors( cacheErrors ), m_evictionPolicy( EvictionPolicy::LRU ), m_evictions( 0 ), m_evictedCost( 0 )
 {
 }
 
@@ -1074,6 +1407,30 @@ typename LRUCache<Key, Value, Policy, GetterKey>::Cost LRUCache<Key, Value, Poli
 	return m_policy.currentCost;
 }
 
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+void LRUCache<Key, Value, Policy, GetterKey>::setEvictionPolicy( EvictionPolicy evictionPolicy )
+{
+	m_evictionPolicy = evictionPolicy;
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+typename LRUCache<Key, Value, Policy, GetterKey>::EvictionPolicy LRUCache<Key, Value, Policy, GetterKey>::getEvictionPolicy() const
+{
+	return m_evictionPolicy;
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+size_t LRUCache<Key, Value, Policy, GetterKey>::evictions() const
+{
+	return m_evictions.load( std::memory_order_relaxed );
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+typename LRUCache<Key, Value, Policy, GetterKey>::Cost LRUCache<Key, Value, Policy, GetterKey>::evictedCost() const
+{
+	return m_evictedCost.load( std::memory_order_relaxed );
+}
+
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const IECore::Canceller *canceller )
 {
@@ -1087,6 +1444,7 @@ Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const
 		assert( handle.isWritable() );
 		Value value = Value();
 		Cost cost = 0;
+		const auto startTime = std::chrono::steady_clock::now();
 		try
 		{
 			handle.execute( [this, &value, &key, &cost, canceller] { value = m_getter( key, cost, canceller ); } );
@@ -1107,7 +1465,7 @@ Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const
 		assert( cacheEntry.status() != Cached ); // this would indicate that another thread somehow
 		assert( cacheEntry.status() != Failed ); // loaded the same thing as us, which is not the intention.
 
-		setInternal( key, handle.writable(), value, cost );
+		setInternal( key, handle.writable(), value, cost, std::chrono::steady_clock::now() - startTime );
 		m_policy.push( handle );
 
 		handle.release();
@@ -1129,6 +1487,14 @@ Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 std::optional<Value> LRUCache<Key, Value, Policy, GetterKey>::getIfCached( const Key &key )
 {
+	if constexpr( LRUCachePolicy::HasFind<Policy<LRUCache>>::value )
+	{
+		if( auto value = m_policy.find( key ) )
+		{
+			return value;
+		}
+	}
+
 	typename Policy<LRUCache>::Handle handle;
 	if( !m_policy.acquire( key, handle, LRUCachePolicy::FindReadable, /* canceller = */ nullptr ) )
 	{
@@ -1154,12 +1520,12 @@ std::optional<Value> LRUCache<Key, Value, Policy, GetterKey>::getIfCached( const
 }
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
-bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &value, Cost cost )
+bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &value, Cost cost, ComputeTime computeTime )
 {
 	typename Policy<LRUCache>::Handle handle;
 	m_policy.acquire( key, handle, LRUCachePolicy::InsertWritable, /* canceller = */ nullptr );
 	assert( handle.isWritable() );
-	bool result = setInternal( key, handle.writable(), value, cost );
+	bool result = setInternal( key, handle.writable(), value, cost, computeTime );
 	m_policy.push( handle );
 	handle.release();
 	limitCost( m_maxCost );
@@ -1168,7 +1534,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 template<typename CostFunction>
-bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction )
+bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, ComputeTime computeTime )
 {
 	typename Policy<LRUCache>::Handle handle;
 	m_policy.acquire( key, handle, LRUCachePolicy::Insert, /* canceller = */ nullptr );
@@ -1179,7 +1545,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, con
 	if( status == Uncached )
 	{
 		assert( handle.isWritable() );
-		result = setInternal( key, handle.writable(), value, costFunction( value ) );
+		result = setInternal( key, handle.writable(), value, costFunction( value ), computeTime );
 		m_policy.push( handle );
 
 		handle.release();
@@ -1189,7 +1555,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, con
 }
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
-bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost )
+bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost, ComputeTime computeTime )
 {
 	eraseInternal( key, cacheEntry );
 
@@ -1200,12 +1566,39 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, Cache
 
 	cacheEntry.state = value;
 	cacheEntry.cost = cost;
+	cacheEntry.retention = computeRetention( cost, computeTime );
 
 	m_policy.currentCost += cost;
 
 	return true;
 }
 
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+unsigned char LRUCache<Key, Value, Policy, GetterKey>::computeRetention( Cost cost, ComputeTime computeTime ) const
+{
+	if( m_evictionPolicy.load( std::memory_order_relaxed ) == EvictionPolicy::LRU )
+	{
+		// Standard second-chance behaviour.
+		return 1;
+	}
+
+	// GreedyDual-Size prioritises items by their compute time divided by
+	// their cost. We quantise the logarithm of this ratio into a small
+	// number of chances, so that the worst case for `Policy::pop()`
+	// is still just a handful of sweeps through the cache. The scaling
+	// is chosen so that typical values are spread across the range
+	// when cost is measured in bytes.
+	const uint64_t ratio = std::max<int64_t>( computeTime.count(), 0 ) * 1024 / std::max<Cost>( cost, 1 );
+	unsigned char log2Ratio = 0;
+	for( uint64_t r = ratio; r > 1; r >>= 1 )
+	{
+		log2Ratio++;
+	}
+
+	const unsigned char maxRetention = 8;
+	return std::min<unsigned char>( 1 + log2Ratio / 2, maxRetention );
+}
+
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 bool LRUCache<Key, Value, Policy, GetterKey>::cached( const Key &key ) const
 {
@@ -1275,7 +1668,12 @@ void LRUCache<Key, Value, Policy, GetterKey>::limitCost( Cost cost )
 			break;
 		}
 
-		eraseInternal( key, cacheEntry );
+		const Cost entryCost = cacheEntry.cost;
+		if( eraseInternal( key, cacheEntry ) )
+		{
+			m_evictions.fetch_add( 1, std::memory_order_relaxed );
+			m_evictedCost.fetch_add( entryCost, std::memory_order_relaxed );
+		}
 	}
 }
 
@@ -38,6 +38,7 @@
 
 #include "Gaffer/Context.h"
 #include "Gaffer/Export.h"
+#include "Gaffer/Monitor.h"
 #include "Gaffer/Plug.h"
 #include "Gaffer/ThreadState.h"
 
@@ -86,6 +87,10 @@ class GAFFER_API Process : private ThreadState::Scope
 		/// may allow skipping the execution ( obviously, this is much slower than using the caches )
 		inline static bool forceMonitoring( const ThreadState &s, const Plug *plug, const IECore::InternedString &processType );
 
+		/// Notifies any active monitors of a cache lookup made on behalf of `plug`.
+		/// Should be called by code which consults a cache before launching a process.
+		inline static void monitorCacheLookup( const ThreadState &s, const Plug *plug, const IECore::InternedString &processType, Monitor::CacheLookup lookup );
+
 	protected :
 
 		/// Protected constructor for use by derived classes only.
@@ -115,6 +120,9 @@ class GAFFER_API Process : private ThreadState::Scope
 		///   to be used for the caching of the result.
 		/// - `ProcessType::cacheCostFunction()` is a static function suitable
 		///   for use with `CacheType::setIfUncached()`.
+		/// - `ProcessType::staticType` is the type of the process, and the first
+		///   of `args` is the plug it is performed for. These are used to notify
+		///   monitors via `Monitor::cacheLookup()`.
 		///
 		template<typename ProcessType, typename... ProcessArguments>
 		static typename ProcessType::ResultType acquireCollaborativeResult(
@@ -128,6 +136,7 @@ class GAFFER_API Process : private ThreadState::Scope
 		class TypedCollaboration;
 
 		static bool forceMonitoringInternal( const ThreadState &s, const Plug *plug, const IECore::InternedString &processType );
+		static void monitorCacheLookupInternal( const ThreadState &s, const Plug *plug, const IECore::InternedString &processType, Monitor::CacheLookup lookup );
 
 		void emitError( const std::string &error, const Plug *source = nullptr ) const;
 
@@ -39,6 +39,7 @@
 #include "tbb/task_arena.h"
 #include "tbb/task_group.h"
 
+#include <chrono>
 #include <unordered_set>
 #include <variant>
 
@@ -305,6 +306,17 @@ class Process::TypedCollaboration : public Process::Collaboration
 template<typename ProcessType>
 typename Process::TypedCollaboration<ProcessType>::PendingCollaborations Process::TypedCollaboration<ProcessType>::g_pendingCollaborations;
 
+namespace Detail
+{
+
+template<typename... Rest>
+const Plug *firstPlugArgument( const Plug *plug, Rest&&... )
+{
+	return plug;
+}
+
+} // namespace Detail
+
 template<typename ProcessType, typename... ProcessArguments>
 typename ProcessType::ResultType Process::acquireCollaborativeResult(
 	const typename ProcessType::CacheType::KeyType &cacheKey, ProcessArguments&&... args
@@ -384,6 +396,8 @@ typename ProcessType::ResultType Process::acquireCollaborativeResult(
 
 		accessor.release();
 
+		Process::monitorCacheLookup( threadState, Detail::firstPlugArgument( args... ), ProcessType::staticType, Monitor::CacheLookup::Wait );
+
 		collaboration->arena.execute(
 			[&]{ return collaboration->taskGroup.wait(); }
 		);
@@ -397,9 +411,12 @@ typename ProcessType::ResultType Process::acquireCollaborativeResult(
 
 	if( auto result = ProcessType::g_cache.getIfCached( cacheKey ) )
 	{
+		Process::monitorCacheLookup( threadState, Detail::firstPlugArgument( args... ), ProcessType::staticType, Monitor::CacheLookup::Hit );
 		return *result;
 	}
 
+	Process::monitorCacheLookup( threadState, Detail::firstPlugArgument( args... ), ProcessType::staticType, Monitor::CacheLookup::Miss );
+
 	CollaborationTypePtr collaboration = new CollaborationType;
 	collaboration->canceller = const_cast<IECore::Canceller *>( threadState.context()->canceller() );
 	if( currentCollaboration )
@@ -422,13 +439,16 @@ typename ProcessType::ResultType Process::acquireCollaborativeResult(
 					{
 						ProcessType process( std::forward<ProcessArguments>( args )... );
 						process.m_collaboration = collaboration.get();
+						const auto startTime = std::chrono::steady_clock::now();
 						collaboration->result = process.run();
 						// Publish result to cache before we remove ourself from
 						// `g_pendingCollaborations`, so that other threads will
-						// be able to get the result one way or the other.
+						// be able to get the result one way or the other. The
+						// compute time allows the cache to prioritise expensive
+						// results if it is using a cost-aware eviction policy.
 						ProcessType::g_cache.setIfUncached(
 							cacheKey, std::get<typename ProcessType::ResultType>( collaboration->result ),
-							ProcessType::cacheCostFunction
+							ProcessType::cacheCostFunction, std::chrono::steady_clock::now() - startTime
 						);
 					}
 					catch( ... )
@@ -469,4 +489,12 @@ inline bool Process::forceMonitoring( const ThreadState &s, const Plug *plug, co
 	return false;
 }
 
+inline void Process::monitorCacheLookup( const ThreadState &s, const Plug *plug, const IECore::InternedString &processType, Monitor::CacheLookup lookup )
+{
+	if( !s.m_monitors->empty() )
+	{
+		Process::monitorCacheLookupInternal( s, plug, processType, lookup );
+	}
+}
+
 } // Gaffer
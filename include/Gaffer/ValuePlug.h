@@ -132,6 +132,28 @@ class GAFFER_API ValuePlug : public Plug
 			Default
 		};
 
+		/// Allows values to be stored in the compute cache in an encoded form,
+		/// trading the cost of encoding and decoding for reduced memory usage.
+		/// Codecs are provided on a per-plug basis by `ComputeNode::computeCacheCodec()`.
+		class GAFFER_API CacheCodec : public IECore::RefCounted
+		{
+
+			public :
+
+				IE_CORE_DECLAREMEMBERPTR( CacheCodec );
+
+				/// Returns the encoded form of `value` to be stored in the cache,
+				/// or `nullptr` if `value` should be stored as-is.
+				virtual IECore::ConstObjectPtr encode( const IECore::Object *value ) const = 0;
+				/// Returns the value that was encoded by `encode()`. May be called
+				/// concurrently from many threads, and for any plug whose value
+				/// shares a hash with the original.
+				virtual IECore::ConstObjectPtr decode( const IECore::Object *encodedValue ) const = 0;
+
+		};
+
+		IE_CORE_DECLAREPTR( CacheCodec );
+
 		/// @name Cache management
 		/// ValuePlug optimises repeated computation by storing a cache of
 		/// recently computed values. These functions allow for management
@@ -141,11 +163,74 @@ class GAFFER_API ValuePlug : public Plug
 		/// Returns the maximum amount of memory in bytes to use for the cache.
 		static size_t getCacheMemoryLimit();
 		/// Sets the maximum amount of memory the cache may use in bytes.
+		/// When adaptive limits are enabled via `MemoryPressure::setEnabled()`,
+		/// the cache may be held below this limit to keep the process within
+		/// the memory available to it.
 		static void setCacheMemoryLimit( size_t bytes );
 		/// Returns the current memory usage of the cache in bytes.
 		static size_t cacheMemoryUsage();
+		/// Returns the number of values that have been discarded from
+		/// the cache to keep it within the memory limit.
+		static size_t cacheEvictions();
+		/// Returns the total memory usage in bytes of all values that
+		/// have been discarded from the cache to keep it within the
+		/// memory limit.
+		static size_t cacheEvictedMemory();
 		/// Clears the cache.
 		static void clearCache();
+		/// Determines which values are discarded when the cache
+		/// exceeds its memory limit.
+		enum class CacheEvictionPolicy
+		{
+			/// Values are discarded in approximately least-recently-used order.
+			LRU,
+			/// Values that took a long time to compute relative to their
+			/// memory usage are retained in preference to cheaper values.
+			CostAware
+		};
+		static void setCacheEvictionPolicy( CacheEvictionPolicy policy );
+		static CacheEvictionPolicy getCacheEvictionPolicy();
+		/// Specifies a directory to be used as a persistent second-level cache
+		/// for the results of computes using `CachePolicy::TaskCollaboration`,
+		/// where `ComputeNode::computeCacheShareable()` allows it. Results are
+		/// written to the directory when they are computed, and are loaded from it
+		/// in preference to computing them again, allowing them to be shared
+		/// between processes. When the entries exceed `sizeLimit` bytes, the least
+		/// recently used are removed. Pass an empty string to disable the disk
+		/// cache (the default).
+		///
+		/// > Caution : Entries are keyed purely by hash, so are not invalidated
+		/// > when the files read by a node are modified in place. The directory
+		/// > must be cleared manually in this case.
+		static void setCacheDirectory( const std::string &directory, size_t sizeLimit );
+		/// Returns the directory used by the disk cache, or an empty string
+		/// if it is disabled.
+		static std::string getCacheDirectory();
+		/// Returns the size limit for the disk cache in bytes, or 0 if it
+		/// is disabled.
+		static size_t getCacheDirectorySizeLimit();
+		/// Specifies a named shared memory segment to be used as a second-level
+		/// cache for the results of computes using `CachePolicy::TaskCollaboration`.
+		/// This allows processes running concurrently on the same host to
+		/// share results without recomputing them. If the segment doesn't exist
+		/// it is created with a size of `memoryLimit` bytes, otherwise the existing
+		/// segment is used at its existing size. When full, the oldest entries are
+		/// overwritten. Pass an empty name to disable the shared cache (the default).
+		///
+		/// > Note : The segment persists after all processes using it have
+		/// > exited, until it is removed with `removeSharedCache()` or the host is
+		/// > restarted. Memory is only committed as the segment is filled.
+		static void setSharedCache( const std::string &name, size_t memoryLimit );
+		/// Returns the name of the shared cache segment, or an empty string
+		/// if it is disabled.
+		static std::string getSharedCacheName();
+		/// Returns the size of the shared cache segment in bytes, or 0 if it
+		/// is disabled.
+		static size_t getSharedCacheMemoryLimit();
+		/// Removes the named shared memory segment from the system. Processes
+		/// already using it are unaffected, but subsequent calls to `setSharedCache()`
+		/// will create a new segment.
+		static void removeSharedCache( const std::string &name );
 		//@}
 
 		/// @name Hash cache management
@@ -160,6 +245,9 @@ class GAFFER_API ValuePlug : public Plug
 		static void setHashCacheSizeLimit( size_t maxEntriesPerThread );
 		/// Returns the total number of entries in both global and per-thread hash caches
 		static size_t hashCacheTotalUsage();
+		/// Returns the total number of entries that have been discarded from
+		/// global and per-thread hash caches to keep them within the size limit.
+		static size_t hashCacheTotalEvictions();
 		/// Clears the hash cache.
 		/// > Note : By default, clearing occurs on a per-thread basis as
 		/// > and when each thread next accesses its cache. Pass `now = true`
@@ -159,6 +159,27 @@ class ComputeNodeWrapper : public DependencyNodeWrapper<WrappedType>
 			return WrappedType::computeCachePolicy( output );
 		}
 
+		bool computeCacheShareable( const Gaffer::ValuePlug *output ) const override
+		{
+			if( this->isSubclassed() )
+			{
+				IECorePython::ScopedGILLock gilLock;
+				try
+				{
+					boost::python::object f = this->methodOverride( "computeCacheShareable" );
+					if( f )
+					{
+						return boost::python::extract<bool>( f( Gaffer::ValuePlugPtr( const_cast<Gaffer::ValuePlug *>( output ) ) ) );
+					}
+				}
+				catch( const boost::python::error_already_set & )
+				{
+					IECorePython::ExceptionAlgo::translatePythonException();
+				}
+			}
+			return WrappedType::computeCacheShareable( output );
+		}
+
 };
 
 } // namespace GafferBindings
@@ -54,6 +54,16 @@ class GAFFERIMAGE_API Blur : public FlatImageProcessor
 
 		GAFFER_NODE_DECLARE_TYPE( GafferImage::Blur, BlurTypeId, FlatImageProcessor );
 
+		enum class Method
+		{
+			// Convolves with an explicit gaussian kernel, with cost
+			// proportional to the radius.
+			Convolution,
+			// Uses a recursive approximation to the gaussian, with cost
+			// independent of the radius.
+			Recursive
+		};
+
 		Gaffer::V2fPlug *radiusPlug();
 		const Gaffer::V2fPlug *radiusPlug() const;
 
@@ -63,6 +73,9 @@ class GAFFERIMAGE_API Blur : public FlatImageProcessor
 		Gaffer::BoolPlug *expandDataWindowPlug();
 		const Gaffer::BoolPlug *expandDataWindowPlug() const;
 
+		Gaffer::IntPlug *methodPlug();
+		const Gaffer::IntPlug *methodPlug() const;
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
 	protected :
@@ -79,12 +92,25 @@ class GAFFERIMAGE_API Blur : public FlatImageProcessor
 		Gaffer::FloatVectorDataPlug *resampledChannelDataPlug();
 		const Gaffer::FloatVectorDataPlug *resampledChannelDataPlug() const;
 
+		// Output plug holding the horizontal pass of the Recursive method. This is
+		// computed for a whole row of tiles at once, with the tile origin x set to 0,
+		// so that the recursion runs across the full width of the image. Stored with
+		// all the values for each x coordinate contiguous.
+		Gaffer::FloatVectorDataPlug *horizontalPassPlug();
+		const Gaffer::FloatVectorDataPlug *horizontalPassPlug() const;
+
+		// Output plug holding the vertical pass of the Recursive method. This is
+		// computed for a whole column of tiles at once, with the tile origin y set to 0.
+		Gaffer::FloatVectorDataPlug *verticalPassPlug();
+		const Gaffer::FloatVectorDataPlug *verticalPassPlug() const;
+
 		// Internal resample node.
 		Resample *resample();
 		const Resample *resample() const;
 
 		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
+		Gaffer::ValuePlug::CachePolicy computeCachePolicy( const Gaffer::ValuePlug *output ) const override;
 
 		void hashDataWindow( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		Imath::Box2i computeDataWindow( const Gaffer::Context *context, const ImagePlug *parent ) const override;
@@ -81,6 +81,12 @@ class GAFFERIMAGE_API ChannelDataProcessor : public ImageProcessor
 		/// @param outData The tile where the result of the operation should be written. It is initialized with the coresponding tile data from inPlug() which should be used as the input data.
 		virtual void processChannelData( const Gaffer::Context *context, const ImagePlug *parent, const std::string &channel, IECore::FloatVectorDataPtr outData ) const = 0;
 
+		/// May be implemented to return true if `processChannelData()` computes each output
+		/// value purely from the corresponding input value. Tiles created by `ImagePlug::uniformTile()`
+		/// are then processed by passing a single value to `processChannelData()`, and the
+		/// result is output as a uniform tile. The default implementation returns false.
+		virtual bool processesUniformTiles() const;
+
 		void hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 
 	private :
@@ -91,6 +91,7 @@ class GAFFERIMAGE_API Clamp : public ChannelDataProcessor
 
 		void hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		void processChannelData( const Gaffer::Context *context, const ImagePlug *parent, const std::string &channelName, IECore::FloatVectorDataPtr outData ) const override;
+		bool processesUniformTiles() const override;
 
 	private :
 
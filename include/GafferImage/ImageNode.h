@@ -130,6 +130,11 @@ class GAFFERIMAGE_API ImageNode : public Gaffer::ComputeNode
 		virtual IECore::ConstStringVectorDataPtr computeChannelNames( const Gaffer::Context *context, const ImagePlug *parent ) const;
 		virtual IECore::ConstFloatVectorDataPtr computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const;
 
+		/// Implemented to return `ImagePlug::channelDataCacheCodec()` for `outPlug()->channelDataPlug()`.
+		const Gaffer::ValuePlug::CacheCodec *computeCacheCodec( const Gaffer::ValuePlug *output ) const override;
+		/// Implemented to allow `outPlug()->channelDataPlug()` to be shared between processes.
+		bool computeCacheShareable( const Gaffer::ValuePlug *output ) const override;
+
 	private :
 
 		static size_t g_firstPlugIndex;
@@ -255,6 +255,18 @@ class GAFFERIMAGE_API ImagePlug : public Gaffer::ValuePlug
 		static const IECore::FloatVectorData *emptyTile();
 		static const IECore::FloatVectorData *blackTile();
 		static const IECore::FloatVectorData *whiteTile();
+		/// Returns a tile in which every pixel has the specified value.
+		/// Tiles are shared between calls where possible, and are recognised
+		/// by `isUniformTile()`, allowing nodes to process them in constant
+		/// time. Nodes which output flat images containing a single value
+		/// should use this in preference to allocating their own tiles.
+		static IECore::ConstFloatVectorDataPtr uniformTile( float value );
+		/// Returns true if `tile` was returned by `uniformTile()`, `blackTile()`
+		/// or `whiteTile()`, filling `value` with the value of its pixels. This is
+		/// a constant time check, so may return false for tiles which just happen
+		/// to contain a single value, and for uniform tiles which are no longer
+		/// being tracked.
+		static bool isUniformTile( const IECore::FloatVectorData *tile, float &value );
 
 		static constexpr int tileSize() { return 1 << tileSizeLog2(); };
 		static constexpr int tilePixels() { return tileSize() * tileSize(); };
@@ -288,6 +300,36 @@ class GAFFERIMAGE_API ImagePlug : public Gaffer::ValuePlug
 
 		static constexpr int tileSizeLog2() { return 7; };
 
+		/// @name Cache compression
+		/// Each tile of channel data occupies 64KB in the compute cache. These
+		/// functions allow tiles to be cached in a compressed form instead,
+		/// increasing the number of tiles that fit within the cache memory limit,
+		/// at the expense of decompressing them each time they are retrieved.
+		////////////////////////////////////////////////////////////////////
+		//@{
+		enum class CacheCompression
+		{
+			/// Tiles are cached uncompressed. This is the default.
+			None,
+			/// Tiles are compressed losslessly.
+			Lossless,
+			/// Tiles for the R, G, B and A channels of each layer are stored as
+			/// half precision floats, except where they contain values outside the
+			/// range of a half. Other channels, such as depth and ID channels, are
+			/// compressed losslessly, as they typically require full precision.
+			Half
+		};
+
+		/// Changing the compression mode clears the compute cache, so that
+		/// tiles cached using the previous mode are not returned.
+		static void setCacheCompression( CacheCompression compression );
+		static CacheCompression getCacheCompression();
+		/// Returns the codec to be used for the `channelData` plug in
+		/// the current context, as determined by `getCacheCompression()`.
+		/// Used by `ImageNode::computeCacheCodec()`.
+		static const Gaffer::ValuePlug::CacheCodec *channelDataCacheCodec();
+		//@}
+
 	private :
 
 		static void compoundObjectToCompoundData( const IECore::CompoundObject *object, IECore::CompoundData *data );
@@ -111,6 +111,15 @@ class GAFFERIMAGE_API ImageWriter : public GafferDispatch::TaskNode
 		static void setDefaultColorSpaceFunction( DefaultColorSpaceFunction f );
 		static DefaultColorSpaceFunction getDefaultColorSpaceFunction();
 
+		/// Limits the memory used by tiles that have been computed but not yet
+		/// written, including the rows of scanlines or tiles buffered by the
+		/// writer itself. This is dominated by deep images with many samples. The
+		/// number of tiles computed in parallel is reduced as necessary to stay
+		/// within the limit. Defaults to 2GB, or the value of the `GAFFERIMAGE_IMAGEWRITER_MEMORY_LIMIT`
+		/// environment variable, in megabytes. A limit of 0 disables the limit.
+		static void setMemoryLimit( size_t bytes );
+		static size_t getMemoryLimit();
+
 	protected :
 
 		IECore::MurmurHash hash( const Gaffer::Context *context ) const override;
@@ -92,6 +92,13 @@ class GAFFERIMAGE_API OpenImageIOReader : public ImageNode
 		static void setOpenFilesLimit( size_t maxOpenFiles );
 		static size_t getOpenFilesLimit();
 
+		/// Tile batches are read ahead in the background, in the direction
+		/// that successive requests are travelling. This limits the memory
+		/// used by batches that have been read but not yet requested. A
+		/// limit of 0 disables read-ahead.
+		static void setReadAheadMemoryLimit( size_t bytes );
+		static size_t getReadAheadMemoryLimit();
+
 		static size_t supportedExtensions( std::vector<std::string> &extensions );
 
 	protected :
@@ -110,6 +110,12 @@ class GAFFERSCENE_API Filter : public Gaffer::ComputeNode
 		/// Results must be a bitwise combination of values from the IECore::PathMatcher::Result
 		/// enumeration.
 		virtual unsigned computeMatch( const ScenePlug *scene, const Gaffer::Context *context ) const;
+		/// May be implemented by derived classes to return a PathMatcher equivalent to calling
+		/// `computeMatch()` for every location in `scene`. This is used by `FilterPlug::pathMatcher()`
+		/// to allow traversals to avoid evaluating the filter per location. Implementations should
+		/// be cheap relative to a traversal, and must return `nullptr` if the result would depend on
+		/// the location being matched. The default implementation returns `nullptr`.
+		virtual IECore::ConstPathMatcherDataPtr pathMatcher( const ScenePlug *scene, const Gaffer::Context *context ) const;
 
 	private :
 
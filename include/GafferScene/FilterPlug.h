@@ -43,6 +43,8 @@
 #include "Gaffer/DependencyNode.h"
 #include "Gaffer/NumericPlug.h"
 
+#include "IECore/PathMatcherData.h"
+
 namespace GafferScene
 {
 
@@ -91,6 +93,14 @@ class GAFFERSCENE_API FilterPlug : public Gaffer::IntPlug
 		/// singular calls to getValue(), as it ensures a suitable SceneScope before evaluating the filter.
 		unsigned match( const ScenePlug *scene ) const;
 
+		/// Returns a PathMatcher equivalent to calling `match()` at every location in
+		/// `scene`, if the source filter is able to provide one. This allows traversals
+		/// to test locations directly, and to skip any children that cannot match without
+		/// visiting them. Returns `nullptr` if no such PathMatcher is available, or if the
+		/// filter's `enabled` plug has an input, in which case `match()` must be used for
+		/// each location instead.
+		IECore::ConstPathMatcherDataPtr pathMatcher( const ScenePlug *scene ) const;
+
 		/// Name of a context variable used to provide the input
 		/// scene to the filter
 		static const IECore::InternedString inputSceneContextName;
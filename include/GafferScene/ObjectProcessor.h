@@ -86,6 +86,8 @@ class GAFFERSCENE_API ObjectProcessor : public FilteredSceneProcessor
 		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
 		Gaffer::ValuePlug::CachePolicy computeCachePolicy( const Gaffer::ValuePlug *output ) const override;
+		/// Implemented to allow processed objects to be shared between processes.
+		bool computeCacheShareable( const Gaffer::ValuePlug *output ) const override;
 
 	private :
 
@@ -74,6 +74,8 @@ class ChildNamesMap : public IECore::Data
 		/// Returns the input which is mapped to `outputName`.
 		const Input &input( IECore::InternedString outputName ) const;
 		/// Combines multiple input sets, accounting for the name remapping.
+		/// Large numbers of sets are combined in parallel, so this should only
+		/// be called from processes using a task-aware cache policy.
 		IECore::PathMatcher set( const std::vector<IECore::ConstPathMatcherDataPtr> &inputSets ) const;
 
 		static IECore::InternedString uniqueName( IECore::InternedString name, const std::unordered_set<IECore::InternedString> &existingNames );
@@ -133,6 +133,8 @@ template <class ThreadableFunctor>
 void parallelTraverse( const ScenePlug *scene, ThreadableFunctor &f, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
 
 /// As for `parallelTraverse()`, but only calling the functor for locations matched by the filter.
+/// Where possible, the filter is converted to a PathMatcher using `FilterPlug::pathMatcher()`, so that
+/// locations which cannot match are pruned without being visited.
 template <class ThreadableFunctor>
 void filteredParallelTraverse( const ScenePlug *scene, const FilterPlug *filterPlug, ThreadableFunctor &f, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
 /// As above, but using a PathMatcher as a filter.
@@ -42,6 +42,7 @@
 #include "tbb/parallel_reduce.h"
 #include "tbb/task_arena.h"
 
+#include <utility>
 #include <variant>
 
 namespace GafferScene
@@ -50,10 +51,27 @@ namespace GafferScene
 namespace Detail
 {
 
+// Sets the path for a location visited by one of the walks below. Children
+// are visited using the ThreadState from the parent's PathScope, so that the
+// hash of each path can be derived from the hash of its parent rather than
+// computed from every element.
+inline void setWalkPath( ScenePlug::PathScope &pathScope, const ScenePlug::ScenePath &path, bool fromParent )
+{
+	if( fromParent )
+	{
+		pathScope.setChildPath( &path );
+	}
+	else
+	{
+		pathScope.setPath( &path );
+	}
+}
+
 template<typename ThreadableFunctor>
-void parallelProcessLocationsWalk( const GafferScene::ScenePlug *scene, const Gaffer::ThreadState &threadState, const ScenePlug::ScenePath &path, ThreadableFunctor &f, tbb::task_group_context &taskGroupContext )
+void parallelProcessLocationsWalk( const GafferScene::ScenePlug *scene, const Gaffer::ThreadState &threadState, const ScenePlug::ScenePath &path, bool fromParent, ThreadableFunctor &f, tbb::task_group_context &taskGroupContext )
 {
-	ScenePlug::PathScope pathScope( threadState, &path );
+	ScenePlug::PathScope pathScope( threadState );
+	setWalkPath( pathScope, path, fromParent );
 
 	if( !f( scene, path ) )
 	{
@@ -70,6 +88,7 @@ void parallelProcessLocationsWalk( const GafferScene::ScenePlug *scene, const Ga
 	using ChildNameRange = tbb::blocked_range<std::vector<IECore::InternedString>::const_iterator>;
 	const ChildNameRange loopRange( childNames.begin(), childNames.end() );
 
+	const Gaffer::ThreadState &childThreadState = Gaffer::ThreadState::current();
 	auto loopBody = [&] ( const ChildNameRange &range ) {
 		ScenePlug::ScenePath childPath = path;
 		childPath.push_back( IECore::InternedString() ); // Space for the child name
@@ -77,7 +96,7 @@ void parallelProcessLocationsWalk( const GafferScene::ScenePlug *scene, const Ga
 		{
 			ThreadableFunctor childFunctor( f );
 			childPath.back() = childName;
-			parallelProcessLocationsWalk( scene, threadState, childPath, childFunctor, taskGroupContext );
+			parallelProcessLocationsWalk( scene, childThreadState, childPath, /* fromParent = */ true, childFunctor, taskGroupContext );
 		}
 	};
 
@@ -117,35 +136,74 @@ struct ThreadableFilteredFunctor
 
 };
 
-template<class ThreadableFunctor>
-struct PathMatcherFunctor
+template<typename ThreadableFunctor>
+void pathMatcherTraverseWalk( const GafferScene::ScenePlug *scene, const Gaffer::ThreadState &threadState, const ScenePlug::ScenePath &path, bool fromParent, unsigned match, const IECore::PathMatcher &filter, ThreadableFunctor &f, tbb::task_group_context &taskGroupContext )
 {
+	ScenePlug::PathScope pathScope( threadState );
+	setWalkPath( pathScope, path, fromParent );
 
-	PathMatcherFunctor( ThreadableFunctor &f, const IECore::PathMatcher &filter )
-		: m_f( f ), m_filter( filter )
+	if( match & IECore::PathMatcher::ExactMatch )
 	{
+		if( !f( scene, path ) )
+		{
+			return;
+		}
 	}
 
-	bool operator()( const GafferScene::ScenePlug *scene, const GafferScene::ScenePlug::ScenePath &path )
+	if( !( match & IECore::PathMatcher::DescendantMatch ) )
 	{
-		const unsigned match = m_filter.match( path );
-		if( match & IECore::PathMatcher::ExactMatch )
+		return;
+	}
+
+	IECore::ConstInternedStringVectorDataPtr childNamesData = scene->childNamesPlug()->getValue();
+	const std::vector<IECore::InternedString> &childNames = childNamesData->readable();
+
+	// Match the children up front, so that we don't spawn tasks or
+	// create contexts for children that can't possibly match.
+
+	ScenePlug::ScenePath candidatePath = path;
+	candidatePath.push_back( IECore::InternedString() ); // Space for the child name
+
+	std::vector<std::pair<IECore::InternedString, unsigned>> matchingChildren;
+	for( const auto &childName : childNames )
+	{
+		candidatePath.back() = childName;
+		const unsigned childMatch = filter.match( candidatePath );
+		if( childMatch & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::DescendantMatch ) )
 		{
-			if( !m_f( scene, path ) )
-			{
-				return false;
-			}
+			matchingChildren.push_back( { childName, childMatch } );
 		}
+	}
 
-		return match & IECore::PathMatcher::DescendantMatch;
+	if( matchingChildren.empty() )
+	{
+		return;
 	}
 
-	private :
+	using ChildRange = tbb::blocked_range<size_t>;
+	const ChildRange loopRange( 0, matchingChildren.size() );
 
-		ThreadableFunctor &m_f;
-		const IECore::PathMatcher &m_filter;
+	const Gaffer::ThreadState &childThreadState = Gaffer::ThreadState::current();
+	auto loopBody = [&] ( const ChildRange &range ) {
+		ScenePlug::ScenePath childPath = path;
+		childPath.push_back( IECore::InternedString() ); // Space for the child name
+		for( size_t i = range.begin(); i != range.end(); ++i )
+		{
+			childPath.back() = matchingChildren[i].first;
+			pathMatcherTraverseWalk( scene, childThreadState, childPath, /* fromParent = */ true, matchingChildren[i].second, filter, f, taskGroupContext );
+		}
+	};
 
-};
+	if( matchingChildren.size() > 1 )
+	{
+		tbb::parallel_for( loopRange, loopBody, taskGroupContext );
+	}
+	else
+	{
+		// Serial execution
+		loopBody( loopRange );
+	}
+}
 
 } // namespace Detail
 
@@ -156,7 +214,7 @@ template <class ThreadableFunctor>
 void parallelProcessLocations( const GafferScene::ScenePlug *scene, ThreadableFunctor &f, const ScenePlug::ScenePath &root )
 {
 	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated ); // Prevents outer tasks silently cancelling our tasks
-	Detail::parallelProcessLocationsWalk( scene, Gaffer::ThreadState::current(), root, f, taskGroupContext );
+	Detail::parallelProcessLocationsWalk( scene, Gaffer::ThreadState::current(), root, /* fromParent = */ false, f, taskGroupContext );
 }
 
 template <class ThreadableFunctor>
@@ -174,6 +232,15 @@ void parallelTraverse( const ScenePlug *scene, ThreadableFunctor &f, const Scene
 template <class ThreadableFunctor>
 void filteredParallelTraverse( const ScenePlug *scene, const GafferScene::FilterPlug *filterPlug, ThreadableFunctor &f, const ScenePlug::ScenePath &root )
 {
+	if( IECore::ConstPathMatcherDataPtr pathMatcher = filterPlug->pathMatcher( scene ) )
+	{
+		// The filter can be represented by a PathMatcher, so we can avoid
+		// evaluating it at every location, and prune non-matching children
+		// before visiting them.
+		filteredParallelTraverse( scene, pathMatcher->readable(), f, root );
+		return;
+	}
+
 	Detail::ThreadableFilteredFunctor<ThreadableFunctor> ff( f, filterPlug );
 	parallelTraverse( scene, ff, root );
 }
@@ -181,8 +248,8 @@ void filteredParallelTraverse( const ScenePlug *scene, const GafferScene::Filter
 template <class ThreadableFunctor>
 void filteredParallelTraverse( const ScenePlug *scene, const IECore::PathMatcher &filter, ThreadableFunctor &f, const ScenePlug::ScenePath &root )
 {
-	Detail::PathMatcherFunctor<ThreadableFunctor> ff( f, filter );
-	parallelTraverse( scene, ff, root );
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated ); // Prevents outer tasks silently cancelling our tasks
+	Detail::pathMatcherTraverseWalk( scene, Gaffer::ThreadState::current(), root, /* fromParent = */ false, filter.match( root ), filter, f, taskGroupContext );
 }
 
 
@@ -293,13 +360,14 @@ namespace Detail
 
 template <typename T, typename LocationFunctor, typename MergeChildrenFunctor, typename ReduceFunctor>
 T parallelReduceLocationsWalk(
-	const GafferScene::ScenePlug *scene, const Gaffer::ThreadState &threadState, const ScenePlug::ScenePath &path,
+	const GafferScene::ScenePlug *scene, const Gaffer::ThreadState &threadState, const ScenePlug::ScenePath &path, bool fromParent,
 	const T& identity,
 	LocationFunctor &&locationFunctor, MergeChildrenFunctor &&mergeChildrenFunctor, ReduceFunctor &&reduceFunctor,
 	tbb::task_group_context &taskGroupContext
 )
 {
-	ScenePlug::PathScope pathScope( threadState, &path );
+	ScenePlug::PathScope pathScope( threadState );
+	setWalkPath( pathScope, path, fromParent );
 
 	T result = locationFunctor( scene, path );
 
@@ -378,7 +446,7 @@ T parallelReduceLocationsWalk(
 				m_reduceFunctor(
 					m_result,
 					parallelReduceLocationsWalk(
-						m_scene, m_threadState, childPath,
+						m_scene, m_threadState, childPath, /* fromParent = */ true,
 						m_identity, m_locationFunctor, m_mergeChildrenFunctor, m_reduceFunctor,
 						m_taskGroupContext
 					)
@@ -393,7 +461,7 @@ T parallelReduceLocationsWalk(
 	};
 
 	LoopBody loopBody(
-		scene, threadState, path,
+		scene, Gaffer::ThreadState::current(), path,
 		identity,
 		locationFunctor, mergeChildrenFunctor, reduceFunctor,
 		taskGroupContext
@@ -441,7 +509,7 @@ T parallelReduceLocations(
 	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
 
 	return Detail::parallelReduceLocationsWalk(
-		scene, Gaffer::ThreadState::current(), root, identity,
+		scene, Gaffer::ThreadState::current(), root, /* fromParent = */ false, identity,
 		locationFunctor, mergeChildrenFunctor, reduceFunctor,
 		taskGroupContext
 	);
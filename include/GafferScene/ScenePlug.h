@@ -167,6 +167,10 @@ class GAFFERSCENE_API ScenePlug : public Gaffer::ValuePlug
 			PathScope( const Gaffer::ThreadState &threadState, const ScenePath *scenePath );
 
 			void setPath( const ScenePath *scenePath );
+			/// Faster form of `setPath()` for use when the scope was constructed
+			/// from the context for the parent of `scenePath`. See
+			/// `Context::EditableScope::setChildPath()` for details.
+			void setChildPath( const ScenePath *scenePath );
 		};
 
 		/// Utility class to scope a temporary copy of a context,
@@ -73,6 +73,7 @@ class GAFFERSCENE_API SetFilter : public Filter
 
 		void hashMatch( const ScenePlug *scene, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		unsigned computeMatch( const ScenePlug *scene, const Gaffer::Context *context ) const override;
+		IECore::ConstPathMatcherDataPtr pathMatcher( const ScenePlug *scene, const Gaffer::Context *context ) const override;
 
 	private :
 
@@ -187,8 +187,11 @@ GAFFERTEST_API void testScopingNullContext();
 GAFFERTEST_API void testEditableScope();
 GAFFERTEST_API std::tuple<int,int,int,int> countContextHash32Collisions( int contexts, int mode, int seed );
 GAFFERTEST_API void testContextHashPerformance( int numEntries, int entrySize, bool startInitialized );
+GAFFERTEST_API void testContextHashDeepTraversalPerformance( int numEntries, int depth, int branchingFactor );
 GAFFERTEST_API void testContextCopyPerformance( int numEntries, int entrySize );
 GAFFERTEST_API void testCopyEditableScope();
 GAFFERTEST_API void testContextHashValidation();
+GAFFERTEST_API void testEditableScopeSetChildPath();
+GAFFERTEST_API void testEditableScopeSetChildPathPerformance( int numEntries, int depth, int branchingFactor );
 
 } // namespace GafferTest
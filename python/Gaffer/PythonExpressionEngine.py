@@ -64,6 +64,11 @@ class PythonExpressionEngine( Gaffer.Expression.Engine ) :
 		outPlugs.extend( [ self.__plug( node, p ) for p in self.__outPlugPaths ] )
 		contextNames.extend( parser.contextReads )
 
+		# Expressions using only the subset of Python supported by the native
+		# expression language are executed natively, without needing the GIL.
+		# Anything else falls back to being executed by Python.
+		self._setNativeExpression( Gaffer.NativeExpressionEngine.convertPythonExpression( expression ) )
+
 	def execute( self, context, inputs ) :
 
 		plugDict = {}
@@ -41,6 +41,7 @@ import pathlib
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferImage
 import GafferImageTest
 import os
@@ -198,5 +199,104 @@ class BlurTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertImagesEqual( finalCrop["out"], expectedReader["out"], maxDifference = 0.00001, ignoreMetadata = True )
 
+	def testRecursiveMethod( self ) :
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 500, 300 ) )
+		checkerboard["colorA"].setValue( imath.Color4f( 0 ) )
+		checkerboard["colorB"].setValue( imath.Color4f( 1 ) )
+
+		blur = GafferImage.Blur()
+		blur["in"].setInput( checkerboard["out"] )
+		blur["expandDataWindow"].setValue( True )
+
+		recursiveBlur = GafferImage.Blur()
+		recursiveBlur["in"].setInput( checkerboard["out"] )
+		recursiveBlur["expandDataWindow"].setValue( True )
+		recursiveBlur["method"].setValue( GafferImage.Blur.Method.Recursive )
+
+		for radius in [ imath.V2f( 0, 5 ), imath.V2f( 20 ), imath.V2f( 40, 10 ) ] :
+			for boundingMode in [ GafferImage.Sampler.BoundingMode.Black, GafferImage.Sampler.BoundingMode.Clamp ] :
+				with self.subTest( radius = radius, boundingMode = boundingMode ) :
+
+					blur["radius"].setValue( radius )
+					blur["boundingMode"].setValue( boundingMode )
+					recursiveBlur["radius"].setValue( radius )
+					recursiveBlur["boundingMode"].setValue( boundingMode )
+
+					# The recursive method is an approximation to the gaussian, so
+					# we only expect a close match.
+					self.assertImagesEqual( recursiveBlur["out"], blur["out"], maxDifference = 0.04 )
+
+	def testRecursiveMethodTileIndependence( self ) :
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 500, 300 ) )
+		checkerboard["size"].setValue( imath.V2f( 17 ) )
+
+		blur = GafferImage.Blur()
+		blur["in"].setInput( checkerboard["out"] )
+		blur["radius"].setValue( imath.V2f( 30, 12 ) )
+		blur["method"].setValue( GafferImage.Blur.Method.Recursive )
+		blur["expandDataWindow"].setValue( True )
+
+		# Shift the image relative to the tile grid, and check the result
+		# doesn't depend on the tile layout.
+
+		offset = GafferImage.Offset()
+		offset["in"].setInput( checkerboard["out"] )
+		offset["offset"].setValue( imath.V2i( 37, -201 ) )
+
+		offsetBlur = GafferImage.Blur()
+		offsetBlur["in"].setInput( offset["out"] )
+		offsetBlur["radius"].setInput( blur["radius"] )
+		offsetBlur["method"].setInput( blur["method"] )
+		offsetBlur["expandDataWindow"].setInput( blur["expandDataWindow"] )
+
+		reverseOffset = GafferImage.Offset()
+		reverseOffset["in"].setInput( offsetBlur["out"] )
+		reverseOffset["offset"].setValue( imath.V2i( -37, 201 ) )
+
+		self.assertImagesEqual( reverseOffset["out"], blur["out"], maxDifference = 0.00001 )
+
+	def testRecursiveMethodEnergyPreservation( self ) :
+
+		constant = GafferImage.Constant()
+		constant["color"].setValue( imath.Color4f( 1 ) )
+
+		crop = GafferImage.Crop()
+		crop["in"].setInput( constant["out"] )
+		crop["area"].setValue( imath.Box2i( imath.V2i( 100 ), imath.V2i( 101 ) ) )
+		crop["affectDisplayWindow"].setValue( False )
+
+		blur = GafferImage.Blur()
+		blur["in"].setInput( crop["out"] )
+		blur["expandDataWindow"].setValue( True )
+		blur["method"].setValue( GafferImage.Blur.Method.Recursive )
+
+		stats = GafferImage.ImageStats()
+		stats["in"].setInput( blur["out"] )
+		stats["area"].setValue( imath.Box2i( imath.V2i( 50 ), imath.V2i( 150 ) ) )
+
+		for radius in [ 1, 5, 10 ] :
+			blur["radius"].setValue( imath.V2f( radius ) )
+			self.assertAlmostEqual( stats["average"]["r"].getValue(), 1 / 10000., delta = 0.000005 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testRecursiveMethodPerf( self ) :
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 3840, 2160 ) )
+
+		GafferImageTest.processTiles( checkerboard["out"] )
+
+		blur = GafferImage.Blur()
+		blur["in"].setInput( checkerboard["out"] )
+		blur["radius"].setValue( imath.V2f( 200 ) )
+		blur["method"].setValue( GafferImage.Blur.Method.Recursive )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( blur["out"] )
+
 if __name__ == "__main__":
 	unittest.main()
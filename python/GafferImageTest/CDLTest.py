@@ -218,5 +218,118 @@ class CDLTest( GafferImageTest.ImageTestCase ) :
 		self.assertEqual( mainCDLSampler["color"].getValue(), main["color"].getValue() )
 		self.assertNotEqual( diffuseCDLSampler["color"].getValue(), diffuse["color"].getValue() )
 
+	def testChainedColorProcessors( self ) :
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "circles.exr" )
+
+		# Directly connected ColorProcessors are processed as a single chain.
+
+		saturation = GafferImage.Saturation()
+		saturation["in"].setInput( reader["out"] )
+		saturation["saturation"].setValue( 0.5 )
+
+		cdl = GafferImage.CDL()
+		cdl["in"].setInput( saturation["out"] )
+		cdl["slope"].setValue( imath.Color3f( 1.5, 0.5, 1 ) )
+
+		saturation2 = GafferImage.Saturation()
+		saturation2["in"].setInput( cdl["out"] )
+		saturation2["saturation"].setValue( 2 )
+
+		# Dots break the chain, so the reference nodes are processed
+		# one at a time.
+
+		def dot( input ) :
+			d = Gaffer.Dot()
+			d.setup( input )
+			d["in"].setInput( input )
+			return d
+
+		referenceSaturation = GafferImage.Saturation()
+		referenceSaturation["in"].setInput( reader["out"] )
+		referenceSaturation["saturation"].setInput( saturation["saturation"] )
+
+		referenceDot = dot( referenceSaturation["out"] )
+		referenceCDL = GafferImage.CDL()
+		referenceCDL["in"].setInput( referenceDot["out"] )
+		referenceCDL["slope"].setInput( cdl["slope"] )
+
+		referenceDot2 = dot( referenceCDL["out"] )
+		referenceSaturation2 = GafferImage.Saturation()
+		referenceSaturation2["in"].setInput( referenceDot2["out"] )
+		referenceSaturation2["saturation"].setInput( saturation2["saturation"] )
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			self.assertImagesEqual( saturation2["out"], referenceSaturation2["out"] )
+
+		self.assertEqual( monitor.plugStatistics( saturation["__colorData"] ).computeCount, 0 )
+		self.assertEqual( monitor.plugStatistics( cdl["__colorData"] ).computeCount, 0 )
+		self.assertGreater( monitor.plugStatistics( referenceSaturation["__colorData"] ).computeCount, 0 )
+
+		# Results must match when individual nodes are configured to pass
+		# through some or all channels.
+
+		for node, referenceNode in [
+			( saturation, referenceSaturation ),
+			( cdl, referenceCDL ),
+			( saturation2, referenceSaturation2 ),
+		] :
+
+			for plugName, value in [
+				( "channels", "[RB]" ),
+				( "processUnpremultiplied", True ),
+				( "enabled", False ),
+			] :
+				node[plugName].setValue( value )
+				referenceNode[plugName].setValue( value )
+				self.assertImagesEqual( saturation2["out"], referenceSaturation2["out"] )
+
+			for plugName in [ "channels", "processUnpremultiplied", "enabled" ] :
+				node[plugName].setToDefault()
+				referenceNode[plugName].setToDefault()
+
+	def testEditLastNodeOfChain( self ) :
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "circles.exr" )
+
+		saturation = GafferImage.Saturation()
+		saturation["in"].setInput( reader["out"] )
+		saturation["saturation"].setValue( 0.5 )
+
+		cdl = GafferImage.CDL()
+		cdl["in"].setInput( saturation["out"] )
+		cdl["slope"].setValue( imath.Color3f( 1.5, 0.5, 1 ) )
+
+		# Reference processed without chaining, by inserting a Dot.
+
+		dot = Gaffer.Dot()
+		dot.setup( saturation["out"] )
+		dot["in"].setInput( saturation["out"] )
+
+		referenceCDL = GafferImage.CDL()
+		referenceCDL["in"].setInput( dot["out"] )
+		referenceCDL["slope"].setInput( cdl["slope"] )
+
+		GafferImageTest.processTiles( cdl["out"] )
+
+		# Editing the last node reprocesses the whole chain, since there are
+		# no intermediate results to reuse. But the upstream processor and the
+		# input tiles are still reused from the cache.
+
+		cdl["slope"].setValue( imath.Color3f( 0.5, 1.5, 1 ) )
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			GafferImageTest.processTiles( cdl["out"] )
+
+		self.assertGreater( monitor.plugStatistics( cdl["__colorData"] ).computeCount, 0 )
+		self.assertEqual( monitor.plugStatistics( cdl["__colorProcessor"] ).computeCount, 1 )
+		self.assertEqual( monitor.plugStatistics( saturation["__colorData"] ).computeCount, 0 )
+		self.assertEqual( monitor.plugStatistics( saturation["__colorProcessor"] ).computeCount, 0 )
+		self.assertEqual( monitor.plugStatistics( reader["out"]["channelData"].source() ).computeCount, 0 )
+
+		self.assertImagesEqual( cdl["out"], referenceCDL["out"] )
+
 if __name__ == "__main__":
 	unittest.main()
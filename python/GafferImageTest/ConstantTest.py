@@ -125,6 +125,20 @@ class ConstantTest( GafferImageTest.ImageTestCase ) :
 			)
 		)
 
+	def testUniformTiles( self ) :
+
+		c = GafferImage.Constant()
+		c["color"].setValue( imath.Color4f( 0.25, 0, 1, 0.5 ) )
+
+		for channelName in [ "R", "G", "B", "A" ] :
+			self.assertTrue(
+				GafferImage.ImagePlug.isUniformTile( c["out"].channelData( channelName, imath.V2i( 0 ), _copy = False ) )
+			)
+
+		self.assertTrue(
+			c["out"].channelData( "G", imath.V2i( 0 ), _copy = False ).isSame( GafferImage.ImagePlug.blackTile( _copy = False ) )
+		)
+
 	def testEnableBehaviour( self ) :
 
 		c = GafferImage.Constant()
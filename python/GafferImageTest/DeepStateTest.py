@@ -1027,5 +1027,68 @@ class DeepStateTest( GafferImageTest.ImageTestCase ) :
 
 		self.__assertDeepStateProcessing( deleteChannels["out"], referenceFlatten["out"], [ 0, 0, 0, 10 ], [ 0, 0, 0, 10 ], 100, 0.45 )
 
+	def __mergedCopies( self, numCopies ) :
+
+		# Merges copies of the representative image at various depths, so that we
+		# get many unsorted samples per pixel, including samples with identical depths.
+		representativeImage = GafferImage.ImageReader()
+		representativeImage["fileName"].setValue( self.representativeImagePath )
+
+		deepMerge = GafferImage.DeepMerge()
+		nodes = [ representativeImage, deepMerge ]
+		for i in range( 0, numCopies ) :
+			depthGrade = self.__createDepthGrade()
+			depthGrade["in"].setInput( representativeImage["out"] )
+			depthGrade["depthOffset"].setValue( ( i % 4 ) * 0.25 )
+			deepMerge["in"][-1].setInput( depthGrade["out"] )
+			nodes.append( depthGrade )
+
+		return deepMerge, nodes
+
+	def testSortManySamples( self ) :
+
+		deepMerge, nodes = self.__mergedCopies( 12 )
+
+		deepState = GafferImage.DeepState()
+		deepState["in"].setInput( deepMerge["out"] )
+		deepState["deepState"].setValue( GafferImage.DeepState.TargetState.Sorted )
+
+		channelNames = deepMerge["out"].channelNames()
+		for tileOrigin in [ imath.V2i( 0, 0 ), imath.V2i( 64, 64 ), imath.V2i( 128, 64 ) ] :
+
+			sampleOffsets = deepMerge["out"].sampleOffsets( tileOrigin )
+			self.assertEqual( deepState["out"].sampleOffsets( tileOrigin ), sampleOffsets )
+
+			z = deepMerge["out"].channelData( "Z", tileOrigin )
+			zBack = deepMerge["out"].channelData( "ZBack", tileOrigin )
+
+			# Sort in Python, preserving the original order of identical samples.
+			sorting = []
+			prevOffset = 0
+			for offset in sampleOffsets :
+				sorting.extend( sorted( range( prevOffset, offset ), key = lambda i : ( z[i], zBack[i], i ) ) )
+				prevOffset = offset
+
+			for channelName in channelNames :
+				inData = deepMerge["out"].channelData( channelName, tileOrigin )
+				self.assertEqual(
+					deepState["out"].channelData( channelName, tileOrigin ),
+					IECore.FloatVectorData( [ inData[i] for i in sorting ] )
+				)
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testSortPerformance( self ) :
+
+		deepMerge, nodes = self.__mergedCopies( 30 )
+
+		deepState = GafferImage.DeepState()
+		deepState["in"].setInput( deepMerge["out"] )
+		deepState["deepState"].setValue( GafferImage.DeepState.TargetState.Sorted )
+
+		GafferImageTest.processTiles( deepMerge["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( deepState["out"] )
+
 if __name__ == "__main__":
 	unittest.main()
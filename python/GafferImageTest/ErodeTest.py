@@ -353,5 +353,20 @@ class ErodeTest( GafferImageTest.ImageTestCase ) :
 		with GafferTest.TestRunner.PerformanceScope() :
 			GafferImageTest.processTiles( erode["out"] )
 
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testMediumRadiusPerf( self ) :
+
+		imageReader = GafferImage.ImageReader()
+		imageReader["fileName"].setValue( self.imagesPath() / 'deepMergeReference.exr' )
+
+		GafferImageTest.processTiles( imageReader["out"] )
+
+		erode = GafferImage.Erode()
+		erode["in"].setInput( imageReader["out"] )
+		erode["radius"].setValue( imath.V2i( 24 ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( erode["out"] )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -306,3 +306,38 @@ class GradeTest( GafferImageTest.ImageTestCase ) :
 		defaultGrade["gamma"].setValue( imath.Color4f( 2, 2, 2, 1.0 ) )
 
 		self.assertImagesEqual( unpremultipliedGrade["out"], defaultGrade["out"] )
+
+	def testUniformTiles( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 512, 512 ) )
+		constant["color"].setValue( imath.Color4f( 0.25, 0.5, 0.75, 0.5 ) )
+
+		# Offsetting produces tiles with the same values, but which
+		# aren't recognised as uniform, so are processed pixel by pixel.
+		offset = GafferImage.Offset()
+		offset["in"].setInput( constant["out"] )
+		offset["offset"].setValue( imath.V2i( 1 ) )
+
+		grade = GafferImage.Grade()
+		grade["in"].setInput( constant["out"] )
+
+		referenceGrade = GafferImage.Grade()
+		referenceGrade["in"].setInput( offset["out"] )
+
+		for g in ( grade, referenceGrade ) :
+			g["channels"].setValue( "[RGBA]" )
+			g["multiply"].setValue( imath.Color4f( 2, 1, 0.5, 0.5 ) )
+			g["offset"].setValue( imath.Color4f( 0.1, 0, 0, 0 ) )
+			g["gamma"].setValue( imath.Color4f( 2, 1, 1, 1 ) )
+
+		tileOrigin = imath.V2i( GafferImage.ImagePlug.tileSize() )
+		for processUnpremultiplied in ( False, True ) :
+
+			grade["processUnpremultiplied"].setValue( processUnpremultiplied )
+			referenceGrade["processUnpremultiplied"].setValue( processUnpremultiplied )
+
+			for channelName in [ "R", "G", "B", "A" ] :
+				tile = grade["out"].channelData( channelName, tileOrigin, _copy = False )
+				self.assertTrue( GafferImage.ImagePlug.isUniformTile( tile ) )
+				self.assertEqual( tile, referenceGrade["out"].channelData( channelName, tileOrigin ) )
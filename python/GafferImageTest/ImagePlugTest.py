@@ -297,6 +297,138 @@ class ImagePlugTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertTrue( tileDataNoCopyA.isSame( tileDataNoCopyB ) )
 
+	def testUniformTile( self ) :
+
+		self.assertTrue(
+			GafferImage.ImagePlug.uniformTile( 0, _copy = False ).isSame( GafferImage.ImagePlug.blackTile( _copy = False ) )
+		)
+		self.assertTrue(
+			GafferImage.ImagePlug.uniformTile( 1, _copy = False ).isSame( GafferImage.ImagePlug.whiteTile( _copy = False ) )
+		)
+
+		tile = GafferImage.ImagePlug.uniformTile( 0.5, _copy = False )
+		self.__testTileData( tile, GafferImage.ImagePlug.tilePixels(), value = 0.5 )
+		self.assertTrue( tile.isSame( GafferImage.ImagePlug.uniformTile( 0.5, _copy = False ) ) )
+
+		self.assertTrue( GafferImage.ImagePlug.isUniformTile( tile ) )
+		self.assertTrue( GafferImage.ImagePlug.isUniformTile( GafferImage.ImagePlug.blackTile( _copy = False ) ) )
+		self.assertTrue( GafferImage.ImagePlug.isUniformTile( GafferImage.ImagePlug.whiteTile( _copy = False ) ) )
+		# Only tiles created by `uniformTile()` are recognised.
+		self.assertFalse( GafferImage.ImagePlug.isUniformTile( GafferImage.ImagePlug.uniformTile( 0.5 ) ) )
+		self.assertFalse( GafferImage.ImagePlug.isUniformTile( GafferImage.ImagePlug.emptyTile( _copy = False ) ) )
+
+	def testCacheCompression( self ) :
+
+		ramp = GafferImage.Ramp()
+		ramp["format"].setValue( GafferImage.Format( 512, 512 ) )
+		ramp["endPosition"].setValue( imath.V2f( 512, 512 ) )
+
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( ramp["out"] )
+		shuffle["shuffles"].addChild( Gaffer.ShufflePlug( "R", "Z" ) )
+
+		# Generic ContextProcessors share hashes with their input, so
+		# must be able to decode values cached by the upstream node.
+		timeWarp = Gaffer.TimeWarp()
+		timeWarp.setup( GafferImage.ImagePlug() )
+		timeWarp["in"].setInput( shuffle["out"] )
+
+		def imageAndCacheUsage( compression ) :
+
+			Gaffer.ValuePlug.clearCache()
+			GafferImage.ImagePlug.setCacheCompression( compression )
+			image = GafferImage.ImageAlgo.image( shuffle["out"] )
+			self.assertEqual( GafferImage.ImageAlgo.image( timeWarp["out"] ), image )
+			return image, Gaffer.ValuePlug.cacheMemoryUsage()
+
+		self.assertEqual( GafferImage.ImagePlug.getCacheCompression(), GafferImage.ImagePlug.CacheCompression.None_ )
+		self.addCleanup( GafferImage.ImagePlug.setCacheCompression, GafferImage.ImagePlug.CacheCompression.None_ )
+
+		uncompressedImage, uncompressedUsage = imageAndCacheUsage( GafferImage.ImagePlug.CacheCompression.None_ )
+
+		losslessImage, losslessUsage = imageAndCacheUsage( GafferImage.ImagePlug.CacheCompression.Lossless )
+		self.assertEqual( losslessImage, uncompressedImage )
+		self.assertLess( losslessUsage, uncompressedUsage )
+
+		halfImage, halfUsage = imageAndCacheUsage( GafferImage.ImagePlug.CacheCompression.Half )
+		self.assertLess( halfUsage, uncompressedUsage )
+		for channelName in [ "R", "G", "B", "A" ] :
+			for a, b in zip( halfImage[channelName], uncompressedImage[channelName] ) :
+				self.assertAlmostEqual( a, b, delta = 0.001 )
+		# Non-colour channels are never stored at reduced precision.
+		self.assertEqual( halfImage["Z"], uncompressedImage["Z"] )
+
+		# Values computed on a cache miss must match those retrieved
+		# from the cache on a subsequent hit.
+		self.assertEqual( GafferImage.ImageAlgo.image( shuffle["out"] ), halfImage )
+
+	def testCacheCompressionChange( self ) :
+
+		ramp = GafferImage.Ramp()
+		ramp["format"].setValue( GafferImage.Format( 512, 512 ) )
+		ramp["endPosition"].setValue( imath.V2f( 512, 512 ) )
+
+		self.addCleanup( GafferImage.ImagePlug.setCacheCompression, GafferImage.ImagePlug.CacheCompression.None_ )
+
+		Gaffer.ValuePlug.clearCache()
+		uncompressedImage = GafferImage.ImageAlgo.image( ramp["out"] )
+
+		# Lossy tiles cached in `Half` mode must not be returned after
+		# switching to a lossless mode.
+
+		GafferImage.ImagePlug.setCacheCompression( GafferImage.ImagePlug.CacheCompression.Half )
+		self.assertNotEqual( GafferImage.ImageAlgo.image( ramp["out"] ), uncompressedImage )
+
+		for compression in [ GafferImage.ImagePlug.CacheCompression.None_, GafferImage.ImagePlug.CacheCompression.Lossless ] :
+			GafferImage.ImagePlug.setCacheCompression( GafferImage.ImagePlug.CacheCompression.Half )
+			GafferImage.ImageAlgo.image( ramp["out"] )
+			GafferImage.ImagePlug.setCacheCompression( compression )
+			self.assertEqual( GafferImage.ImageAlgo.image( ramp["out"] ), uncompressedImage )
+
+	def testCacheCompressionHits( self ) :
+
+		ramp = GafferImage.Ramp()
+		ramp["format"].setValue( GafferImage.Format( 512, 512 ) )
+		ramp["endPosition"].setValue( imath.V2f( 512, 512 ) )
+
+		self.addCleanup( GafferImage.ImagePlug.setCacheCompression, GafferImage.ImagePlug.CacheCompression.None_ )
+
+		for compression in GafferImage.ImagePlug.CacheCompression.values.values() :
+
+			GafferImage.ImagePlug.setCacheCompression( compression )
+			Gaffer.ValuePlug.clearCache()
+
+			with Gaffer.Context() as c :
+				c[GafferImage.ImagePlug.channelNameContextName] = "R"
+				c[GafferImage.ImagePlug.tileOriginContextName] = imath.V2i( 0 )
+				tile1 = ramp["out"]["channelData"].getValue( _copy = False )
+				tile2 = ramp["out"]["channelData"].getValue( _copy = False )
+
+			self.assertEqual( tile1, tile2 )
+			if compression == GafferImage.ImagePlug.CacheCompression.None_ :
+				self.assertTrue( tile1.isSame( tile2 ) )
+			else :
+				# Compressed tiles are decoded into a new value on every
+				# cache hit. This is the price paid for the memory saving.
+				self.assertFalse( tile1.isSame( tile2 ) )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testCacheCompressionHitPerformance( self ) :
+
+		ramp = GafferImage.Ramp()
+		ramp["format"].setValue( GafferImage.Format( 3840, 2160 ) )
+		ramp["endPosition"].setValue( imath.V2f( 3840, 2160 ) )
+
+		self.addCleanup( GafferImage.ImagePlug.setCacheCompression, GafferImage.ImagePlug.CacheCompression.None_ )
+		GafferImage.ImagePlug.setCacheCompression( GafferImage.ImagePlug.CacheCompression.Lossless )
+
+		# Populate the cache, so that we measure only the cost of decoding
+		# tiles on cache hits.
+		GafferImageTest.processTiles( ramp["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( ramp["out"] )
+
 	def __testTileData( self, tileData, numSamples, value = None, valueFunc = None ) :
 
 		self.assertEqual( len(tileData), numSamples )
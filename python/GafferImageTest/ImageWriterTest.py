@@ -43,6 +43,7 @@ import functools
 import datetime
 import re
 import subprocess
+import threading
 import imath
 import inspect
 
@@ -433,6 +434,171 @@ class ImageWriterTest( GafferImageTest.ImageTestCase ) :
 										emptyPixelData[channel] = IECore.ObjectVector( [ refData ] )
 									self.assertEqual( GafferImage.ImageAlgo.tiles( reRead["out"] ), emptyPixelData )
 
+	def testMemoryLimit( self ) :
+
+		l = GafferImage.ImageWriter.getMemoryLimit()
+		try :
+			GafferImage.ImageWriter.setMemoryLimit( l + 1 )
+			self.assertEqual( GafferImage.ImageWriter.getMemoryLimit(), l + 1 )
+		finally :
+			GafferImage.ImageWriter.setMemoryLimit( l )
+
+		r = GafferImage.ImageReader()
+		r["fileName"].setValue( self.__representativeDeepPath )
+
+		flatten = GafferImage.DeepToFlat()
+		flatten["in"].setInput( r["out"] )
+
+		w = GafferImage.ImageWriter()
+		w["openexr"]["dataType"].setValue( "float" )
+
+		reference = GafferImage.ImageReader()
+		reRead = GafferImage.ImageReader()
+
+		for deep in [ True, False ] :
+
+			w["in"].setInput( r["out"] if deep else flatten["out"] )
+
+			for mode in [ GafferImage.ImageWriter.Mode.Scanline, GafferImage.ImageWriter.Mode.Tile ] :
+
+				w["openexr"]["mode"].setValue( mode )
+
+				w["fileName"].setValue( self.temporaryDirectory() / "reference.exr" )
+				GafferImage.ImageWriter.setMemoryLimit( 0 )
+				try :
+					w["task"].execute()
+				finally :
+					GafferImage.ImageWriter.setMemoryLimit( l )
+				reference["fileName"].setValue( w["fileName"].getValue() )
+				reference["refreshCount"].setValue( reference["refreshCount"].getValue() + 1 )
+
+				# A limit of 1 byte forces tiles to be processed one at a time, and
+				# intermediate limits split images into bands of differing concurrency,
+				# once the rows buffered by the writer have been accounted for.
+				for limit in [ 1, 256 * 1024, 4 * 1024 * 1024 ] :
+
+					with self.subTest( deep = deep, mode = mode, limit = limit ) :
+
+						w["fileName"].setValue( self.temporaryDirectory() / "limited{}.exr".format( limit ) )
+						GafferImage.ImageWriter.setMemoryLimit( limit )
+						try :
+							w["task"].execute()
+						finally :
+							GafferImage.ImageWriter.setMemoryLimit( l )
+
+						reRead["fileName"].setValue( w["fileName"].getValue() )
+						reRead["refreshCount"].setValue( reRead["refreshCount"].getValue() + 1 )
+						self.assertImagesEqual( reRead["out"], reference["out"], ignoreMetadata = True )
+
+	def testEXRThreads( self ) :
+
+		threads = OpenImageIO.getattribute( "exr_threads" )
+		try :
+			OpenImageIO.attribute( "exr_threads", -1 )
+
+			checker = GafferImage.Checkerboard()
+			writer = GafferImage.ImageWriter()
+			writer["in"].setInput( checker["out"] )
+			writer["fileName"].setValue( self.temporaryDirectory() / "test.exr" )
+			writer["task"].execute()
+
+			# The writer uses more threads for compression while writing,
+			# but must restore the global setting afterwards so that it
+			# doesn't affect reading.
+			self.assertEqual( OpenImageIO.getattribute( "exr_threads" ), -1 )
+
+			reader = GafferImage.ImageReader()
+			reader["fileName"].setInput( writer["fileName"] )
+			self.assertImagesEqual( reader["out"], checker["out"], ignoreMetadata = True )
+
+			# Likewise for concurrent writes.
+
+			writers = []
+			for i in range( 0, 4 ) :
+				w = GafferImage.ImageWriter()
+				w["in"].setInput( checker["out"] )
+				w["fileName"].setValue( self.temporaryDirectory() / "test{}.exr".format( i ) )
+				writers.append( w )
+
+			threadList = [ threading.Thread( target = w["task"].execute ) for w in writers ]
+			for t in threadList :
+				t.start()
+			for t in threadList :
+				t.join()
+
+			self.assertEqual( OpenImageIO.getattribute( "exr_threads" ), -1 )
+
+		finally :
+			OpenImageIO.attribute( "exr_threads", threads )
+
+	def __writePerformance( self, compression, threads = None ) :
+
+		# An image with 60 channels, similar to a typical multi-AOV render.
+		copyChannels = GafferImage.CopyChannels()
+		copyChannels["channels"].setValue( "*" )
+		checkers = []
+		for i in range( 0, 15 ) :
+			checker = GafferImage.Checkerboard()
+			checker["format"].setValue( GafferImage.Format( 2048, 1556 ) )
+			checker["layer"].setValue( "aov{}".format( i ) )
+			checker["transform"]["rotate"].setValue( 10 + i )
+			checker["size"].setValue( imath.V2f( 7 + i ) )
+			copyChannels["in"][i].setInput( checker["out"] )
+			checkers.append( checker )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( copyChannels["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / "test.exr" )
+		writer["openexr"]["compression"].setValue( compression )
+		writer["openexr"]["dataType"].setValue( "half" )
+
+		# Compute the image up front, so that we are measuring the time
+		# taken to write it.
+		GafferImageTest.processTiles( writer["in"] )
+
+		if threads is None :
+			threads = IECore.hardwareConcurrency()
+
+		with IECore.tbb_global_control( IECore.tbb_global_control.parameter.max_allowed_parallelism, threads ) :
+			with GafferTest.TestRunner.PerformanceScope() :
+				writer["task"].execute()
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testZIPWritePerformanceSingleThreaded( self ) :
+
+		self.__writePerformance( "zip", threads = 1 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testZIPWritePerformanceFourThreads( self ) :
+
+		self.__writePerformance( "zip", threads = 4 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testZIPWritePerformance( self ) :
+
+		self.__writePerformance( "zip" )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testDWAAWritePerformanceSingleThreaded( self ) :
+
+		self.__writePerformance( "dwaa", threads = 1 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testDWAAWritePerformanceFourThreads( self ) :
+
+		self.__writePerformance( "dwaa", threads = 4 )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testDWAAWritePerformance( self ) :
+
+		self.__writePerformance( "dwaa" )
+
 	# Write an RGBA image that has a data window to various supported formats and in both scanline and tile modes.
 	def __testExtension( self, ext, formatName, options = {}, metadataToIgnore = [] ) :
 
@@ -377,5 +377,20 @@ class MedianTest( GafferImageTest.ImageTestCase ) :
 		with GafferTest.TestRunner.PerformanceScope() :
 			GafferImageTest.processTiles( median["out"] )
 
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testMediumRadiusPerf( self ) :
+
+		imageReader = GafferImage.ImageReader()
+		imageReader["fileName"].setValue( self.imagesPath() / 'deepMergeReference.exr' )
+
+		GafferImageTest.processTiles( imageReader["out"] )
+
+		median = GafferImage.Median()
+		median["in"].setInput( imageReader["out"] )
+		median["radius"].setValue( imath.V2i( 24 ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( median["out"] )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -35,6 +35,8 @@
 ##########################################################################
 
 import os
+import inspect
+import subprocess
 import unittest
 import imath
 
@@ -919,6 +921,89 @@ class MergeTest( GafferImageTest.ImageTestCase ) :
 		merge["in"][0].setInput( c1["out"] )
 		self.assertImagesEqual( merge["out"], c1["out"] )
 
+	def testUniformTiles( self ) :
+
+		constantA = GafferImage.Constant()
+		constantA["format"].setValue( GafferImage.Format( 512, 512 ) )
+		constantA["color"].setValue( imath.Color4f( 0.25, 0.5, 0.75, 0.5 ) )
+
+		constantB = GafferImage.Constant()
+		constantB["format"].setValue( GafferImage.Format( 512, 512 ) )
+		constantB["color"].setValue( imath.Color4f( 0.1, 0.2, 0.3, 0.8 ) )
+
+		# Offsetting produces tiles with the same values, but which
+		# aren't recognised as uniform, so are processed pixel by pixel.
+		offset = GafferImage.Offset()
+		offset["in"].setInput( constantA["out"] )
+		offset["offset"].setValue( imath.V2i( 1 ) )
+
+		merge = GafferImage.Merge()
+		merge["in"][0].setInput( constantB["out"] )
+		merge["in"][1].setInput( constantA["out"] )
+
+		referenceMerge = GafferImage.Merge()
+		referenceMerge["in"][0].setInput( constantB["out"] )
+		referenceMerge["in"][1].setInput( offset["out"] )
+
+		tileOrigin = imath.V2i( GafferImage.ImagePlug.tileSize() )
+		for operation in GafferImage.Merge.Operation.values.values() :
+
+			merge["operation"].setValue( operation )
+			referenceMerge["operation"].setValue( operation )
+
+			for channelName in [ "R", "G", "B", "A" ] :
+				tile = merge["out"].channelData( channelName, tileOrigin, _copy = False )
+				self.assertTrue( GafferImage.ImagePlug.isUniformTile( tile ) )
+				self.assertEqual( tile, referenceMerge["out"].channelData( channelName, tileOrigin ) )
+
+	def testInstructionSets( self ) :
+
+		# The vectorised kernels are chosen once per process, so we merge in
+		# a separate process for each instruction set, and check that every
+		# operation gives bit-identical results to the default kernel.
+
+		script = self.temporaryDirectory() / "merge.py"
+		with open( script, "w", encoding = "utf-8" ) as f :
+			f.write( inspect.cleandoc(
+				"""
+				import sys
+				import imath
+				import GafferImage
+
+				a = GafferImage.ImageReader()
+				a["fileName"].setValue( sys.argv[1] )
+
+				b = GafferImage.ImageReader()
+				b["fileName"].setValue( sys.argv[2] )
+
+				# Offset so that we get regions inside only A, only B, and both.
+				offset = GafferImage.Offset()
+				offset["in"].setInput( a["out"] )
+				offset["offset"].setValue( imath.V2i( 37, 21 ) )
+
+				merge = GafferImage.Merge()
+				merge["in"][0].setInput( b["out"] )
+				merge["in"][1].setInput( offset["out"] )
+
+				for name, operation in sorted( GafferImage.Merge.Operation.names.items() ) :
+					merge["operation"].setValue( operation )
+					print( name, GafferImage.ImageAlgo.tiles( merge["out"] ).hash() )
+				"""
+			) )
+
+		results = {}
+		for instructionSet in [ "Default", "AVX2", "AVX512" ] :
+			env = Gaffer.environment()
+			env["GAFFERIMAGE_MERGE_INSTRUCTION_SET"] = instructionSet
+			results[instructionSet] = subprocess.check_output(
+				[ str( Gaffer.executablePath() ), "python", str( script ), "-arguments", str( self.checkerRGBPath ), str( self.rgbPath ) ],
+				env = env, text = True
+			)
+
+		self.assertEqual( len( results["Default"].splitlines() ), len( GafferImage.Merge.Operation.names ) )
+		self.assertEqual( results["AVX2"], results["Default"] )
+		self.assertEqual( results["AVX512"], results["Default"] )
+
 	def mergePerf( self, operation, mismatch ):
 		r = GafferImage.Checkerboard( "Checkerboard" )
 		r["format"].setValue( GafferImage.Format( 4096, 3112, 1.000 ) )
@@ -1111,5 +1196,49 @@ class MergeTest( GafferImageTest.ImageTestCase ) :
 	def testMaxMismatchPerf( self ):
 		self.mergePerf( GafferImage.Merge.Operation.Max, True )
 
+	def manyInputMergePerf( self, operation, numInputs = 16 ):
+
+		r = GafferImage.Checkerboard()
+		r["format"].setValue( GafferImage.Format( 4096, 3112, 1.000 ) )
+		r["size"].setValue( imath.V2f( 64.01 ) )
+
+		alphaShuffle = GafferImage.Shuffle()
+		alphaShuffle["in"].setInput( r["out"] )
+		alphaShuffle["shuffles"].addChild( Gaffer.ShufflePlug( "R", "A" ) )
+
+		# Small offsets mean that almost every pixel is inside every
+		# input, so this is dominated by the per-pixel operation.
+		merge = GafferImage.Merge()
+		merge["operation"].setValue( operation )
+		offsets = []
+		for i in range( numInputs ) :
+			offset = GafferImage.Offset()
+			offset["in"].setInput( alphaShuffle["out"] )
+			offset["offset"].setValue( imath.V2i( i * 3, i * 5 ) )
+			merge["in"][i].setInput( offset["out"] )
+			offsets.append( offset )
+
+		# Precache upstream network, we're only interested in the performance of Merge
+		for offset in offsets :
+			GafferImageTest.processTiles( offset["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( merge["out"] )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5)
+	def testManyInputOverPerf( self ):
+		self.manyInputMergePerf( GafferImage.Merge.Operation.Over )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5)
+	def testManyInputMattePerf( self ):
+		self.manyInputMergePerf( GafferImage.Merge.Operation.Matte )
+
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5)
+	def testManyInputDifferencePerf( self ):
+		self.manyInputMergePerf( GafferImage.Merge.Operation.Difference )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -744,6 +744,81 @@ class OpenImageIOReaderTest( GafferImageTest.ImageTestCase ) :
 		finally :
 			GafferImage.OpenImageIOReader.setOpenFilesLimit( l )
 
+	def testReadAheadMemoryLimit( self ) :
+
+		l = GafferImage.OpenImageIOReader.getReadAheadMemoryLimit()
+		try :
+			GafferImage.OpenImageIOReader.setReadAheadMemoryLimit( l + 1 )
+			self.assertEqual( GafferImage.OpenImageIOReader.getReadAheadMemoryLimit(), l + 1 )
+		finally :
+			GafferImage.OpenImageIOReader.setReadAheadMemoryLimit( l )
+
+	def testReadAhead( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 1920, 1080 ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( checker["out"] )
+
+		reader = GafferImage.OpenImageIOReader()
+
+		tileSize = GafferImage.ImagePlug.tileSize()
+		rows = range( 0, 1080, tileSize )
+
+		for mode in ( GafferImage.ImageWriter.Mode.Scanline, GafferImage.ImageWriter.Mode.Tile ) :
+
+			fileName = self.temporaryDirectory() / "readAhead{}.exr".format( mode )
+			writer["fileName"].setValue( fileName )
+			writer["openexr"]["mode"].setValue( mode )
+			writer["task"].execute()
+
+			reader["fileName"].setValue( fileName )
+
+			for reverse in ( False, True ) :
+
+				# Visit tiles in scanline order, so that successive tile batch
+				# requests travel in a consistent direction and trigger read-ahead.
+				tileOrigins = [
+					imath.V2i( x, y )
+					for y in ( rows if reverse else reversed( rows ) )
+					for x in range( 0, 1920, tileSize )
+				]
+
+				expected = None
+				for limit in ( 0, 1024 * 1024, 256 * 1024 * 1024 ) :
+
+					with self.subTest( mode = mode, reverse = reverse, limit = limit ) :
+
+						l = GafferImage.OpenImageIOReader.getReadAheadMemoryLimit()
+						GafferImage.OpenImageIOReader.setReadAheadMemoryLimit( limit )
+						try :
+							Gaffer.ValuePlug.clearCache()
+							reader["refreshCount"].setValue( reader["refreshCount"].getValue() + 1 )
+							result = [
+								reader["out"].channelData( channelName, tileOrigin )
+								for tileOrigin in tileOrigins
+								for channelName in [ "R", "G", "B", "A" ]
+							]
+							# Revisit the same tiles after they have been evicted from
+							# the cache, without reopening the file.
+							Gaffer.ValuePlug.clearCache()
+							self.assertEqual(
+								[
+									reader["out"].channelData( channelName, tileOrigin )
+									for tileOrigin in tileOrigins
+									for channelName in [ "R", "G", "B", "A" ]
+								],
+								result
+							)
+						finally :
+							GafferImage.OpenImageIOReader.setReadAheadMemoryLimit( l )
+
+						if expected is None :
+							expected = result
+						else :
+							self.assertEqual( result, expected )
+
 	def testSubimageMetadataNotLoaded( self ) :
 
 		reader = GafferImage.ImageReader()
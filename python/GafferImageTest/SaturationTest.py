@@ -82,3 +82,34 @@ class SaturationTest( GafferImageTest.ImageTestCase ) :
 		sat["saturation"].setValue( 2 )
 		ref["color"].setValue( imath.Color4f( 0.67874, 0.47874, 0.47874, 1 ) )
 		self.assertImagesEqual( sat["out"], ref["out"], maxDifference = 1e-7 )
+
+	def testUniformTiles( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 512, 512 ) )
+		constant["color"].setValue( imath.Color4f( 0.6, 0.5, 0.4, 0.5 ) )
+
+		# Offsetting produces tiles with the same values, but which
+		# aren't recognised as uniform, so are processed pixel by pixel.
+		offset = GafferImage.Offset()
+		offset["in"].setInput( constant["out"] )
+		offset["offset"].setValue( imath.V2i( 1 ) )
+
+		saturation = GafferImage.Saturation()
+		saturation["in"].setInput( constant["out"] )
+		saturation["saturation"].setValue( 2 )
+
+		referenceSaturation = GafferImage.Saturation()
+		referenceSaturation["in"].setInput( offset["out"] )
+		referenceSaturation["saturation"].setValue( 2 )
+
+		tileOrigin = imath.V2i( GafferImage.ImagePlug.tileSize() )
+		for processUnpremultiplied in ( False, True ) :
+
+			saturation["processUnpremultiplied"].setValue( processUnpremultiplied )
+			referenceSaturation["processUnpremultiplied"].setValue( processUnpremultiplied )
+
+			for channelName in [ "R", "G", "B" ] :
+				tile = saturation["out"].channelData( channelName, tileOrigin, _copy = False )
+				self.assertTrue( GafferImage.ImagePlug.isUniformTile( tile ) )
+				self.assertEqual( tile, referenceSaturation["out"].channelData( channelName, tileOrigin ) )
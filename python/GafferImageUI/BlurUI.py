@@ -91,7 +91,28 @@ Gaffer.Metadata.registerNode(
 			which the blur will bleed onto.
 			"""
 
-		}
+		},
+
+		"method" : {
+
+			"description" :
+			"""
+			The method used to compute the blur.
+
+			- Convolution : Convolves with an exact gaussian kernel. The cost
+			  increases with the radius.
+			- Recursive : Uses a recursive approximation to the gaussian, whose
+			  cost per pixel is independent of the radius. This is much faster
+			  for large radii, such as those used for glows, but is slightly less
+			  accurate, and processes whole rows and columns of the image at once.
+			""",
+
+			"preset:Convolution" : GafferImage.Blur.Method.Convolution,
+			"preset:Recursive" : GafferImage.Blur.Method.Recursive,
+
+			"plugValueWidget:type" : "GafferUI.PresetsPlugValueWidget",
+
+		},
 
 	}
 
@@ -94,5 +94,68 @@ class FilterPlugTest( GafferSceneTest.SceneTestCase ) :
 			f["paths"].setValue( IECore.StringVectorData( [ "/other" ] ) )
 			self.assertEqual( p.match( c["out"] ), IECore.PathMatcher.Result.NoMatch )
 
+	def testPathMatcher( self ) :
+
+		c = GafferScene.Cube()
+		c["sets"].setValue( "cubeSet" )
+
+		p = GafferScene.FilterPlug()
+		self.assertIsNone( p.pathMatcher( c["out"] ) )
+
+		# PathFilter
+
+		f = GafferScene.PathFilter()
+		f["paths"].setValue( IECore.StringVectorData( [ "/cube", "/.../geo/*" ] ) )
+		p.setInput( f["out"] )
+		self.assertEqual( p.pathMatcher( c["out"] ), IECore.PathMatcher( [ "/cube", "/.../geo/*" ] ) )
+
+		f["enabled"].setValue( False )
+		self.assertEqual( p.pathMatcher( c["out"] ), IECore.PathMatcher() )
+		f["enabled"].setValue( True )
+
+		# PathFilter with computed enabled state, which must be
+		# evaluated per location
+
+		enabledSwitch = Gaffer.Switch()
+		enabledSwitch.setup( Gaffer.BoolPlug() )
+		enabledSwitch["in"][0].setValue( True )
+		f["enabled"].setInput( enabledSwitch["out"] )
+		self.assertIsNone( p.pathMatcher( c["out"] ) )
+		f["enabled"].setInput( None )
+		self.assertIsNotNone( p.pathMatcher( c["out"] ) )
+
+		# PathFilter with computed paths
+
+		s = Gaffer.ScriptNode()
+		s["f"] = GafferScene.PathFilter()
+		s["e"] = Gaffer.Expression()
+		s["e"].setExpression( 'parent["f"]["paths"] = IECore.StringVectorData( [ "/frame%d" % context.getFrame() ] )' )
+		p.setInput( s["f"]["out"] )
+
+		with Gaffer.Context() as context :
+			context.setFrame( 2 )
+			self.assertEqual( p.pathMatcher( c["out"] ), IECore.PathMatcher( [ "/frame2" ] ) )
+
+		# PathFilter with roots, which must be evaluated per location
+
+		rootsFilter = GafferScene.PathFilter()
+		f["roots"].setInput( rootsFilter["out"] )
+		p.setInput( f["out"] )
+		self.assertIsNone( p.pathMatcher( c["out"] ) )
+
+		# SetFilter
+
+		f = GafferScene.SetFilter()
+		f["setExpression"].setValue( "cubeSet" )
+		p.setInput( f["out"] )
+		self.assertEqual( p.pathMatcher( c["out"] ), IECore.PathMatcher( [ "/cube" ] ) )
+
+		# Filters without a PathMatcher
+
+		u = GafferScene.UnionFilter()
+		u["in"][0].setInput( f["out"] )
+		p.setInput( u["out"] )
+		self.assertIsNone( p.pathMatcher( c["out"] ) )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -839,6 +839,56 @@ class GroupTest( GafferSceneTest.SceneTestCase ) :
 		self.assertEqual( group["out"].set( "C" ).value, IECore.PathMatcher( [ "/world" ] ) )
 		self.assertEqual( group["out"].set( "D" ).value, IECore.PathMatcher() )
 
+	def testSetsFromManyInputs( self ) :
+
+		group = GafferScene.Group()
+
+		spheres = []
+		expected = IECore.PathMatcher()
+		for i in range( 0, 200 ) :
+			sphere = GafferScene.Sphere()
+			sphere["name"].setValue( "sphere{}".format( i ) )
+			if i % 3 :
+				sphere["sets"].setValue( "A" )
+				expected.addPath( "/group/sphere{}".format( i ) )
+			group["in"][i].setInput( sphere["out"] )
+			spheres.append( sphere )
+
+		self.assertEqual( group["out"].set( "A" ).value, expected )
+		self.assertEqual( group["out"].set( "B" ).value, IECore.PathMatcher() )
+		self.assertSetsValid( group["out"] )
+
+		# Hash and value should update when any input set changes.
+
+		h = group["out"].setHash( "A" )
+		spheres[99]["sets"].setValue( "A" )
+		self.assertNotEqual( group["out"].setHash( "A" ), h )
+		expected.addPath( "/group/sphere99" )
+		self.assertEqual( group["out"].set( "A" ).value, expected )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSetPerformanceWithManyInputs( self ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["sets"].setValue( "A" )
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["copies"].setValue( 1000 )
+
+		group = GafferScene.Group()
+		instanceGroups = []
+		for i in range( 0, 200 ) :
+			instanceGroup = GafferScene.Group()
+			instanceGroup["in"][0].setInput( duplicate["out"] )
+			instanceGroup["transform"]["translate"]["x"].setValue( i )
+			group["in"][i].setInput( instanceGroup["out"] )
+			instanceGroups.append( instanceGroup )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			group["out"].set( "A" )
+
 	def setUp( self ) :
 
 		GafferSceneTest.SceneTestCase.setUp( self )
@@ -498,5 +498,39 @@ class MergeScenesTest( GafferSceneTest.SceneTestCase ) :
 			[ "set{}".format( i ) for i in range( 0, merge["in"].maxSize() ) ]
 		)
 
+	def testSetsFromManyInputs( self ) :
+
+		merge = GafferScene.MergeScenes()
+		spheres = []
+		groups = []
+
+		for i in range( 0, merge["in"].maxSize() ) :
+			sphere = GafferScene.Sphere()
+			sphere["name"].setValue( "sphere{}".format( i ) )
+			sphere["sets"].setValue( "A" if i % 2 else "A B" )
+			group = GafferScene.Group()
+			group["in"][0].setInput( sphere["out"] )
+			merge["in"][i].setInput( group["out"] )
+			spheres.append( sphere )
+			groups.append( group )
+
+		self.assertEqual(
+			merge["out"].set( "A" ).value,
+			IECore.PathMatcher( [ "/group/sphere{}".format( i ) for i in range( 0, merge["in"].maxSize() ) ] )
+		)
+		self.assertEqual(
+			merge["out"].set( "B" ).value,
+			IECore.PathMatcher( [ "/group/sphere{}".format( i ) for i in range( 0, merge["in"].maxSize(), 2 ) ] )
+		)
+		self.assertSetsValid( merge["out"] )
+
+		# Single inputs should still be passed through.
+
+		for i in range( 1, merge["in"].maxSize() ) :
+			merge["in"][i].setInput( None )
+
+		self.assertEqual( merge["out"].setHash( "A" ), groups[0]["out"].setHash( "A" ) )
+		self.assertTrue( merge["out"].set( "A", _copy = False ).isSame( groups[0]["out"].set( "A", _copy = False ) ) )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -2197,6 +2197,148 @@ class SceneAlgoTest( GafferSceneTest.SceneTestCase ) :
 			result = IECore.PathMatcher()
 			GafferScene.SceneAlgo.matchingPaths( pathMatcher, scene, result )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testParallelTraverseDeepHierarchyPerformance( self ) :
+
+		# Many locations deep in the hierarchy, where the cost of hashing
+		# `scene:path` at each location is significant.
+
+		sphere = GafferScene.Sphere()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["copies"].setValue( 20000 )
+
+		groups = []
+		scene = duplicate["out"]
+		for i in range( 0, 30 ) :
+			groups.append( GafferScene.Group() )
+			groups[-1]["in"][0].setInput( scene )
+			scene = groups[-1]["out"]
+
+		# Warm the cache, so that we're measuring the traversal
+		# rather than the computes.
+		GafferSceneTest.traverseScene( scene )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferSceneTest.traverseScene( scene )
+
+	def testMatchingPathsWithPrunedChildren( self ) :
+
+		# /group
+		#    /geo
+		#       /sphere
+		#       /cube
+		#    /other
+		#       /geo
+		#          /plane
+
+		sphere = GafferScene.Sphere()
+		cube = GafferScene.Cube()
+		plane = GafferScene.Plane()
+
+		geo = GafferScene.Group()
+		geo["name"].setValue( "geo" )
+		geo["in"][0].setInput( sphere["out"] )
+		geo["in"][1].setInput( cube["out"] )
+
+		otherGeo = GafferScene.Group()
+		otherGeo["name"].setValue( "geo" )
+		otherGeo["in"][0].setInput( plane["out"] )
+
+		other = GafferScene.Group()
+		other["name"].setValue( "other" )
+		other["in"][0].setInput( otherGeo["out"] )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( geo["out"] )
+		group["in"][1].setInput( other["out"] )
+
+		pathFilter = GafferScene.PathFilter()
+
+		# UnionFilter doesn't provide a PathMatcher, so forces
+		# the filter to be evaluated at every location.
+		unionFilter = GafferScene.UnionFilter()
+		unionFilter["in"][0].setInput( pathFilter["out"] )
+
+		for paths in [
+			[ "/group/geo/*" ],
+			[ "/.../geo/*" ],
+			[ "/group/other/geo/plane", "/group/geo" ],
+			[ "/group/nonexistent/*" ],
+			[ "/", "/group/*/geo" ],
+			[],
+		] :
+
+			pathFilter["paths"].setValue( IECore.StringVectorData( paths ) )
+			self.assertIsNotNone( pathFilter["out"].pathMatcher( group["out"] ) )
+			self.assertIsNone( unionFilter["out"].pathMatcher( group["out"] ) )
+
+			for root in [ GafferScene.ScenePlug.stringToPath( "/" ), GafferScene.ScenePlug.stringToPath( "/group/other" ) ] :
+
+				paths1 = IECore.PathMatcher()
+				GafferScene.SceneAlgo.matchingPaths( pathFilter["out"], group["out"], root, paths1 )
+				paths2 = IECore.PathMatcher()
+				GafferScene.SceneAlgo.matchingPaths( unionFilter["out"], group["out"], root, paths2 )
+				self.assertEqual( paths1, paths2 )
+
+				self.assertEqual(
+					GafferScene.SceneAlgo.matchingPathsHash( pathFilter["out"], group["out"], root ),
+					GafferScene.SceneAlgo.matchingPathsHash( unionFilter["out"], group["out"], root )
+				)
+
+	def testMatchingPathsWithComputedEnabled( self ) :
+
+		script = Gaffer.ScriptNode()
+
+		script["sphere"] = GafferScene.Sphere()
+		script["cube"] = GafferScene.Cube()
+		script["group"] = GafferScene.Group()
+		script["group"]["in"][0].setInput( script["sphere"]["out"] )
+		script["group"]["in"][1].setInput( script["cube"]["out"] )
+
+		script["pathFilter"] = GafferScene.PathFilter()
+		script["pathFilter"]["paths"].setValue( IECore.StringVectorData( [ "/group/*" ] ) )
+
+		# UnionFilter doesn't provide a PathMatcher, so forces
+		# the filter to be evaluated at every location.
+		script["unionFilter"] = GafferScene.UnionFilter()
+		script["unionFilter"]["in"][0].setInput( script["pathFilter"]["out"] )
+
+		# An `enabled` plug driven by an expression must not be evaluated
+		# once up front on behalf of every location.
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["pathFilter"]["enabled"] = context.get( "scene:path", None ) is None' )
+		self.assertIsNone( script["pathFilter"]["out"].pathMatcher( script["group"]["out"] ) )
+
+		paths1 = IECore.PathMatcher()
+		GafferScene.SceneAlgo.matchingPaths( script["pathFilter"]["out"], script["group"]["out"], paths1 )
+		paths2 = IECore.PathMatcher()
+		GafferScene.SceneAlgo.matchingPaths( script["unionFilter"]["out"], script["group"]["out"], paths2 )
+		self.assertEqual( paths1, paths2 )
+		self.assertEqual( paths1, IECore.PathMatcher( [ "/group/sphere", "/group/cube" ] ) )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testMatchingPathsWithManyChildrenPerformance( self ) :
+
+		# Infinitely recursive scene with many children at every
+		# location. Only a tiny fraction of it is matched by the filter,
+		# so performance depends on pruning non-matching children
+		# without visiting them.
+		scene = GafferScene.ScenePlug()
+		scene["childNames"].setValue( IECore.InternedStringVectorData( [ "child{}".format( i ) for i in range( 0, 10000 ) ] ) )
+
+		pathFilter = GafferScene.PathFilter()
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/child{}/child{}/*".format( i, i ) for i in range( 0, 10 ) ] ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			result = IECore.PathMatcher()
+			GafferScene.SceneAlgo.matchingPaths( pathFilter["out"], scene, result )
+
+		self.assertEqual( result.match( "/child9/child9/child9999" ), IECore.PathMatcher.Result.ExactMatch )
+		self.assertEqual( result.match( "/child10/child10/child0" ), IECore.PathMatcher.Result.NoMatch )
+
 	def testHierarchyHash( self ) :
 
 		# We need to check that changing basically anything about a scene will result in a unique hash
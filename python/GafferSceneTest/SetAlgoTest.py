@@ -40,6 +40,7 @@ import functools
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -331,6 +332,88 @@ class SetAlgoTest( GafferSceneTest.SceneTestCase ) :
 
 		self.assertFalse( GafferScene.SetAlgo.affectsSetExpression( Gaffer.IntPlug() ) )
 
+	def testRepeatedEvaluation( self ) :
+
+		# Compiled expressions are cached internally, but that
+		# must not be observable.
+
+		sphere = GafferScene.Sphere()
+		sphere["sets"].setValue( "A" )
+		cube = GafferScene.Cube()
+		cube["sets"].setValue( "B" )
+		plane = GafferScene.Plane()
+		plane["sets"].setValue( "C" )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( sphere["out"] )
+		group["in"][1].setInput( cube["out"] )
+		group["in"][2].setInput( plane["out"] )
+
+		expression = "( A | B ) - ( C & A )"
+		for i in range( 0, 2 ) :
+			self.assertCorrectEvaluation( group["out"], expression, [ "/group/sphere", "/group/cube" ] )
+
+		plane["sets"].setValue( "A C" )
+		self.assertCorrectEvaluation( group["out"], expression, [ "/group/sphere", "/group/cube" ] )
+
+		sphere["sets"].setValue( "A C" )
+		self.assertCorrectEvaluation( group["out"], expression, [ "/group/cube" ] )
+
+		# Same expression, different scene.
+
+		self.assertCorrectEvaluation( sphere["out"], expression, [] )
+		self.assertCorrectEvaluation( group["out"], expression, [ "/group/cube" ] )
+
+		# Same expression, different context.
+
+		sphere["sets"].setValue( "${letter}" )
+		with Gaffer.Context() as context :
+			context["letter"] = "A"
+			self.assertCorrectEvaluation( group["out"], expression, [ "/group/sphere", "/group/cube" ] )
+			context["letter"] = "C"
+			self.assertCorrectEvaluation( group["out"], expression, [ "/group/cube" ] )
+
+		# Syntax errors should be reported every time.
+
+		for i in range( 0, 2 ) :
+			with self.assertRaisesRegex( RuntimeError, "Syntax error" ) :
+				GafferScene.SetAlgo.evaluateSetExpression( "A | ( B", group["out"] )
+
+	def testIdenticalSubexpressions( self ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["sets"].setValue( "A B" )
+
+		self.assertCorrectEvaluation( sphere["out"], "( A | B ) & ( A | B )", [ "/sphere" ] )
+		self.assertCorrectEvaluation( sphere["out"], "( A | B ) - ( A | B )", [] )
+		self.assertCorrectEvaluation( sphere["out"], "( A | B ) in ( A | B )", [ "/sphere" ] )
+		self.assertCorrectEvaluation( sphere["out"], "( A* | B ) containing ( B | A* )", [ "/sphere" ] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testManyExpressionsPerformance( self ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["sets"].setValue( " ".join( "set{}".format( i ) for i in range( 0, 100 ) ) )
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["copies"].setValue( 10000 )
+
+		expressions = [
+			"( set{0} | set{1} ) - ( set{2} & set{3} )".format( i, i + 1, i + 2, i + 3 )
+			for i in range( 0, 96 )
+		]
+
+		# Warm the set caches, so we measure only the expressions.
+		for expression in expressions :
+			GafferScene.SetAlgo.setExpressionHash( expression, duplicate["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 10 ) :
+				for expression in expressions :
+					GafferScene.SetAlgo.evaluateSetExpression( expression, duplicate["out"] )
+
 	def assertCorrectEvaluation( self, scenePlug, expression, expectedContents ) :
 
 		result = set( GafferScene.SetAlgo.evaluateSetExpression( expression, scenePlug ).paths() )
@@ -0,0 +1,167 @@
+##########################################################################
+#
+#  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+
+import unittest
+
+import Gaffer
+import GafferTest
+
+class CacheMonitorTest( GafferTest.TestCase ) :
+
+	def testConstruction( self ) :
+
+		monitor = Gaffer.CacheMonitor()
+		self.assertEqual( monitor.allStatistics(), {} )
+		self.assertEqual( monitor.nodeTypeStatistics( "GafferTest::AddNode" ), Gaffer.CacheMonitor.Statistics() )
+		self.assertEqual( monitor.combinedStatistics(), Gaffer.CacheMonitor.Statistics() )
+		self.assertEqual( monitor.computeCacheEvictions(), 0 )
+		self.assertEqual( monitor.computeCacheEvictedMemory(), 0 )
+		self.assertEqual( monitor.hashCacheEvictions(), 0 )
+
+	def testStatisticsConstructorAndAccessors( self ) :
+
+		s = Gaffer.CacheMonitor.Statistics(
+			hashHits = 1,
+			hashMisses = 2,
+			hashWaits = 3,
+			computeHits = 4,
+			computeMisses = 5,
+			computeWaits = 6
+		)
+
+		self.assertEqual( s.hashHits, 1 )
+		self.assertEqual( s.hashMisses, 2 )
+		self.assertEqual( s.hashWaits, 3 )
+		self.assertEqual( s.computeHits, 4 )
+		self.assertEqual( s.computeMisses, 5 )
+		self.assertEqual( s.computeWaits, 6 )
+
+		s.computeWaits = 10
+		self.assertEqual( s.computeWaits, 10 )
+		self.assertNotEqual( s, Gaffer.CacheMonitor.Statistics() )
+
+	def testHitsAndMisses( self ) :
+
+		Gaffer.ValuePlug.clearCache()
+
+		a = GafferTest.AddNode()
+		a["op1"].setValue( -2001 )
+		a["op2"].setValue( -2002 )
+
+		monitor = Gaffer.CacheMonitor()
+
+		# First computation misses both caches.
+
+		with monitor :
+			self.assertEqual( a["sum"].getValue(), -4003 )
+
+		self.assertEqual(
+			monitor.nodeTypeStatistics( "GafferTest::AddNode" ),
+			Gaffer.CacheMonitor.Statistics( hashMisses = 1, computeMisses = 1 )
+		)
+
+		# Repeating it hits both caches.
+
+		with monitor :
+			self.assertEqual( a["sum"].getValue(), -4003 )
+
+		self.assertEqual(
+			monitor.nodeTypeStatistics( "GafferTest::AddNode" ),
+			Gaffer.CacheMonitor.Statistics( hashHits = 1, hashMisses = 1, computeHits = 1, computeMisses = 1 )
+		)
+
+		# A new context requires a new hash, but the value
+		# is still cached.
+
+		with monitor :
+			with Gaffer.Context() as c :
+				c["myVariable"] = 1
+				self.assertEqual( a["sum"].getValue(), -4003 )
+
+		self.assertEqual(
+			monitor.nodeTypeStatistics( "GafferTest::AddNode" ),
+			Gaffer.CacheMonitor.Statistics( hashHits = 1, hashMisses = 2, computeHits = 2, computeMisses = 1 )
+		)
+
+		# Lookups made outside the monitor's scope aren't counted.
+
+		a["sum"].getValue()
+		self.assertEqual( monitor.allStatistics(), { "GafferTest::AddNode" : monitor.nodeTypeStatistics( "GafferTest::AddNode" ) } )
+		self.assertEqual( monitor.combinedStatistics(), monitor.nodeTypeStatistics( "GafferTest::AddNode" ) )
+
+	def testEvictions( self ) :
+
+		Gaffer.ValuePlug.clearCache()
+
+		random = Gaffer.Random()
+		random["seedVariable"].setValue( "test" )
+
+		monitor = Gaffer.CacheMonitor()
+		with monitor :
+			GafferTest.parallelGetValue( random["outFloat"], 10000, "test" )
+
+		s = monitor.nodeTypeStatistics( "Gaffer::Random" )
+		self.assertEqual( s.computeMisses, 10000 )
+		self.assertEqual( s.hashMisses, 10000 )
+
+		Gaffer.ValuePlug.setCacheMemoryLimit( 1000 )
+		Gaffer.ValuePlug.setHashCacheSizeLimit( 10 )
+
+		random["seed"].setValue( 1 )
+		with monitor :
+			GafferTest.parallelGetValue( random["outFloat"], 10000, "test" )
+
+		self.assertGreater( monitor.computeCacheEvictions(), 0 )
+		self.assertGreater( monitor.computeCacheEvictedMemory(), 0 )
+		self.assertGreater( monitor.hashCacheEvictions(), 0 )
+
+	def setUp( self ) :
+
+		GafferTest.TestCase.setUp( self )
+
+		self.__originalCacheMemoryLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+		self.__originalHashCacheSizeLimit = Gaffer.ValuePlug.getHashCacheSizeLimit()
+
+	def tearDown( self ) :
+
+		GafferTest.TestCase.tearDown( self )
+
+		Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+		Gaffer.ValuePlug.setHashCacheSizeLimit( self.__originalHashCacheSizeLimit )
+
+if __name__ == "__main__":
+	unittest.main()
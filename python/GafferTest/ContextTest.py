@@ -803,6 +803,46 @@ class ContextTest( GafferTest.TestCase ) :
 
 		GafferTest.testContextHashPerformance( 10, 10, True )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testContextHashDeepTraversalPerformance( self ) :
+
+		GafferTest.testContextHashDeepTraversalPerformance( 20, 6, 10 )
+
+	def testEditableScopeSetChildPath( self ) :
+
+		GafferTest.testEditableScopeSetChildPath()
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testEditableScopeSetChildPathPerformance( self ) :
+
+		# Directly comparable with `testContextHashDeepTraversalPerformance()`.
+		GafferTest.testEditableScopeSetChildPathPerformance( 20, 6, 10 )
+
+	def testHashAfterEdits( self ) :
+
+		# The hash is maintained incrementally as variables are set and
+		# removed, so must match that of a context constructed directly.
+
+		c = Gaffer.Context()
+		c["a"] = 1
+		c["b"] = "b"
+		c["c"] = 2.0
+		c["a"] = 10
+		del c["b"]
+		c.removeMatching( "c" )
+		c["d"] = IECore.V3fData( imath.V3f( 1 ) )
+
+		c2 = Gaffer.Context()
+		c2["d"] = IECore.V3fData( imath.V3f( 1 ) )
+		c2["a"] = 10
+
+		self.assertEqual( c.hash(), c2.hash() )
+		self.assertEqual( Gaffer.Context( c ).hash(), c.hash() )
+
+		del c["a"]
+		del c["d"]
+		self.assertEqual( c.hash(), Gaffer.Context().hash() )
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testContextCopyPerformance( self ) :
 
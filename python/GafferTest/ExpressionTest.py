@@ -1740,5 +1740,159 @@ class ExpressionTest( GafferTest.TestCase ) :
 		# mechanism for handling it, this will deadlock.
 		script["n"]["user"]["p4"].getValue()
 
+	def testNativeExecution( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = Gaffer.Node()
+		s["n"]["user"]["i"] = Gaffer.IntPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n"]["user"]["s"] = Gaffer.StringPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n"]["user"]["m"] = Gaffer.M44fPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+
+		s["e"] = Gaffer.Expression()
+
+		# Monkey patch `execute()` so we can tell whether or not
+		# Python was used to evaluate the expression.
+
+		pythonExecutions = []
+		originalExecute = Gaffer.PythonExpressionEngine.execute
+		def execute( engine, context, inputs ) :
+			pythonExecutions.append( context.getFrame() )
+			return originalExecute( engine, context, inputs )
+
+		Gaffer.PythonExpressionEngine.execute = execute
+		try :
+
+			# Expressions using only simple features are executed natively.
+
+			s["e"].setExpression(
+				inspect.cleandoc(
+					"""
+					import imath
+					parent["n"]["user"]["i"] = int( context.getFrame() * 2 )
+					parent["n"]["user"]["s"] = "{}_{:03d}".format( context.get( "shot", "none" ), int( context.getFrame() ) )
+					"""
+				)
+			)
+
+			with Gaffer.Context() as c :
+				c.setFrame( 2 )
+				self.assertEqual( s["n"]["user"]["i"].getValue(), 4 )
+				self.assertEqual( s["n"]["user"]["s"].getValue(), "none_002" )
+				c["shot"] = "sh010"
+				self.assertEqual( s["n"]["user"]["s"].getValue(), "sh010_002" )
+
+			self.assertEqual( pythonExecutions, [] )
+
+			# Anything else falls back to Python.
+
+			for expression in [
+				'parent["n"]["user"]["s"] = " ".join( [ "a", "b" ] )',
+				'parent["n"]["user"]["i"] = None',
+				'parent["n"]["user"]["m"] = imath.M44f()',
+			] :
+				s["e"].setExpression( expression )
+				with Gaffer.Context() as c :
+					c.setFrame( 3 )
+					with IECore.IgnoredExceptions( Gaffer.ProcessException ) :
+						s["n"]["user"]["s"].getValue()
+						s["n"]["user"]["i"].getValue()
+						s["n"]["user"]["m"].getValue()
+
+			self.assertEqual( pythonExecutions, [ 3, 3, 3 ] )
+
+			# Expressions reading `scene:path` go straight to Python.
+
+			del pythonExecutions[:]
+			s["e"].setExpression( 'parent["n"]["user"]["i"] = len( context["scene:path"] )' )
+			with Gaffer.Context() as c :
+				c.setFrame( 4 )
+				c["scene:path"] = IECore.InternedStringVectorData( [ "a", "b" ] )
+				self.assertEqual( s["n"]["user"]["i"].getValue(), 2 )
+
+			self.assertEqual( pythonExecutions, [ 4 ] )
+
+			# Once native execution has failed, Python is used for all
+			# subsequent executions, even those which could have been
+			# executed natively.
+
+			del pythonExecutions[:]
+			s["e"].setExpression( 'parent["n"]["user"]["i"] = context.get( "x", 1 ) * 2' )
+			with Gaffer.Context() as c :
+				c.setFrame( 5 )
+				c["x"] = 2
+				self.assertEqual( s["n"]["user"]["i"].getValue(), 4 )
+				self.assertEqual( pythonExecutions, [] )
+				c["x"] = IECore.InternedStringVectorData()
+				with self.assertRaises( Gaffer.ProcessException ) :
+					s["n"]["user"]["i"].getValue()
+				self.assertEqual( pythonExecutions, [ 5 ] )
+				c["x"] = 3
+				self.assertEqual( s["n"]["user"]["i"].getValue(), 6 )
+				self.assertEqual( pythonExecutions, [ 5, 5 ] )
+
+		finally :
+			Gaffer.PythonExpressionEngine.execute = originalExecute
+
+		self.assertEqual( s["e"].getExpression(), ( 'parent["n"]["user"]["i"] = context.get( "x", 1 ) * 2', "python" ) )
+
+	def testNativeExecutionMatchesPython( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = Gaffer.Node()
+		s["n"]["user"]["i"] = Gaffer.IntPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n"]["user"]["s"] = Gaffer.StringPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n"]["user"]["f"] = Gaffer.FloatPlug( defaultValue = 0.1, flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+
+		s["e"] = Gaffer.Expression()
+
+		# Context variables of types the native language doesn't support
+		# must fall back to Python.
+
+		s["e"].setExpression(
+			inspect.cleandoc(
+				"""
+				parent["n"]["user"]["i"] = len( context["scene:path"] )
+				parent["n"]["user"]["s"] = str( context["scene:path"][-1] )
+				"""
+			)
+		)
+
+		with Gaffer.Context() as c :
+			c["scene:path"] = IECore.InternedStringVectorData( [ "a", "b", "c" ] )
+			self.assertEqual( s["n"]["user"]["i"].getValue(), 3 )
+			self.assertEqual( s["n"]["user"]["s"].getValue(), "c" )
+			c["scene:path"] = IECore.InternedStringVectorData( [ "d" ] )
+			self.assertEqual( s["n"]["user"]["i"].getValue(), 1 )
+			self.assertEqual( s["n"]["user"]["s"].getValue(), "d" )
+
+		# Floats must be converted to strings exactly as Python does.
+
+		s["e"].setExpression( 'parent["n"]["user"]["s"] = str( 24 * 0.1 ) + " " + str( parent["n"]["user"]["f"] ) + " {}".format( 1.0 )' )
+		self.assertEqual( s["n"]["user"]["s"].getValue(), "{} {} {}".format( 24 * 0.1, s["n"]["user"]["f"].getValue(), 1.0 ) )
+
+		s["e"].setExpression( 'parent["n"]["user"]["s"] = str( context.getFrame() / 3 )' )
+		with Gaffer.Context() as c :
+			c.setFrame( 2 )
+			self.assertEqual( s["n"]["user"]["s"].getValue(), str( c.getFrame() / 3 ) )
+
+		# Ints too large to be represented exactly as doubles must fall back
+		# to Python.
+
+		s["e"].setExpression( 'parent["n"]["user"]["s"] = str( ( context.get( "i", 3 ) ** 40 ) % 1000 )' )
+		self.assertEqual( s["n"]["user"]["s"].getValue(), str( ( 3 ** 40 ) % 1000 ) )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testNativeExecutionPerformance( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = Gaffer.Node()
+		s["n"]["user"]["p"] = Gaffer.IntPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+
+		s["e"] = Gaffer.Expression()
+		s["e"].setExpression( 'parent["n"]["user"]["p"] = len( "wedge%d" % context["iteration"] ) + context["iteration"] * 2' )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferTest.parallelGetValue( s["n"]["user"]["p"], 1000000, "iteration" )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -48,6 +48,10 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCache( "parallel", numIterations = 100000, numValues = 100, maxCost = 100 )
 
+	def test100PercentOfWorkingSetParallelLockFreeRead( self ) :
+
+		GafferTest.testLRUCache( "parallelLockFreeRead", numIterations = 100000, numValues = 100, maxCost = 100 )
+
 	def test100PercentOfWorkingSetTaskParallel( self ) :
 
 		GafferTest.testLRUCache( "taskParallel", numIterations = 100000, numValues = 100, maxCost = 100 )
@@ -60,6 +64,10 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCache( "parallel", numIterations = 100000, numValues = 100, maxCost = 90 )
 
+	def test90PercentOfWorkingSetParallelLockFreeRead( self ) :
+
+		GafferTest.testLRUCache( "parallelLockFreeRead", numIterations = 100000, numValues = 100, maxCost = 90 )
+
 	def test90PercentOfWorkingSetTaskParallel( self ) :
 
 		GafferTest.testLRUCache( "taskParallel", numIterations = 100000, numValues = 100, maxCost = 90 )
@@ -72,6 +80,10 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCache( "parallel", numIterations = 100000, numValues = 100, maxCost = 2 )
 
+	def test2PercentOfWorkingSetParallelLockFreeRead( self ) :
+
+		GafferTest.testLRUCache( "parallelLockFreeRead", numIterations = 100000, numValues = 100, maxCost = 2 )
+
 	def test2PercentOfWorkingSetTaskParallel( self ) :
 
 		GafferTest.testLRUCache( "taskParallel", numIterations = 10000, numValues = 100, maxCost = 2 )
@@ -84,6 +96,10 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheRemovalCallback( "parallel" )
 
+	def testRemovalCallbackParallelLockFreeRead( self ) :
+
+		GafferTest.testLRUCacheRemovalCallback( "parallelLockFreeRead" )
+
 	def testRemovalCallbackTaskParallel( self ) :
 
 		GafferTest.testLRUCacheRemovalCallback( "taskParallel" )
@@ -96,6 +112,10 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCache( "parallel", numIterations = 100000, numValues = 1000, maxCost = 90, clearFrequency = 20 )
 
+	def testClearAndGetParallelLockFreeRead( self ) :
+
+		GafferTest.testLRUCache( "parallelLockFreeRead", numIterations = 100000, numValues = 1000, maxCost = 90, clearFrequency = 20 )
+
 	def testClearAndGetTaskParallel( self ) :
 
 		GafferTest.testLRUCache( "taskParallel", numIterations = 10000, numValues = 1000, maxCost = 90, clearFrequency = 20 )
@@ -130,6 +150,26 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheContentionForOneItem( "taskParallel", withCanceller = True )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testContentionForGetIfCachedParallel( self ) :
+
+		GafferTest.testLRUCacheContentionForGetIfCached( "parallel" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testContentionForGetIfCachedParallelOneThread( self ) :
+
+		GafferTest.testLRUCacheContentionForGetIfCached( "parallel", numThreads = 1 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testContentionForGetIfCachedParallelLockFreeRead( self ) :
+
+		GafferTest.testLRUCacheContentionForGetIfCached( "parallelLockFreeRead" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testContentionForGetIfCachedParallelLockFreeReadOneThread( self ) :
+
+		GafferTest.testLRUCacheContentionForGetIfCached( "parallelLockFreeRead", numThreads = 1 )
+
 	def testRecursionSerial( self ) :
 
 		GafferTest.testLRUCacheRecursion( "serial", numIterations = 100000, numValues = 10000, maxCost = 10000 )
@@ -138,6 +178,10 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheRecursion( "parallel", numIterations = 100000, numValues = 10000, maxCost = 10000 )
 
+	def testRecursionParallelLockFreeRead( self ) :
+
+		GafferTest.testLRUCacheRecursion( "parallelLockFreeRead", numIterations = 100000, numValues = 10000, maxCost = 10000 )
+
 	def testRecursionTaskParallel( self ) :
 
 		GafferTest.testLRUCacheRecursion( "taskParallel", numIterations = 100000, numValues = 10000, maxCost = 10000 )
@@ -150,6 +194,10 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheRecursion( "parallel", numIterations = 100000, numValues = 1000, maxCost = 100 )
 
+	def testRecursionWithEvictionsParallelLockFreeRead( self ) :
+
+		GafferTest.testLRUCacheRecursion( "parallelLockFreeRead", numIterations = 100000, numValues = 1000, maxCost = 100 )
+
 	def testRecursionWithEvictionsTaskParallel( self ) :
 
 		GafferTest.testLRUCacheRecursion( "taskParallel", numIterations = 100000, numValues = 1000, maxCost = 100 )
@@ -162,6 +210,10 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheClearFromGet( "parallel" )
 
+	def testClearFromGetParallelLockFreeRead( self ) :
+
+		GafferTest.testLRUCacheClearFromGet( "parallelLockFreeRead" )
+
 	def testClearFromGetTaskParallel( self ) :
 
 		GafferTest.testLRUCacheClearFromGet( "taskParallel" )
@@ -174,6 +226,10 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheExceptions( "parallel" )
 
+	def testExceptionsParallelLockFreeRead( self ) :
+
+		GafferTest.testLRUCacheExceptions( "parallelLockFreeRead" )
+
 	def testExceptionsTaskParallel( self ) :
 
 		GafferTest.testLRUCacheExceptions( "taskParallel" )
@@ -186,6 +242,10 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheCancellation( "parallel" )
 
+	def testCancellationParallelLockFreeRead( self ) :
+
+		GafferTest.testLRUCacheCancellation( "parallelLockFreeRead" )
+
 	def testCancellationTaskParallel( self ) :
 
 		GafferTest.testLRUCacheCancellation( "taskParallel" )
@@ -194,6 +254,10 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheCancellationOfSecondGet( "parallel" )
 
+	def testCancellationOfSecondGetParallelLockFreeRead( self ) :
+
+		GafferTest.testLRUCacheCancellationOfSecondGet( "parallelLockFreeRead" )
+
 	def testCancellationOfSecondGetTaskParallel( self ) :
 
 		GafferTest.testLRUCacheCancellationOfSecondGet( "taskParallel" )
@@ -206,6 +270,10 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheUncacheableItem( "parallel" )
 
+	def testUncacheableItemParallelLockFreeRead( self ) :
+
+		GafferTest.testLRUCacheUncacheableItem( "parallelLockFreeRead" )
+
 	def testUncacheableItemTaskParallel( self ) :
 
 		GafferTest.testLRUCacheUncacheableItem( "taskParallel" )
@@ -218,15 +286,25 @@ class LRUCacheTest( GafferTest.TestCase ) :
 
 		GafferTest.testLRUCacheGetIfCached( "parallel" )
 
+	def testGetIfCachedParallelLockFreeRead( self ) :
+
+		GafferTest.testLRUCacheGetIfCached( "parallelLockFreeRead" )
+
 	def testGetIfCachedTaskParallel( self ) :
 
 		GafferTest.testLRUCacheGetIfCached( "taskParallel" )
 
 	def testSetIfUncached( self ) :
 
-		for policy in [ "serial", "parallel", "taskParallel" ] :
+		for policy in [ "serial", "parallel", "parallelLockFreeRead", "taskParallel" ] :
 			with self.subTest( policy = policy ) :
 				GafferTest.testLRUCacheSetIfUncached( policy )
 
+	def testCostAwareEviction( self ) :
+
+		for policy in [ "parallel", "parallelLockFreeRead", "taskParallel" ] :
+			with self.subTest( policy = policy ) :
+				GafferTest.testLRUCacheCostAwareEviction( policy )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -0,0 +1,122 @@
+##########################################################################
+#
+#  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import sys
+import unittest
+
+import Gaffer
+import GafferTest
+
+class MemoryPressureTest( GafferTest.TestCase ) :
+
+	@unittest.skipIf( not sys.platform.startswith( "linux" ), "Memory statistics only available on Linux" )
+	def testMemoryStatistics( self ) :
+
+		self.assertGreater( Gaffer.MemoryPressure.memoryLimit(), 0 )
+		self.assertGreater( Gaffer.MemoryPressure.memoryUsage(), 0 )
+
+	def testEnabled( self ) :
+
+		self.assertFalse( Gaffer.MemoryPressure.getEnabled() )
+		Gaffer.MemoryPressure.setEnabled( True )
+		self.assertTrue( Gaffer.MemoryPressure.getEnabled() )
+		Gaffer.MemoryPressure.setEnabled( False )
+		self.assertFalse( Gaffer.MemoryPressure.getEnabled() )
+
+	def testTargetFraction( self ) :
+
+		Gaffer.MemoryPressure.setTargetFraction( 0.5 )
+		self.assertEqual( Gaffer.MemoryPressure.getTargetFraction(), 0.5 )
+
+	@unittest.skipIf( not sys.platform.startswith( "linux" ), "Memory statistics only available on Linux" )
+	def testComputeCacheAdaptation( self ) :
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.setCacheMemoryLimit( 16 * 1024**2 )
+
+		# Populate the cache.
+
+		node = GafferTest.CachingTestNode()
+		for i in range( 0, 200 ) :
+			node["in"].setValue( str( i ) * 10000 )
+			node["out"].getValue()
+
+		usage = Gaffer.ValuePlug.cacheMemoryUsage()
+		self.assertGreater( usage, 2 * 1024**2 )
+
+		# Updating while disabled should have no effect.
+
+		Gaffer.MemoryPressure.setTargetFraction( 0 )
+		Gaffer.MemoryPressure.update( force = True )
+		self.assertEqual( Gaffer.ValuePlug.cacheMemoryUsage(), usage )
+
+		# A target we can't possibly meet should shrink the cache to its minimum
+		# size, but leave the user-specified limit unchanged.
+
+		Gaffer.MemoryPressure.setEnabled( True )
+		Gaffer.MemoryPressure.update( force = True )
+		self.assertLessEqual( Gaffer.ValuePlug.cacheMemoryUsage(), 1024**2 )
+		self.assertEqual( Gaffer.ValuePlug.getCacheMemoryLimit(), 16 * 1024**2 )
+
+		# Disabling should allow the cache to grow back to the user-specified
+		# limit.
+
+		Gaffer.MemoryPressure.setEnabled( False )
+		for i in range( 0, 200 ) :
+			node["in"].setValue( str( i ) * 10000 )
+			node["out"].getValue()
+
+		self.assertGreater( Gaffer.ValuePlug.cacheMemoryUsage(), 2 * 1024**2 )
+
+	def setUp( self ) :
+
+		GafferTest.TestCase.setUp( self )
+
+		self.__originalCacheMemoryLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+		self.__originalEnabled = Gaffer.MemoryPressure.getEnabled()
+		self.__originalTargetFraction = Gaffer.MemoryPressure.getTargetFraction()
+		Gaffer.MemoryPressure.setEnabled( False )
+
+	def tearDown( self ) :
+
+		GafferTest.TestCase.tearDown( self )
+
+		Gaffer.MemoryPressure.setEnabled( self.__originalEnabled )
+		Gaffer.MemoryPressure.setTargetFraction( self.__originalTargetFraction )
+		Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -0,0 +1,432 @@
+##########################################################################
+#
+#  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+
+import inspect
+import unittest
+import imath
+
+import IECore
+
+import Gaffer
+import GafferTest
+
+class NativeExpressionEngineTest( GafferTest.TestCase ) :
+
+	def __node( self, **plugs ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = Gaffer.Node()
+		for name, plugType in plugs.items() :
+			s["n"]["user"][name] = plugType( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+
+		s["e"] = Gaffer.Expression()
+		return s
+
+	def testNumericPlugs( self ) :
+
+		s = self.__node( i = Gaffer.IntPlug, f = Gaffer.FloatPlug, b = Gaffer.BoolPlug, o1 = Gaffer.IntPlug, o2 = Gaffer.FloatPlug, o3 = Gaffer.BoolPlug )
+		s["e"].setExpression(
+			inspect.cleandoc(
+				"""
+				parent["n"]["user"]["o1"] = parent["n"]["user"]["i"] * 2 + 1
+				parent["n"]["user"]["o2"] = parent["n"]["user"]["f"] / 2
+				parent["n"]["user"]["o3"] = not parent["n"]["user"]["b"]
+				"""
+			),
+			"native"
+		)
+
+		s["n"]["user"]["i"].setValue( 3 )
+		s["n"]["user"]["f"].setValue( 3 )
+		self.assertEqual( s["n"]["user"]["o1"].getValue(), 7 )
+		self.assertEqual( s["n"]["user"]["o2"].getValue(), 1.5 )
+		self.assertEqual( s["n"]["user"]["o3"].getValue(), True )
+
+		s["n"]["user"]["b"].setValue( True )
+		self.assertEqual( s["n"]["user"]["o3"].getValue(), False )
+
+	def testPythonArithmeticSemantics( self ) :
+
+		s = self.__node( a = Gaffer.FloatPlug, b = Gaffer.IntPlug, c = Gaffer.IntPlug, d = Gaffer.FloatPlug )
+		s["e"].setExpression(
+			inspect.cleandoc(
+				"""
+				parent["n"]["user"]["a"] = 7 / 2
+				parent["n"]["user"]["b"] = 7 // 2
+				parent["n"]["user"]["c"] = -7 % 3
+				parent["n"]["user"]["d"] = 2 ** -1
+				"""
+			),
+			"native"
+		)
+
+		self.assertEqual( s["n"]["user"]["a"].getValue(), 3.5 )
+		self.assertEqual( s["n"]["user"]["b"].getValue(), 3 )
+		self.assertEqual( s["n"]["user"]["c"].getValue(), 2 )
+		self.assertEqual( s["n"]["user"]["d"].getValue(), 0.5 )
+
+	def testStringPlugs( self ) :
+
+		s = self.__node( i = Gaffer.StringPlug, o = Gaffer.StringPlug )
+		s["e"].setExpression( 'parent["n"]["user"]["o"] = parent["n"]["user"]["i"].upper() + "_" + str( len( parent["n"]["user"]["i"] ) )', "native" )
+
+		s["n"]["user"]["i"].setValue( "abc" )
+		self.assertEqual( s["n"]["user"]["o"].getValue(), "ABC_3" )
+
+	def testVectorAndColorPlugs( self ) :
+
+		s = self.__node(
+			v = Gaffer.V3fPlug, c = Gaffer.Color3fPlug,
+			ov = Gaffer.V3fPlug, oc = Gaffer.Color4fPlug, oi = Gaffer.V2iPlug, of = Gaffer.FloatPlug
+		)
+		s["e"].setExpression(
+			inspect.cleandoc(
+				"""
+				v = parent["n"]["user"]["v"]
+				parent["n"]["user"]["ov"] = v * 2 + V3f( 1 )
+				parent["n"]["user"]["oc"] = Color4f( parent["n"]["user"]["c"].r, 0.5, 0.25, 1 )
+				parent["n"]["user"]["oi"] = V2i( 3, 5 ) / 2
+				parent["n"]["user"]["of"] = v.y + v[2]
+				"""
+			),
+			"native"
+		)
+
+		s["n"]["user"]["v"].setValue( imath.V3f( 1, 2, 3 ) )
+		s["n"]["user"]["c"].setValue( imath.Color3f( 0.1, 0.2, 0.3 ) )
+
+		self.assertEqual( s["n"]["user"]["ov"].getValue(), imath.V3f( 3, 5, 7 ) )
+		self.assertEqual( s["n"]["user"]["oc"].getValue(), imath.Color4f( 0.1, 0.5, 0.25, 1 ) )
+		self.assertEqual( s["n"]["user"]["oi"].getValue(), imath.V2i( 1, 2 ) )
+		self.assertEqual( s["n"]["user"]["of"].getValue(), 5 )
+
+	def testWriteToCompoundChild( self ) :
+
+		s = self.__node( v = Gaffer.V3fPlug )
+		s["e"].setExpression( 'parent["n"]["user"]["v"]["y"] = 2', "native" )
+
+		self.assertEqual( s["n"]["user"]["v"].getValue(), imath.V3f( 0, 2, 0 ) )
+
+	def testContextAccess( self ) :
+
+		s = self.__node( f = Gaffer.FloatPlug, t = Gaffer.FloatPlug, s = Gaffer.StringPlug, d = Gaffer.StringPlug, v = Gaffer.V2fPlug )
+		s["e"].setExpression(
+			inspect.cleandoc(
+				"""
+				parent["n"]["user"]["f"] = context.getFrame()
+				parent["n"]["user"]["t"] = context.getTime()
+				parent["n"]["user"]["s"] = context["shot"]
+				parent["n"]["user"]["d"] = context.get( "sequence", "none" )
+				parent["n"]["user"]["v"] = context.get( "offset", V2f( 0 ) )
+				"""
+			),
+			"native"
+		)
+
+		with Gaffer.Context() as c :
+
+			c.setFrame( 12 )
+			c.setFramesPerSecond( 24 )
+			c["shot"] = "sh010"
+			self.assertEqual( s["n"]["user"]["f"].getValue(), 12 )
+			self.assertEqual( s["n"]["user"]["t"].getValue(), 0.5 )
+			self.assertEqual( s["n"]["user"]["s"].getValue(), "sh010" )
+			self.assertEqual( s["n"]["user"]["d"].getValue(), "none" )
+			self.assertEqual( s["n"]["user"]["v"].getValue(), imath.V2f( 0 ) )
+
+			c["shot"] = "sh020"
+			c["sequence"] = "sq01"
+			c["offset"] = imath.V2f( 1, 2 )
+			self.assertEqual( s["n"]["user"]["s"].getValue(), "sh020" )
+			self.assertEqual( s["n"]["user"]["d"].getValue(), "sq01" )
+			self.assertEqual( s["n"]["user"]["v"].getValue(), imath.V2f( 1, 2 ) )
+
+			del c["shot"]
+			with self.assertRaisesRegex( Gaffer.ProcessException, 'Context has no variable named "shot"' ) :
+				s["n"]["user"]["s"].getValue()
+
+	def testConditionals( self ) :
+
+		s = self.__node( o = Gaffer.StringPlug, i = Gaffer.IntPlug )
+		s["e"].setExpression(
+			inspect.cleandoc(
+				"""
+				frame = context.getFrame()
+				if frame > 10 :
+					parent["n"]["user"]["o"] = "late"
+				elif 0 < frame <= 10 :
+					parent["n"]["user"]["o"] = "early"
+				else :
+					parent["n"]["user"]["o"] = "never"
+				parent["n"]["user"]["i"] = 1 if "shot" in context else 2
+				"""
+			),
+			"native"
+		)
+
+		with Gaffer.Context() as c :
+
+			for frame, expected in [ ( 20, "late" ), ( 5, "early" ), ( -1, "never" ) ] :
+				c.setFrame( frame )
+				self.assertEqual( s["n"]["user"]["o"].getValue(), expected )
+
+			self.assertEqual( s["n"]["user"]["i"].getValue(), 2 )
+			c["shot"] = "sh010"
+			self.assertEqual( s["n"]["user"]["i"].getValue(), 1 )
+
+	def testStringFormatting( self ) :
+
+		s = self.__node( a = Gaffer.StringPlug, b = Gaffer.StringPlug, c = Gaffer.StringPlug )
+		s["e"].setExpression(
+			inspect.cleandoc(
+				"""
+				frame = context.getFrame()
+				parent["n"]["user"]["a"] = "%s.%04d.exr" % ( context["shot"], frame )
+				parent["n"]["user"]["b"] = "{}.{:04d}.{:.2f}".format( context["shot"], int( frame ), frame / 3 )
+				parent["n"]["user"]["c"] = f"{context['shot']}_{int( frame ):03d}"
+				"""
+			),
+			"native"
+		)
+
+		with Gaffer.Context() as c :
+			c.setFrame( 7 )
+			c["shot"] = "sh010"
+			self.assertEqual( s["n"]["user"]["a"].getValue(), "sh010.0007.exr" )
+			self.assertEqual( s["n"]["user"]["b"].getValue(), "sh010.0007.2.33" )
+			self.assertEqual( s["n"]["user"]["c"].getValue(), "sh010_007" )
+
+	def testNoValueSetsDefault( self ) :
+
+		s = self.__node( o = Gaffer.IntPlug )
+		s["n"]["user"]["o"].setValue( 10 )
+		s["n"]["user"]["o"].resetDefault()
+
+		s["e"].setExpression(
+			inspect.cleandoc(
+				"""
+				if context.getFrame() > 10 :
+					parent["n"]["user"]["o"] = 20
+				"""
+			),
+			"native"
+		)
+
+		with Gaffer.Context() as c :
+			c.setFrame( 20 )
+			self.assertEqual( s["n"]["user"]["o"].getValue(), 20 )
+			c.setFrame( 1 )
+			self.assertEqual( s["n"]["user"]["o"].getValue(), 10 )
+
+	def testParseErrors( self ) :
+
+		s = self.__node( o = Gaffer.IntPlug )
+
+		with self.assertRaisesRegex( RuntimeError, "Line 2 : Unexpected end of line" ) :
+			s["e"].setExpression( 'a = 1\nparent["n"]["user"]["o"] = a +', "native" )
+
+		with self.assertRaisesRegex( RuntimeError, 'Name "b" is not defined' ) :
+			s["e"].setExpression( 'parent["n"]["user"]["o"] = b', "native" )
+
+		with self.assertRaisesRegex( RuntimeError, 'Unsupported function "eval"' ) :
+			s["e"].setExpression( 'parent["n"]["user"]["o"] = eval( "1" )', "native" )
+
+		with self.assertRaisesRegex( RuntimeError, "does not exist" ) :
+			s["e"].setExpression( 'parent["notANode"]["notAPlug"] = 1', "native" )
+
+		self.assertEqual( s["e"].getExpression(), ( "", "" ) )
+
+	def testRuntimeErrors( self ) :
+
+		s = self.__node( i = Gaffer.IntPlug, o = Gaffer.FloatPlug, s = Gaffer.StringPlug )
+		s["e"].setExpression( 'parent["n"]["user"]["o"] = 1 / parent["n"]["user"]["i"]', "native" )
+
+		with self.assertRaisesRegex( Gaffer.ProcessException, "Division by zero" ) :
+			s["n"]["user"]["o"].getValue()
+
+		s["e"].setExpression( 'parent["n"]["user"]["s"] = 1', "native" )
+		with self.assertRaisesRegex( Gaffer.ProcessException, 'Cannot set "StringPlug" from value of type "int"' ) :
+			s["n"]["user"]["s"].getValue()
+
+	def testUnsupportedPlugs( self ) :
+
+		s = self.__node( o = Gaffer.M44fPlug )
+		with self.assertRaisesRegex( RuntimeError, "unsupported type" ) :
+			s["e"].setExpression( 'parent["n"]["user"]["o"] = 1', "native" )
+
+		self.assertEqual( s["e"].identifier( s["n"]["user"]["o"] ), "" )
+		self.assertEqual( Gaffer.Expression.defaultExpression( s["n"]["user"]["o"], "native" ), "" )
+
+	def testDefaultExpression( self ) :
+
+		s = self.__node(
+			b = Gaffer.BoolPlug, i = Gaffer.IntPlug, f = Gaffer.FloatPlug, s = Gaffer.StringPlug,
+			v = Gaffer.V3fPlug, vi = Gaffer.V2iPlug, c = Gaffer.Color4fPlug
+		)
+
+		s["n"]["user"]["b"].setValue( True )
+		s["n"]["user"]["i"].setValue( 10 )
+		s["n"]["user"]["f"].setValue( 0.1 )
+		s["n"]["user"]["s"].setValue( 'a "quoted" \\ string' )
+		s["n"]["user"]["v"].setValue( imath.V3f( 1, 2.5, 3 ) )
+		s["n"]["user"]["vi"].setValue( imath.V2i( 1, 2 ) )
+		s["n"]["user"]["c"].setValue( imath.Color4f( 0.1, 0.2, 0.3, 0.4 ) )
+
+		defaultExpressions = [ Gaffer.Expression.defaultExpression( p, "native" ) for p in s["n"]["user"].children() ]
+		expectedValues = [ p.getValue() for p in s["n"]["user"].children() ]
+
+		for p in s["n"]["user"].children() :
+			p.setToDefault()
+
+		for p, e, v in zip( s["n"]["user"].children(), defaultExpressions, expectedValues ) :
+			s["e"].setExpression( e, "native" )
+			self.assertEqual( p.getValue(), v )
+
+	def testIdentifier( self ) :
+
+		s = self.__node( i = Gaffer.FloatPlug, o = Gaffer.FloatPlug )
+		s["e"].setExpression(
+			"%s = %s + 1" % ( s["e"].identifier( s["n"]["user"]["o"] ), s["e"].identifier( s["n"]["user"]["i"] ) ),
+			"native"
+		)
+		self.assertEqual( s["e"].getExpression(), ( 'parent["n"]["user"]["o"] = parent["n"]["user"]["i"] + 1', "native" ) )
+		self.assertEqual( s["n"]["user"]["o"].getValue(), 1 )
+
+	def testRenamePlugs( self ) :
+
+		s = self.__node( i = Gaffer.FloatPlug, o = Gaffer.FloatPlug )
+		s["e"].setExpression( "parent['n']['user']['o'] = parent['n']['user']['i'] + 1", "native" )
+		self.assertEqual( s["n"]["user"]["o"].getValue(), 1 )
+
+		s["n"]["user"]["i"].setName( "I" )
+		s["n"]["user"]["o"].setName( "O" )
+
+		self.assertEqual( s["n"]["user"]["O"].getValue(), 1 )
+		self.assertEqual( s["e"].getExpression(), ( 'parent["n"]["user"]["O"] = parent["n"]["user"]["I"] + 1', "native" ) )
+
+	def testDeleteInputPlug( self ) :
+
+		s = self.__node( i = Gaffer.FloatPlug, o = Gaffer.FloatPlug )
+		s["n"]["user"]["i"].setValue( 1 )
+		s["e"].setExpression( 'parent["n"]["user"]["o"] = parent["n"]["user"]["i"] + 1', "native" )
+		self.assertEqual( s["n"]["user"]["o"].getValue(), 2 )
+
+		del s["n"]["user"]["i"]
+		self.assertEqual( s["e"].getExpression(), ( 'parent["n"]["user"]["o"] = 0.0 + 1', "native" ) )
+		self.assertEqual( s["n"]["user"]["o"].getValue(), 1 )
+
+	def testSerialisation( self ) :
+
+		s = self.__node( i = Gaffer.FloatPlug, o = Gaffer.FloatPlug )
+		s["e"].setExpression( 'parent["n"]["user"]["o"] = parent["n"]["user"]["i"] + 1', "native" )
+		s["n"]["user"]["i"].setValue( 1 )
+
+		serialisation = s.serialise()
+		self.assertNotIn( "Gaffernative", serialisation )
+
+		s2 = Gaffer.ScriptNode()
+		s2.execute( serialisation )
+
+		self.assertEqual( s2["e"].getExpression(), s["e"].getExpression() )
+		self.assertEqual( s2["n"]["user"]["o"].getValue(), 2 )
+		s2["n"]["user"]["i"].setValue( 2 )
+		self.assertEqual( s2["n"]["user"]["o"].getValue(), 3 )
+
+	def testConvertPythonExpression( self ) :
+
+		converted = Gaffer.NativeExpressionEngine.convertPythonExpression(
+			inspect.cleandoc(
+				"""
+				import imath
+				import math
+
+				parent["n"]["user"]["v"] = imath.V3f( math.floor( context.getFrame() / 2 ), 0, 0 )
+				"""
+			)
+		)
+		self.assertEqual( converted, 'parent["n"]["user"]["v"] = V3f( floor( context.getFrame() / 2 ), 0, 0 )' )
+
+		# Expressions using unsupported features can't be converted.
+		for expression in [
+			'parent["n"]["user"]["s"] = IECore.StringVectorData()',
+			'parent["n"]["user"]["i"] = sum( [ 1, 2 ] )',
+			'for i in range( 0, 10 ) : parent["n"]["user"]["i"] = i',
+		] :
+			self.assertEqual( Gaffer.NativeExpressionEngine.convertPythonExpression( expression ), "" )
+
+	def testConvertExpressionNode( self ) :
+
+		s = self.__node( i = Gaffer.IntPlug, o = Gaffer.StringPlug, m = Gaffer.M44fPlug )
+		s["e"].setExpression( 'parent["n"]["user"]["o"] = "%s_%d" % ( context.get( "shot", "x" ), parent["n"]["user"]["i"] )' )
+		s["n"]["user"]["i"].setValue( 2 )
+		self.assertEqual( s["n"]["user"]["o"].getValue(), "x_2" )
+
+		self.assertTrue( Gaffer.NativeExpressionEngine.convertPythonExpression( s["e"] ) )
+		self.assertEqual( s["e"].getExpression()[1], "native" )
+		self.assertEqual( s["n"]["user"]["o"].getValue(), "x_2" )
+
+		# Already converted.
+		self.assertFalse( Gaffer.NativeExpressionEngine.convertPythonExpression( s["e"] ) )
+
+		# Unsupported plug types are left alone.
+		s["e2"] = Gaffer.Expression()
+		s["e2"].setExpression( 'parent["n"]["user"]["m"] = imath.M44f()' )
+		self.assertFalse( Gaffer.NativeExpressionEngine.convertPythonExpression( s["e2"] ) )
+		self.assertEqual( s["e2"].getExpression()[1], "python" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testParallelPerformance( self ) :
+
+		s = self.__node( p = Gaffer.IntPlug )
+		s["e"].setExpression(
+			inspect.cleandoc(
+				"""
+				i = context["iteration"]
+				if i % 2 :
+					parent["n"]["user"]["p"] = len( "{}_{:04d}".format( "odd", i ) ) + i * 2
+				else :
+					parent["n"]["user"]["p"] = int( max( ( V3f( i ) / 2 ).x, 1 ) ) if i > 10 else i // 2
+				"""
+			),
+			"native"
+		)
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferTest.parallelGetValue( s["n"]["user"]["p"], 1000000, "iteration" )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -1047,6 +1047,317 @@ class ValuePlugTest( GafferTest.TestCase ) :
 					node["in"].setValue( i )
 					self.assertEqual( node["out"].getValue(), i )
 
+	def testCacheEvictionPolicy( self ) :
+
+		self.assertEqual( Gaffer.ValuePlug.getCacheEvictionPolicy(), Gaffer.ValuePlug.CacheEvictionPolicy.LRU )
+
+		for policy in Gaffer.ValuePlug.CacheEvictionPolicy.values.values() :
+			with self.subTest( policy = policy ) :
+
+				Gaffer.ValuePlug.setCacheEvictionPolicy( policy )
+				self.assertEqual( Gaffer.ValuePlug.getCacheEvictionPolicy(), policy )
+
+				# Force evictions by using a tiny cache, and check that
+				# we still get the right results.
+
+				Gaffer.ValuePlug.clearCache()
+				Gaffer.ValuePlug.setCacheMemoryLimit( 1024 )
+
+				nodes = []
+				for i in range( 0, 100 ) :
+					node = GafferTest.CachingTestNode()
+					node["in"].setValue( str( i ) )
+					nodes.append( node )
+
+				for i in range( 0, 3 ) :
+					for j, node in enumerate( nodes ) :
+						self.assertEqual( node["out"].getValue(), IECore.StringData( str( j ) ) )
+
+				self.assertLessEqual( Gaffer.ValuePlug.cacheMemoryUsage(), 1024 )
+				Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+
+	class DiskCachingTestNode( GafferTest.CachingTestNode ) :
+
+		def __init__( self, name="DiskCachingTestNode" ) :
+
+			GafferTest.CachingTestNode.__init__( self, name )
+
+			self.numComputeCalls = 0
+			# Maps from the value of `in` to the value to output, for
+			# testing types other than StringData.
+			self.values = {}
+			self.shareable = True
+
+		def compute( self, plug, context ) :
+
+			self.numComputeCalls += 1
+			value = self.values.get( self["in"].getValue() )
+			if value is not None :
+				self["out"].setValue( value )
+			else :
+				GafferTest.CachingTestNode.compute( self, plug, context )
+
+		def computeCachePolicy( self, plug ) :
+
+			return Gaffer.ValuePlug.CachePolicy.TaskCollaboration
+
+		def computeCacheShareable( self, plug ) :
+
+			return self.shareable
+
+	IECore.registerRunTimeTyped( DiskCachingTestNode )
+
+	def __isolateCacheDirectory( self, sizeLimit = 1024**3 ) :
+
+		# The disk and shared caches may already have been enabled
+		# via the environment, so we must restore them afterwards.
+		self.addCleanup( Gaffer.ValuePlug.setCacheDirectory, Gaffer.ValuePlug.getCacheDirectory(), Gaffer.ValuePlug.getCacheDirectorySizeLimit() )
+		self.addCleanup( Gaffer.ValuePlug.setSharedCache, Gaffer.ValuePlug.getSharedCacheName(), Gaffer.ValuePlug.getSharedCacheMemoryLimit() )
+		Gaffer.ValuePlug.setSharedCache( "", 0 )
+
+		cacheDirectory = self.temporaryDirectory() / "cache"
+		Gaffer.ValuePlug.setCacheDirectory( str( cacheDirectory ), sizeLimit )
+		return cacheDirectory
+
+	def testCacheDirectory( self ) :
+
+		cacheDirectory = self.__isolateCacheDirectory()
+		self.assertEqual( Gaffer.ValuePlug.getCacheDirectory(), str( cacheDirectory ) )
+		self.assertEqual( Gaffer.ValuePlug.getCacheDirectorySizeLimit(), 1024**3 )
+
+		node = self.DiskCachingTestNode()
+		node["in"].setValue( "d" )
+
+		# First compute populates both the memory and disk caches.
+
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "d" ) )
+		self.assertEqual( node.numComputeCalls, 1 )
+
+		# Clearing the memory cache should fall back to the disk cache
+		# rather than computing again.
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "d" ) )
+		self.assertEqual( node.numComputeCalls, 1 )
+
+		# A new input value requires a new compute.
+
+		node["in"].setValue( "e" )
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "e" ) )
+		self.assertEqual( node.numComputeCalls, 2 )
+
+		# Disabling the disk cache should force recomputation.
+
+		Gaffer.ValuePlug.setCacheDirectory( "", 0 )
+		self.assertEqual( Gaffer.ValuePlug.getCacheDirectory(), "" )
+		self.assertEqual( Gaffer.ValuePlug.getCacheDirectorySizeLimit(), 0 )
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "e" ) )
+		self.assertEqual( node.numComputeCalls, 3 )
+
+	def testCacheDirectoryValueTypes( self ) :
+
+		self.__isolateCacheDirectory()
+
+		node = self.DiskCachingTestNode()
+		node.values = {
+			"compoundObject" : IECore.CompoundObject( {
+				"a" : IECore.IntData( 1 ),
+				"b" : IECore.CompoundObject( {
+					"c" : IECore.V3fVectorData( [ imath.V3f( i, i * 0.5, -i ) for i in range( 100 ) ] ),
+				} ),
+			} ),
+			"compoundData" : IECore.CompoundData( {
+				"m" : IECore.M44fData( imath.M44f().translate( imath.V3f( 1, 2, 3 ) ) ),
+				"s" : IECore.StringVectorData( [ "a", "b" ] ),
+				"b" : IECore.Box3fData( imath.Box3f( imath.V3f( -1 ), imath.V3f( 1 ) ) ),
+			} ),
+			"floats" : IECore.FloatVectorData( [ 0.1 * i for i in range( 1000 ) ] ),
+			"null" : IECore.NullObject(),
+		}
+
+		for name, value in node.values.items() :
+
+			node["in"].setValue( name )
+			numComputeCalls = node.numComputeCalls
+			self.assertEqual( node["out"].getValue(), value )
+			self.assertEqual( node.numComputeCalls, numComputeCalls + 1 )
+
+			Gaffer.ValuePlug.clearCache()
+			self.assertEqual( node["out"].getValue(), value )
+			self.assertEqual( node.numComputeCalls, numComputeCalls + 1 )
+
+	def testCacheDirectoryRequiresShareable( self ) :
+
+		cacheDirectory = self.__isolateCacheDirectory()
+
+		node = self.DiskCachingTestNode()
+		node.shareable = False
+		node["in"].setValue( "d" )
+
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "d" ) )
+		self.assertEqual( node.numComputeCalls, 1 )
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "d" ) )
+		self.assertEqual( node.numComputeCalls, 2 )
+
+		self.assertFalse( cacheDirectory.exists() )
+
+	def testCacheDirectorySizeLimit( self ) :
+
+		sizeLimit = 64 * 1024
+		cacheDirectory = self.__isolateCacheDirectory( sizeLimit )
+
+		def directorySize() :
+			return sum( f.stat().st_size for f in cacheDirectory.glob( "**/*.bin" ) )
+
+		node = self.DiskCachingTestNode()
+		for i in range( 0, 40 ) :
+			node.values[str(i)] = IECore.FloatVectorData( [ i + 0.1 * j for j in range( 0, 2000 ) ] )
+
+		for i in range( 0, 40 ) :
+			node["in"].setValue( str( i ) )
+			node["out"].getValue()
+			self.assertLessEqual( directorySize(), sizeLimit )
+
+		self.assertEqual( node.numComputeCalls, 40 )
+		self.assertGreater( directorySize(), 0 )
+
+		# The most recent entry should have survived.
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), node.values["39"] )
+		self.assertEqual( node.numComputeCalls, 40 )
+
+		# But the oldest should have been removed.
+
+		node["in"].setValue( "0" )
+		self.assertEqual( node["out"].getValue(), node.values["0"] )
+		self.assertEqual( node.numComputeCalls, 41 )
+
+		# Values which would occupy a significant fraction of the
+		# cache aren't stored at all.
+
+		node.values["big"] = IECore.FloatVectorData( [ 0.1 * j for j in range( 0, sizeLimit ) ] )
+		node["in"].setValue( "big" )
+		node["out"].getValue()
+		Gaffer.ValuePlug.clearCache()
+		node["out"].getValue()
+		self.assertEqual( node.numComputeCalls, 43 )
+
+	def __isolateSharedCache( self ) :
+
+		# The disk and shared caches may already have been enabled
+		# via the environment, so we must restore them afterwards.
+		self.addCleanup( Gaffer.ValuePlug.setCacheDirectory, Gaffer.ValuePlug.getCacheDirectory(), Gaffer.ValuePlug.getCacheDirectorySizeLimit() )
+		self.addCleanup( Gaffer.ValuePlug.setSharedCache, Gaffer.ValuePlug.getSharedCacheName(), Gaffer.ValuePlug.getSharedCacheMemoryLimit() )
+		Gaffer.ValuePlug.setCacheDirectory( "", 0 )
+
+		sharedCacheName = "gafferValuePlugTest-{}".format( os.getpid() )
+		Gaffer.ValuePlug.removeSharedCache( sharedCacheName )
+		self.addCleanup( Gaffer.ValuePlug.removeSharedCache, sharedCacheName )
+
+		Gaffer.ValuePlug.setSharedCache( sharedCacheName, 16 * 1024 * 1024 )
+		return sharedCacheName
+
+	def testSharedCache( self ) :
+
+		sharedCacheName = self.__isolateSharedCache()
+		self.assertEqual( Gaffer.ValuePlug.getSharedCacheName(), sharedCacheName )
+		self.assertEqual( Gaffer.ValuePlug.getSharedCacheMemoryLimit(), 16 * 1024 * 1024 )
+
+		node = self.DiskCachingTestNode()
+		node["in"].setValue( "d" )
+
+		# First compute populates both the memory and shared caches.
+
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "d" ) )
+		self.assertEqual( node.numComputeCalls, 1 )
+
+		# Clearing the memory cache should fall back to the shared cache
+		# rather than computing again.
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "d" ) )
+		self.assertEqual( node.numComputeCalls, 1 )
+
+		# Another process using the same segment should be able to reuse
+		# the result without computing it.
+
+		script = self.temporaryDirectory() / "sharedCache.py"
+		script.write_text( inspect.cleandoc(
+			f"""
+			import Gaffer
+			import GafferTest
+			import IECore
+
+			Gaffer.ValuePlug.setSharedCache( "{sharedCacheName}", 16 * 1024 * 1024 )
+			node = GafferTest.ValuePlugTest.DiskCachingTestNode()
+			node["in"].setValue( "d" )
+			assert( node["out"].getValue() == IECore.StringData( "d" ) )
+			print( node.numComputeCalls, end = "" )
+			"""
+		) )
+
+		output = subprocess.check_output( [ str( Gaffer.executablePath() ), "env", "python", str( script ) ], text = True )
+		self.assertEqual( output, "0" )
+
+		# Disabling the shared cache should force recomputation.
+
+		Gaffer.ValuePlug.setSharedCache( "", 0 )
+		self.assertEqual( Gaffer.ValuePlug.getSharedCacheName(), "" )
+		self.assertEqual( Gaffer.ValuePlug.getSharedCacheMemoryLimit(), 0 )
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "d" ) )
+		self.assertEqual( node.numComputeCalls, 2 )
+
+	def testSharedCacheValueTypes( self ) :
+
+		self.__isolateSharedCache()
+
+		node = self.DiskCachingTestNode()
+		node.values = {
+			"compoundObject" : IECore.CompoundObject( {
+				"a" : IECore.IntData( 1 ),
+				"b" : IECore.CompoundObject( {
+					"c" : IECore.V3fVectorData( [ imath.V3f( i, i * 0.5, -i ) for i in range( 100 ) ] ),
+				} ),
+			} ),
+			"compoundData" : IECore.CompoundData( {
+				"m" : IECore.M44fData( imath.M44f().translate( imath.V3f( 1, 2, 3 ) ) ),
+				"s" : IECore.StringVectorData( [ "a", "b" ] ),
+			} ),
+			"floats" : IECore.FloatVectorData( [ 0.1 * i for i in range( 1000 ) ] ),
+			# Too big to be worth storing, since it would occupy
+			# more than a quarter of the segment.
+			"big" : IECore.FloatVectorData( [ 0.1 * i for i in range( 0, 1024 * 1024 * 2 ) ] ),
+		}
+
+		for name, value in node.values.items() :
+
+			node["in"].setValue( name )
+			numComputeCalls = node.numComputeCalls
+			self.assertEqual( node["out"].getValue(), value )
+			self.assertEqual( node.numComputeCalls, numComputeCalls + 1 )
+
+			Gaffer.ValuePlug.clearCache()
+			self.assertEqual( node["out"].getValue(), value )
+			self.assertEqual( node.numComputeCalls, numComputeCalls + ( 2 if name == "big" else 1 ) )
+
+	def testSharedCacheRequiresShareable( self ) :
+
+		self.__isolateSharedCache()
+
+		node = self.DiskCachingTestNode()
+		node.shareable = False
+		node["in"].setValue( "d" )
+
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "d" ) )
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( node["out"].getValue(), IECore.StringData( "d" ) )
+		self.assertEqual( node.numComputeCalls, 2 )
+
 	def setUp( self ) :
 
 		GafferTest.TestCase.setUp( self )
@@ -1058,6 +1369,7 @@ class ValuePlugTest( GafferTest.TestCase ) :
 		GafferTest.TestCase.tearDown( self )
 
 		Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+		Gaffer.ValuePlug.setCacheEvictionPolicy( Gaffer.ValuePlug.CacheEvictionPolicy.LRU )
 
 if __name__ == "__main__":
 	unittest.main()
@@ -95,6 +95,7 @@ from .CapturingSlot import CapturingSlot
 from .NodeBindingTest import NodeBindingTest
 from .DictPathTest import DictPathTest
 from .ExpressionTest import ExpressionTest
+from .NativeExpressionEngineTest import NativeExpressionEngineTest
 from .BlockedConnectionTest import BlockedConnectionTest
 from .TimeWarpTest import TimeWarpTest
 from .TransformPlugTest import TransformPlugTest
@@ -162,6 +163,8 @@ from .OptionalValuePlugTest import OptionalValuePlugTest
 from .ThreadMonitorTest import ThreadMonitorTest
 from .CollectTest import CollectTest
 from .ProcessTest import ProcessTest
+from .CacheMonitorTest import CacheMonitorTest
+from .MemoryPressureTest import MemoryPressureTest
 from .PatternMatchTest import PatternMatchTest
 
 from .IECorePreviewTest import *
@@ -379,3 +379,5 @@ def __pythonCompleter( node ) :
 
 ExpressionWidget.registerHighlighter( "python", lambda node : GafferUI.CodeWidget.PythonHighlighter() )
 ExpressionWidget.registerCommentPrefix( "python", "#" )
+ExpressionWidget.registerHighlighter( "native", lambda node : GafferUI.CodeWidget.PythonHighlighter() )
+ExpressionWidget.registerCommentPrefix( "native", "#" )
@@ -0,0 +1,192 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+
+#include "Gaffer/CacheMonitor.h"
+
+#include "Gaffer/Node.h"
+#include "Gaffer/Plug.h"
+#include "Gaffer/ValuePlug.h"
+
+using namespace Gaffer;
+
+namespace
+{
+
+CacheMonitor::Statistics g_emptyStatistics;
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// CacheMonitor::Statistics
+//////////////////////////////////////////////////////////////////////////
+
+CacheMonitor::Statistics::Statistics( size_t hashHits, size_t hashMisses, size_t hashWaits, size_t computeHits, size_t computeMisses, size_t computeWaits )
+	:	hashHits( hashHits ), hashMisses( hashMisses ), hashWaits( hashWaits ),
+		computeHits( computeHits ), computeMisses( computeMisses ), computeWaits( computeWaits )
+{
+}
+
+CacheMonitor::Statistics & CacheMonitor::Statistics::operator += ( const Statistics &rhs )
+{
+	hashHits += rhs.hashHits;
+	hashMisses += rhs.hashMisses;
+	hashWaits += rhs.hashWaits;
+	computeHits += rhs.computeHits;
+	computeMisses += rhs.computeMisses;
+	computeWaits += rhs.computeWaits;
+	return *this;
+}
+
+bool CacheMonitor::Statistics::operator == ( const Statistics &rhs ) const
+{
+	return
+		hashHits == rhs.hashHits &&
+		hashMisses == rhs.hashMisses &&
+		hashWaits == rhs.hashWaits &&
+		computeHits == rhs.computeHits &&
+		computeMisses == rhs.computeMisses &&
+		computeWaits == rhs.computeWaits
+	;
+}
+
+bool CacheMonitor::Statistics::operator != ( const Statistics &rhs ) const
+{
+	return !( *this == rhs );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// CacheMonitor
+//////////////////////////////////////////////////////////////////////////
+
+CacheMonitor::CacheMonitor()
+	:	m_initialComputeCacheEvictions( ValuePlug::cacheEvictions() ),
+		m_initialComputeCacheEvictedMemory( ValuePlug::cacheEvictedMemory() ),
+		m_initialHashCacheEvictions( ValuePlug::hashCacheTotalEvictions() )
+{
+}
+
+CacheMonitor::~CacheMonitor()
+{
+}
+
+const CacheMonitor::StatisticsMap &CacheMonitor::allStatistics() const
+{
+	collate();
+	return m_statistics;
+}
+
+const CacheMonitor::Statistics &CacheMonitor::nodeTypeStatistics( const std::string &nodeTypeName ) const
+{
+	collate();
+	auto it = m_statistics.find( nodeTypeName );
+	if( it == m_statistics.end() )
+	{
+		return g_emptyStatistics;
+	}
+	return it->second;
+}
+
+const CacheMonitor::Statistics &CacheMonitor::combinedStatistics() const
+{
+	collate();
+	return m_combinedStatistics;
+}
+
+size_t CacheMonitor::computeCacheEvictions() const
+{
+	return ValuePlug::cacheEvictions() - m_initialComputeCacheEvictions;
+}
+
+size_t CacheMonitor::computeCacheEvictedMemory() const
+{
+	return ValuePlug::cacheEvictedMemory() - m_initialComputeCacheEvictedMemory;
+}
+
+size_t CacheMonitor::hashCacheEvictions() const
+{
+	return ValuePlug::hashCacheTotalEvictions() - m_initialHashCacheEvictions;
+}
+
+void CacheMonitor::processStarted( const Process *process )
+{
+}
+
+void CacheMonitor::processFinished( const Process *process )
+{
+}
+
+void CacheMonitor::cacheLookup( const Plug *plug, const IECore::InternedString &processType, CacheLookup lookup )
+{
+	const Node *node = plug->node();
+	if( !node )
+	{
+		return;
+	}
+
+	Statistics &statistics = m_threadData.local().statistics[node->typeId()];
+	if( processType == ValuePlug::hashProcessType() )
+	{
+		switch( lookup )
+		{
+			case CacheLookup::Hit : statistics.hashHits++; break;
+			case CacheLookup::Miss : statistics.hashMisses++; break;
+			case CacheLookup::Wait : statistics.hashWaits++; break;
+		}
+	}
+	else if( processType == ValuePlug::computeProcessType() )
+	{
+		switch( lookup )
+		{
+			case CacheLookup::Hit : statistics.computeHits++; break;
+			case CacheLookup::Miss : statistics.computeMisses++; break;
+			case CacheLookup::Wait : statistics.computeWaits++; break;
+		}
+	}
+}
+
+void CacheMonitor::collate() const
+{
+	for( auto &threadData : m_threadData )
+	{
+		for( const auto &[typeId, statistics] : threadData.statistics )
+		{
+			m_statistics[IECore::RunTimeTyped::typeNameFromTypeId( typeId )] += statistics;
+			m_combinedStatistics += statistics;
+		}
+		threadData.statistics.clear();
+	}
+}
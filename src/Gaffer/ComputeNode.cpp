@@ -91,3 +91,13 @@ ValuePlug::CachePolicy ComputeNode::computeCachePolicy( const ValuePlug *output
 	}
 	return ValuePlug::CachePolicy::Default;
 }
+
+const ValuePlug::CacheCodec *ComputeNode::computeCacheCodec( const ValuePlug *output ) const
+{
+	return nullptr;
+}
+
+bool ComputeNode::computeCacheShareable( const ValuePlug *output ) const
+{
+	return false;
+}
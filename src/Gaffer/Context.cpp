@@ -229,7 +229,7 @@ static InternedString g_frame( "frame" );
 static InternedString g_framesPerSecond( "framesPerSecond" );
 
 Context::Context()
-	:	m_changedSignal( nullptr ), m_hashValid( false ), m_canceller( nullptr )
+	:	m_changedSignal( nullptr ), m_hash( 0, 0 ), m_canceller( nullptr )
 {
 	set( g_frame, 1.0f );
 	set( g_framesPerSecond, 24.0f );
@@ -242,8 +242,7 @@ Context::Context( const Context &other )
 
 Context::Context( const Context &other, CopyMode mode )
 	:	m_changedSignal( nullptr ),
-		m_hash( other.m_hash ),
-		m_hashValid( other.m_hashValid ),
+		m_hash( 0, 0 ),
 		m_canceller( other.m_canceller )
 {
 	// Reserving one extra spot before we copy in the existing variables means that we will
@@ -255,6 +254,7 @@ Context::Context( const Context &other, CopyMode mode )
 	if( mode == CopyMode::NonOwning )
 	{
 		m_map = other.m_map;
+		m_hash = other.m_hash;
 	}
 	else
 	{
@@ -311,6 +311,82 @@ Context::~Context()
 	delete m_changedSignal;
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Allocation
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Per-thread list of free blocks for reuse by `Context::operator new`. Blocks
+// freed on one thread may be reused on another, so each list remains bounded
+// by `g_maxFreeBlocks` regardless of the pattern of allocation.
+//
+// This is deliberately trivially destructible, so that it remains valid for
+// contexts deleted during thread exit. The blocks themselves are freed by
+// `FreeListCleanup`.
+struct FreeList
+{
+	void *head;
+	size_t size;
+	bool disabled;
+};
+
+thread_local FreeList g_freeList = { nullptr, 0, false };
+constexpr size_t g_maxFreeBlocks = 256;
+
+struct FreeListCleanup
+{
+	~FreeListCleanup()
+	{
+		g_freeList.disabled = true;
+		while( g_freeList.head )
+		{
+			void *next = *static_cast<void **>( g_freeList.head );
+			::operator delete( g_freeList.head );
+			g_freeList.head = next;
+		}
+		g_freeList.size = 0;
+	}
+
+	// Called to ensure the destructor is registered for
+	// the current thread.
+	void touch()
+	{
+	}
+};
+
+thread_local FreeListCleanup g_freeListCleanup;
+
+} // namespace
+
+void *Context::operator new( size_t size )
+{
+	FreeList &freeList = g_freeList;
+	if( size == sizeof( Context ) && freeList.head )
+	{
+		void *result = freeList.head;
+		freeList.head = *static_cast<void **>( result );
+		freeList.size--;
+		return result;
+	}
+	return ::operator new( size );
+}
+
+void Context::operator delete( void *p, size_t size )
+{
+	FreeList &freeList = g_freeList;
+	if( size == sizeof( Context ) && freeList.size < g_maxFreeBlocks && !freeList.disabled )
+	{
+		g_freeListCleanup.touch();
+		*static_cast<void **>( p ) = freeList.head;
+		freeList.head = p;
+		freeList.size++;
+		return;
+	}
+	::operator delete( p );
+}
+
 void Context::set( const IECore::InternedString &name, const IECore::Data *value )
 {
 	// We copy the value so that the client can't invalidate this context by changing it.
@@ -338,8 +414,8 @@ void Context::remove( const IECore::InternedString &name )
 	Map::iterator it = m_map.find( name );
 	if( it != m_map.end() )
 	{
+		updateHash( it->second.hash(), MurmurHash( 0, 0 ) );
 		m_map.erase( it );
-		m_hashValid = false;
 		if( m_changedSignal )
 		{
 			(*m_changedSignal)( this, name );
@@ -358,8 +434,8 @@ void Context::removeMatching( const StringAlgo::MatchPattern &pattern )
 	{
 		if( StringAlgo::matchMultiple( it->first, pattern ) )
 		{
+			updateHash( it->second.hash(), MurmurHash( 0, 0 ) );
 			it = m_map.erase( it );
-			m_hashValid = false;
 			if( m_changedSignal )
 			{
 				(*m_changedSignal)( this, it->first );
@@ -425,25 +501,6 @@ Context::ChangedSignal &Context::changedSignal()
 	return *m_changedSignal;
 }
 
-IECore::MurmurHash Context::hash() const
-{
-	if( m_hashValid )
-	{
-		return m_hash;
-	}
-
-	uint64_t sumH1 = 0, sumH2 = 0;
-	for( Map::const_iterator it = m_map.begin(), eIt = m_map.end(); it != eIt; ++it )
-	{
-		sumH1 += it->second.hash().h1();
-		sumH2 += it->second.hash().h2();
-	}
-
-	m_hash = MurmurHash( sumH1, sumH2 );
-	m_hashValid = true;
-	return m_hash;
-}
-
 bool Context::operator == ( const Context &other ) const
 {
 	return this == &other || m_map == other.m_map;
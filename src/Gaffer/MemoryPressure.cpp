@@ -0,0 +1,335 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Gaffer/MemoryPressure.h"
+
+#include "IECore/MessageHandler.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <optional>
+
+#ifdef __linux__
+	#include <unistd.h>
+#endif
+
+using namespace Gaffer;
+
+namespace
+{
+
+// Memory statistics are read from the filesystem, so we
+// limit how often we sample them.
+const std::chrono::milliseconds g_sampleInterval( 250 );
+
+std::atomic_bool g_enabled( false );
+std::atomic<float> g_targetFraction( 0.85f );
+std::atomic<std::chrono::steady_clock::rep> g_lastSample( 0 );
+
+struct Handlers
+{
+	// Guards `map`, and serialises calls to the handlers.
+	std::mutex mutex;
+	std::map<std::string, MemoryPressure::Handler> map;
+};
+
+Handlers &handlers()
+{
+	static Handlers h;
+	return h;
+}
+
+void callHandler( const std::string &name, const MemoryPressure::Handler &handler, size_t usage, size_t target )
+{
+	try
+	{
+		handler( usage, target );
+	}
+	catch( const std::exception &e )
+	{
+		IECore::msg( IECore::Msg::Error, "MemoryPressure", fmt::format( "Handler \"{}\" : {}", name, e.what() ) );
+	}
+}
+
+#ifdef __linux__
+
+// Returns the first value in `file`, or `nullopt` if the
+// file can't be read or doesn't contain a number (as is
+// the case for a `memory.max` of "max").
+std::optional<size_t> readValue( const std::filesystem::path &file )
+{
+	std::ifstream stream( file );
+	size_t value;
+	if( stream >> value )
+	{
+		return value;
+	}
+	return std::nullopt;
+}
+
+// Returns the value for `key` from a file consisting of
+// lines of the form "key value", as used by `memory.stat`
+// and `/proc/meminfo`.
+std::optional<size_t> readKeyedValue( const std::filesystem::path &file, const std::string &key )
+{
+	std::ifstream stream( file );
+	std::string k;
+	size_t value;
+	while( stream >> k >> value )
+	{
+		if( k == key )
+		{
+			return value;
+		}
+		stream.ignore( std::numeric_limits<std::streamsize>::max(), '\n' );
+	}
+	return std::nullopt;
+}
+
+// Returns the cgroup v2 directory for this process.
+const std::filesystem::path &cgroupDirectory()
+{
+	static const std::filesystem::path g_directory = [] {
+		std::ifstream stream( "/proc/self/cgroup" );
+		std::string line;
+		while( std::getline( stream, line ) )
+		{
+			// The unified hierarchy is listed with a hierarchy ID of 0
+			// and no controllers.
+			if( line.compare( 0, 3, "0::" ) == 0 )
+			{
+				return std::filesystem::path( "/sys/fs/cgroup" ) / std::filesystem::path( line.substr( 3 ) ).relative_path();
+			}
+		}
+		return std::filesystem::path();
+	}();
+	return g_directory;
+}
+
+struct CgroupLimit
+{
+	std::filesystem::path directory;
+	size_t limit;
+};
+
+// Returns the most restrictive `memory.max` limit from this
+// process's cgroup and its ancestors.
+std::optional<CgroupLimit> cgroupLimit()
+{
+	std::optional<CgroupLimit> result;
+	std::filesystem::path directory = cgroupDirectory();
+	if( directory.empty() )
+	{
+		return result;
+	}
+
+	while( true )
+	{
+		if( auto limit = readValue( directory / "memory.max" ) )
+		{
+			if( !result || *limit < result->limit )
+			{
+				result = CgroupLimit{ directory, *limit };
+			}
+		}
+		if( directory == "/sys/fs/cgroup" || !directory.has_relative_path() )
+		{
+			break;
+		}
+		directory = directory.parent_path();
+	}
+
+	return result;
+}
+
+size_t physicalMemory()
+{
+	return (size_t)sysconf( _SC_PHYS_PAGES ) * (size_t)sysconf( _SC_PAGE_SIZE );
+}
+
+#endif
+
+} // namespace
+
+size_t MemoryPressure::memoryLimit()
+{
+#ifdef __linux__
+	const size_t physical = physicalMemory();
+	if( auto cgroup = cgroupLimit() )
+	{
+		return std::min( cgroup->limit, physical );
+	}
+	return physical;
+#else
+	return 0;
+#endif
+}
+
+size_t MemoryPressure::memoryUsage()
+{
+#ifdef __linux__
+	if( auto cgroup = cgroupLimit() )
+	{
+		// This is the same "working set" measure used by container
+		// orchestrators. Inactive file cache is reclaimed by the kernel
+		// before resorting to the OOM killer, so we don't count it.
+		const size_t current = readValue( cgroup->directory / "memory.current" ).value_or( 0 );
+		const size_t inactiveFile = readKeyedValue( cgroup->directory / "memory.stat", "inactive_file" ).value_or( 0 );
+		return current > inactiveFile ? current - inactiveFile : 0;
+	}
+
+	// No cgroup limit, so we're sharing the host with everything else. Values
+	// in `/proc/meminfo` are in kilobytes.
+	const size_t total = readKeyedValue( "/proc/meminfo", "MemTotal:" ).value_or( 0 );
+	const size_t available = readKeyedValue( "/proc/meminfo", "MemAvailable:" ).value_or( total );
+	return ( total - std::min( total, available ) ) * 1024;
+#else
+	return 0;
+#endif
+}
+
+void MemoryPressure::setEnabled( bool enabled )
+{
+	if( g_enabled.exchange( enabled ) == enabled || enabled )
+	{
+		return;
+	}
+
+	// Return all caches to their upper bounds.
+	Handlers &h = handlers();
+	std::lock_guard<std::mutex> lock( h.mutex );
+	for( const auto &[name, handler] : h.map )
+	{
+		callHandler( name, handler, 0, 0 );
+	}
+}
+
+bool MemoryPressure::getEnabled()
+{
+	return g_enabled;
+}
+
+void MemoryPressure::setTargetFraction( float fraction )
+{
+	g_targetFraction = fraction;
+}
+
+float MemoryPressure::getTargetFraction()
+{
+	return g_targetFraction;
+}
+
+void MemoryPressure::registerHandler( const std::string &name, const Handler &handler )
+{
+	Handlers &h = handlers();
+	std::lock_guard<std::mutex> lock( h.mutex );
+	h.map[name] = handler;
+}
+
+void MemoryPressure::deregisterHandler( const std::string &name )
+{
+	Handlers &h = handlers();
+	std::lock_guard<std::mutex> lock( h.mutex );
+	auto it = h.map.find( name );
+	if( it == h.map.end() )
+	{
+		return;
+	}
+
+	callHandler( it->first, it->second, 0, 0 );
+	h.map.erase( it );
+}
+
+void MemoryPressure::update( bool force )
+{
+	if( !g_enabled )
+	{
+		return;
+	}
+
+	// Claim the sample, so that only one thread at a time takes one.
+
+	const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+	auto lastSample = g_lastSample.load();
+	if( !force )
+	{
+		if(
+			now - lastSample < std::chrono::duration_cast<std::chrono::steady_clock::duration>( g_sampleInterval ).count() ||
+			!g_lastSample.compare_exchange_strong( lastSample, now )
+		)
+		{
+			return;
+		}
+	}
+	else
+	{
+		g_lastSample = now;
+	}
+
+	const size_t limit = memoryLimit();
+	if( !limit )
+	{
+		return;
+	}
+
+	const size_t usage = memoryUsage();
+	const size_t target = (size_t)( (double)limit * std::clamp( g_targetFraction.load(), 0.0f, 1.0f ) );
+
+	Handlers &h = handlers();
+	std::unique_lock<std::mutex> lock( h.mutex, std::defer_lock );
+	if( force )
+	{
+		lock.lock();
+	}
+	else if( !lock.try_lock() )
+	{
+		return;
+	}
+
+	for( const auto &[name, handler] : h.map )
+	{
+		// Avoid passing a zero target, which has special meaning.
+		callHandler( name, handler, usage, std::max<size_t>( target, 1 ) );
+	}
+}
@@ -129,3 +129,7 @@ bool Monitor::forceMonitoring( const Gaffer::Plug *plug, const IECore::InternedS
 {
 	return false;
 }
+
+void Monitor::cacheLookup( const Gaffer::Plug *plug, const IECore::InternedString &processType, CacheLookup lookup )
+{
+}
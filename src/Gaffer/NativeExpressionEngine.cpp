@@ -0,0 +1,3378 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Gaffer/NativeExpressionEngine.h"
+
+#include "Gaffer/CompoundNumericPlug.h"
+#include "Gaffer/Context.h"
+#include "Gaffer/Expression.h"
+#include "Gaffer/NumericPlug.h"
+#include "Gaffer/StringPlug.h"
+
+#include "IECore/NullObject.h"
+#include "IECore/SimpleTypedData.h"
+
+#include "boost/algorithm/string/case_conv.hpp"
+#include "boost/algorithm/string/predicate.hpp"
+#include "boost/algorithm/string/replace.hpp"
+#include "boost/algorithm/string/trim.hpp"
+#include "boost/container/small_vector.hpp"
+#include "boost/regex.hpp"
+
+#include "fmt/format.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace std;
+using namespace Imath;
+using namespace IECore;
+using namespace Gaffer;
+
+//////////////////////////////////////////////////////////////////////////
+// Values
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+enum class Type : unsigned char
+{
+	None,
+	Bool,
+	Int,
+	Float,
+	String,
+	V2i,
+	V3i,
+	V2f,
+	V3f,
+	Color3f,
+	Color4f
+};
+
+const char *typeName( Type type )
+{
+	switch( type )
+	{
+		case Type::None : return "NoneType";
+		case Type::Bool : return "bool";
+		case Type::Int : return "int";
+		case Type::Float : return "float";
+		case Type::String : return "str";
+		case Type::V2i : return "V2i";
+		case Type::V3i : return "V3i";
+		case Type::V2f : return "V2f";
+		case Type::V3f : return "V3f";
+		case Type::Color3f : return "Color3f";
+		case Type::Color4f : return "Color4f";
+	}
+	return "";
+}
+
+// Returns the number of numeric components, or 0 for
+// non-numeric types.
+int dimension( Type type )
+{
+	switch( type )
+	{
+		case Type::Bool :
+		case Type::Int :
+		case Type::Float :
+			return 1;
+		case Type::V2i :
+		case Type::V2f :
+			return 2;
+		case Type::V3i :
+		case Type::V3f :
+		case Type::Color3f :
+			return 3;
+		case Type::Color4f :
+			return 4;
+		default :
+			return 0;
+	}
+}
+
+bool isIntegral( Type type )
+{
+	return type == Type::Bool || type == Type::Int || type == Type::V2i || type == Type::V3i;
+}
+
+Type floatType( Type type )
+{
+	switch( type )
+	{
+		case Type::Bool :
+		case Type::Int :
+			return Type::Float;
+		case Type::V2i :
+			return Type::V2f;
+		case Type::V3i :
+			return Type::V3f;
+		default :
+			return type;
+	}
+}
+
+// The value held in a register. Numeric components are stored as
+// doubles regardless of type, so that the same code can operate on
+// ints and floats. Doubles represent all ints up to `g_maxInt` exactly,
+// and `checkInt()` raises an error rather than lose precision beyond that.
+struct Value
+{
+
+	Value()
+		:	type( Type::None ), v{ 0, 0, 0, 0 }
+	{
+	}
+
+	Value( Type type, double x )
+		:	type( type ), v{ x, 0, 0, 0 }
+	{
+	}
+
+	explicit Value( const std::string &s )
+		:	type( Type::String ), v{ 0, 0, 0, 0 }, s( s )
+	{
+	}
+
+	Type type;
+	double v[4];
+	std::string s;
+
+};
+
+// 2^53, the largest magnitude for which every int is representable
+// as a double.
+constexpr double g_maxInt = 9007199254740992.0;
+
+double checkInt( double i )
+{
+	if( std::abs( i ) > g_maxInt )
+	{
+		throw IECore::Exception( fmt::format( "Integer {} is too large", i ) );
+	}
+	return i;
+}
+
+Value boolValue( bool b )
+{
+	return Value( Type::Bool, b );
+}
+
+Value intValue( double i )
+{
+	return Value( Type::Int, checkInt( i ) );
+}
+
+Value floatValue( double f )
+{
+	return Value( Type::Float, f );
+}
+
+// Returns a scalar of the appropriate type for a
+// component of `type`.
+Value componentValue( Type type, double x )
+{
+	return Value( isIntegral( type ) ? Type::Int : Type::Float, x );
+}
+
+template<typename T>
+void setVector( Value &value, Type type, const T &v )
+{
+	value.type = type;
+	for( unsigned i = 0; i < T::dimensions(); ++i )
+	{
+		value.v[i] = v[i];
+	}
+}
+
+template<typename T>
+T getVector( const Value &value )
+{
+	T result;
+	for( unsigned i = 0; i < T::dimensions(); ++i )
+	{
+		result[i] = static_cast<typename T::BaseType>( value.v[i] );
+	}
+	return result;
+}
+
+void setString( Value &value, const std::string &s )
+{
+	value.type = Type::String;
+	value.s = s;
+}
+
+// Equivalent to Python's `str()` for a float. Like Python, fmt uses the
+// shortest representation that round-trips, and switches to exponent
+// notation outside the range `[1e-4, 1e16)`. Python always includes a
+// decimal point.
+std::string floatString( double f )
+{
+	std::string result = fmt::format( "{}", f );
+	if( result.find_first_of( ".ein" ) == std::string::npos )
+	{
+		result += ".0";
+	}
+	return result;
+}
+
+// Formats a float component for use in source code. We format at float
+// precision, because that is the precision that plugs store, and `0.1`
+// is more readable than `0.10000000149011612`.
+std::string floatLiteral( double f )
+{
+	std::string result = fmt::format( "{}", static_cast<float>( f ) );
+	if( result.find_first_of( ".ein" ) == std::string::npos )
+	{
+		result += ".0";
+	}
+	return result;
+}
+
+std::string intString( double x )
+{
+	return fmt::format( "{}", static_cast<long long>( x ) );
+}
+
+// Equivalent to Python's `str()`. Imath's string formatting for float
+// vectors isn't something we can reproduce exactly, so we don't support
+// it at all.
+std::string toString( const Value &value )
+{
+	switch( value.type )
+	{
+		case Type::None :
+			return "None";
+		case Type::Bool :
+			return value.v[0] ? "True" : "False";
+		case Type::Int :
+			return intString( value.v[0] );
+		case Type::Float :
+			return floatString( value.v[0] );
+		case Type::String :
+			return value.s;
+		default :
+		{
+			if( !isIntegral( value.type ) )
+			{
+				throw IECore::Exception( fmt::format( "Cannot convert \"{}\" to a string", typeName( value.type ) ) );
+			}
+			std::string result = std::string( typeName( value.type ) ) + "(";
+			for( int i = 0, d = dimension( value.type ); i < d; ++i )
+			{
+				result += ( i ? ", " : "" ) + intString( value.v[i] );
+			}
+			return result + ")";
+		}
+	}
+}
+
+// Equivalent to Python's `repr()`.
+std::string repr( const Value &value )
+{
+	if( value.type != Type::String )
+	{
+		return toString( value );
+	}
+
+	std::string result = value.s;
+	boost::replace_all( result, "\\", "\\\\" );
+	boost::replace_all( result, "'", "\\'" );
+	boost::replace_all( result, "\n", "\\n" );
+	return "'" + result + "'";
+}
+
+// Returns source code in the expression language which
+// evaluates to `value`.
+std::string literal( const Value &value )
+{
+	switch( value.type )
+	{
+		case Type::String :
+		{
+			std::string result = value.s;
+			boost::replace_all( result, "\\", "\\\\" );
+			boost::replace_all( result, "\"", "\\\"" );
+			boost::replace_all( result, "\n", "\\n" );
+			return "\"" + result + "\"";
+		}
+		case Type::None :
+		case Type::Bool :
+		case Type::Int :
+			return toString( value );
+		case Type::Float :
+			return floatLiteral( value.v[0] );
+		default :
+		{
+			std::string result = std::string( typeName( value.type ) ) + "( ";
+			for( int i = 0, d = dimension( value.type ); i < d; ++i )
+			{
+				result += ( i ? ", " : "" ) + ( isIntegral( value.type ) ? intString( value.v[i] ) : floatLiteral( value.v[i] ) );
+			}
+			return result + " )";
+		}
+	}
+}
+
+bool truthy( const Value &value )
+{
+	if( value.type == Type::String )
+	{
+		return !value.s.empty();
+	}
+
+	for( int i = 0, d = dimension( value.type ); i < d; ++i )
+	{
+		if( value.v[i] != 0 )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+double number( const Value &value, const char *context )
+{
+	if( dimension( value.type ) != 1 )
+	{
+		throw IECore::Exception( fmt::format( "{} requires a number, not \"{}\"", context, typeName( value.type ) ) );
+	}
+	return value.v[0];
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Operators
+//////////////////////////////////////////////////////////////////////////
+
+enum class OpCode : unsigned char
+{
+	// result = constants[index]
+	LoadConstant,
+	// result = inputs[index]
+	LoadInput,
+	// result = context[names[index]], or registers[a] if the variable
+	// doesn't exist and `a != g_noRegister`.
+	LoadContext,
+	// result = names[index] in context
+	ContextContains,
+	// result = registers[a]
+	Copy,
+	// As for Copy, but may steal the value from `a`.
+	Move,
+	// result = op registers[a]
+	Negate,
+	Not,
+	// result = registers[a] op registers[b]
+	Add,
+	Subtract,
+	Multiply,
+	Divide,
+	FloorDivide,
+	Modulo,
+	Power,
+	Equal,
+	NotEqual,
+	Less,
+	LessEqual,
+	Greater,
+	GreaterEqual,
+	Subscript,
+	// result = registers[a][index]
+	Component,
+	// result = functions[index]( registers[a], ... registers[a+b-1] )
+	Call,
+	// Unconditional and conditional jumps to `index`, conditioned
+	// on registers[a].
+	Jump,
+	JumpIfFalse,
+	JumpIfTrue
+};
+
+const char *operatorName( OpCode op )
+{
+	switch( op )
+	{
+		case OpCode::Negate : return "-";
+		case OpCode::Add : return "+";
+		case OpCode::Subtract : return "-";
+		case OpCode::Multiply : return "*";
+		case OpCode::Divide : return "/";
+		case OpCode::FloorDivide : return "//";
+		case OpCode::Modulo : return "%";
+		case OpCode::Power : return "**";
+		case OpCode::Less : return "<";
+		case OpCode::LessEqual : return "<=";
+		case OpCode::Greater : return ">";
+		case OpCode::GreaterEqual : return ">=";
+		default : return "";
+	}
+}
+
+IECore::Exception unsupportedOperands( OpCode op, const Value &a, const Value &b )
+{
+	return IECore::Exception( fmt::format(
+		"Unsupported operand types for {} : \"{}\" and \"{}\"",
+		operatorName( op ), typeName( a.type ), typeName( b.type )
+	) );
+}
+
+// Applies `f` to corresponding components of `a` and `b`, broadcasting
+// scalars as necessary. The result has the type of the vector operand (or
+// the first operand if both are vectors), promoted to float if either operand
+// is a float or `floatResult` is true.
+template<typename F>
+Value componentwise( OpCode op, const Value &a, const Value &b, bool floatResult, F &&f )
+{
+	const int da = dimension( a.type );
+	const int db = dimension( b.type );
+	if( !da || !db || ( da > 1 && db > 1 && da != db ) )
+	{
+		throw unsupportedOperands( op, a, b );
+	}
+
+	Value result;
+	result.type = da >= db ? a.type : b.type;
+	if( result.type == Type::Bool )
+	{
+		result.type = Type::Int;
+	}
+	if( floatResult || !isIntegral( a.type ) || !isIntegral( b.type ) )
+	{
+		result.type = floatType( result.type );
+	}
+
+	const bool integral = isIntegral( result.type );
+	for( int i = 0, d = std::max( da, db ); i < d; ++i )
+	{
+		result.v[i] = f( a.v[da > 1 ? i : 0], b.v[db > 1 ? i : 0] );
+		if( integral )
+		{
+			checkInt( result.v[i] );
+		}
+	}
+
+	return result;
+}
+
+void checkDivisor( const Value &a, const Value &b )
+{
+	// Match Python by raising an error for scalar division by zero,
+	// but allow IEEE semantics for float vectors, to match Imath.
+	const int d = dimension( b.type );
+	for( int i = 0; i < d; ++i )
+	{
+		if( b.v[i] == 0 && ( d == 1 || isIntegral( a.type ) ) )
+		{
+			throw IECore::Exception( "Division by zero" );
+		}
+	}
+}
+
+Value arithmetic( OpCode op, const Value &a, const Value &b )
+{
+	switch( op )
+	{
+		case OpCode::Add :
+			return componentwise( op, a, b, false, [] ( double x, double y ) { return x + y; } );
+		case OpCode::Subtract :
+			return componentwise( op, a, b, false, [] ( double x, double y ) { return x - y; } );
+		case OpCode::Multiply :
+			return componentwise( op, a, b, false, [] ( double x, double y ) { return x * y; } );
+		case OpCode::Divide :
+		{
+			// Scalar division follows Python, always producing a float. Vector
+			// division follows Imath, where integer vectors use integer division.
+			checkDivisor( a, b );
+			const bool scalar = dimension( a.type ) == 1 && dimension( b.type ) == 1;
+			Value result = componentwise( op, a, b, scalar, [] ( double x, double y ) { return x / y; } );
+			if( isIntegral( result.type ) )
+			{
+				for( int i = 0, d = dimension( result.type ); i < d; ++i )
+				{
+					result.v[i] = std::trunc( result.v[i] );
+				}
+			}
+			return result;
+		}
+		case OpCode::FloorDivide :
+			checkDivisor( a, b );
+			return componentwise( op, a, b, false, [] ( double x, double y ) { return std::floor( x / y ); } );
+		case OpCode::Modulo :
+			// Python semantics, where the result takes the sign of the divisor.
+			checkDivisor( a, b );
+			return componentwise( op, a, b, false, [] ( double x, double y ) { return x - y * std::floor( x / y ); } );
+		case OpCode::Power :
+		{
+			// Negative powers of ints produce floats, as in Python.
+			bool negative = false;
+			for( int i = 0, d = dimension( b.type ); i < d; ++i )
+			{
+				negative = negative || b.v[i] < 0;
+			}
+			return componentwise( op, a, b, negative, [] ( double x, double y ) { return std::pow( x, y ); } );
+		}
+		default :
+			throw unsupportedOperands( op, a, b );
+	}
+}
+
+std::string percentFormat( const std::string &format, const Value *args, size_t numArgs );
+
+Value stringOperation( OpCode op, const Value &a, const Value &b )
+{
+	switch( op )
+	{
+		case OpCode::Add :
+			if( a.type == Type::String && b.type == Type::String )
+			{
+				return Value( a.s + b.s );
+			}
+			break;
+		case OpCode::Multiply :
+		{
+			const Value &s = a.type == Type::String ? a : b;
+			const Value &n = a.type == Type::String ? b : a;
+			if( n.type == Type::Int || n.type == Type::Bool )
+			{
+				Value result( "" );
+				for( int i = 0; i < n.v[0]; ++i )
+				{
+					result.s += s.s;
+				}
+				return result;
+			}
+			break;
+		}
+		case OpCode::Modulo :
+			if( a.type == Type::String )
+			{
+				return Value( percentFormat( a.s, &b, 1 ) );
+			}
+			break;
+		default :
+			break;
+	}
+	throw unsupportedOperands( op, a, b );
+}
+
+bool valuesEqual( const Value &a, const Value &b )
+{
+	if( a.type == Type::String || b.type == Type::String || a.type == Type::None || b.type == Type::None )
+	{
+		return a.type == b.type && a.s == b.s;
+	}
+
+	const int d = dimension( a.type );
+	if( d != dimension( b.type ) )
+	{
+		return false;
+	}
+	for( int i = 0; i < d; ++i )
+	{
+		if( a.v[i] != b.v[i] )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool compare( OpCode op, const Value &a, const Value &b )
+{
+	int c;
+	if( a.type == Type::String && b.type == Type::String )
+	{
+		c = a.s.compare( b.s );
+	}
+	else if( dimension( a.type ) == 1 && dimension( b.type ) == 1 )
+	{
+		c = a.v[0] < b.v[0] ? -1 : ( a.v[0] > b.v[0] ? 1 : 0 );
+	}
+	else
+	{
+		throw unsupportedOperands( op, a, b );
+	}
+
+	switch( op )
+	{
+		case OpCode::Less : return c < 0;
+		case OpCode::LessEqual : return c <= 0;
+		case OpCode::Greater : return c > 0;
+		default : return c >= 0;
+	}
+}
+
+Value component( const Value &value, double index )
+{
+	const int d = dimension( value.type );
+	if( value.type == Type::String )
+	{
+		const int size = value.s.size();
+		const int i = index < 0 ? index + size : index;
+		if( i < 0 || i >= size )
+		{
+			throw IECore::Exception( "String index out of range" );
+		}
+		return Value( std::string( 1, value.s[i] ) );
+	}
+	else if( d > 1 )
+	{
+		const int i = index < 0 ? index + d : index;
+		if( i < 0 || i >= d )
+		{
+			throw IECore::Exception( fmt::format( "Index out of range for \"{}\"", typeName( value.type ) ) );
+		}
+		return componentValue( value.type, value.v[i] );
+	}
+
+	throw IECore::Exception( fmt::format( "\"{}\" object is not subscriptable", typeName( value.type ) ) );
+}
+
+Value unaryOperation( OpCode op, const Value &a )
+{
+	if( op == OpCode::Not )
+	{
+		return boolValue( !truthy( a ) );
+	}
+
+	const int d = dimension( a.type );
+	if( !d )
+	{
+		throw IECore::Exception( fmt::format( "Bad operand type for unary - : \"{}\"", typeName( a.type ) ) );
+	}
+
+	Value result = a;
+	if( result.type == Type::Bool )
+	{
+		result.type = Type::Int;
+	}
+	for( int i = 0; i < d; ++i )
+	{
+		result.v[i] = -result.v[i];
+	}
+	return result;
+}
+
+Value binaryOperation( OpCode op, const Value &a, const Value &b )
+{
+	switch( op )
+	{
+		case OpCode::Equal :
+			return boolValue( valuesEqual( a, b ) );
+		case OpCode::NotEqual :
+			return boolValue( !valuesEqual( a, b ) );
+		case OpCode::Less :
+		case OpCode::LessEqual :
+		case OpCode::Greater :
+		case OpCode::GreaterEqual :
+			return boolValue( compare( op, a, b ) );
+		case OpCode::Subscript :
+			if( b.type != Type::Int && b.type != Type::Bool )
+			{
+				throw IECore::Exception( fmt::format( "Indices must be integers, not \"{}\"", typeName( b.type ) ) );
+			}
+			return component( a, b.v[0] );
+		default :
+			break;
+	}
+
+	if( a.type == Type::String || b.type == Type::String )
+	{
+		return stringOperation( op, a, b );
+	}
+
+	return arithmetic( op, a, b );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// String formatting
+//////////////////////////////////////////////////////////////////////////
+
+// Formats `value` using a Python format specification, which
+// fmt's specification follows very closely.
+std::string formatValue( const Value &value, const std::string &spec )
+{
+	const std::string format = "{:" + spec + "}";
+	try
+	{
+		switch( spec.size() ? spec.back() : 0 )
+		{
+			case 'd' :
+			case 'x' :
+			case 'X' :
+			case 'o' :
+			case 'b' :
+			{
+				const long long i = static_cast<long long>( number( value, "Integer format" ) );
+				return fmt::vformat( format, fmt::make_format_args( i ) );
+			}
+			case 'f' :
+			case 'F' :
+			case 'e' :
+			case 'E' :
+			case 'g' :
+			case 'G' :
+			{
+				const double f = number( value, "Float format" );
+				return fmt::vformat( format, fmt::make_format_args( f ) );
+			}
+			default :
+				if( value.type == Type::Int )
+				{
+					const long long i = static_cast<long long>( value.v[0] );
+					return fmt::vformat( format, fmt::make_format_args( i ) );
+				}
+				else if( value.type == Type::Float && !spec.empty() )
+				{
+					return fmt::vformat( format, fmt::make_format_args( value.v[0] ) );
+				}
+				else
+				{
+					const std::string s = toString( value );
+					return fmt::vformat( format, fmt::make_format_args( s ) );
+				}
+		}
+	}
+	catch( const fmt::format_error &e )
+	{
+		throw IECore::Exception( fmt::format(
+			"Invalid format specification \"{}\" for \"{}\" : {}", spec, typeName( value.type ), e.what()
+		) );
+	}
+}
+
+// Equivalent to Python's `str.format()`, supporting positional fields only.
+std::string strFormat( const std::string &format, const Value *args, size_t numArgs )
+{
+	std::string result;
+	size_t nextArg = 0;
+	for( size_t i = 0, e = format.size(); i < e; ++i )
+	{
+		const char c = format[i];
+		if( ( c == '{' || c == '}' ) && i + 1 < e && format[i+1] == c )
+		{
+			result += c;
+			++i;
+			continue;
+		}
+		else if( c == '}' )
+		{
+			throw IECore::Exception( "Single '}' encountered in format string" );
+		}
+		else if( c != '{' )
+		{
+			result += c;
+			continue;
+		}
+
+		const size_t end = format.find( '}', i );
+		if( end == std::string::npos )
+		{
+			throw IECore::Exception( "Single '{' encountered in format string" );
+		}
+
+		std::string field( format, i + 1, end - i - 1 );
+		i = end;
+
+		std::string spec;
+		const size_t colon = field.find( ':' );
+		if( colon != std::string::npos )
+		{
+			spec = field.substr( colon + 1 );
+			field.resize( colon );
+		}
+
+		char conversion = 0;
+		const size_t bang = field.find( '!' );
+		if( bang != std::string::npos )
+		{
+			if( bang + 2 != field.size() || ( field[bang+1] != 'r' && field[bang+1] != 's' ) )
+			{
+				throw IECore::Exception( fmt::format( "Unsupported conversion in format field \"{}\"", field ) );
+			}
+			conversion = field[bang+1];
+			field.resize( bang );
+		}
+
+		size_t index = nextArg++;
+		if( !field.empty() )
+		{
+			if( field.find_first_not_of( "0123456789" ) != std::string::npos )
+			{
+				throw IECore::Exception( fmt::format( "Unsupported format field \"{}\"", field ) );
+			}
+			index = std::stoul( field );
+		}
+
+		if( index >= numArgs )
+		{
+			throw IECore::Exception( fmt::format( "Replacement index {} out of range for format string", index ) );
+		}
+
+		switch( conversion )
+		{
+			case 'r' :
+				result += formatValue( Value( repr( args[index] ) ), spec );
+				break;
+			case 's' :
+				result += formatValue( Value( toString( args[index] ) ), spec );
+				break;
+			default :
+				result += formatValue( args[index], spec );
+		}
+	}
+
+	return result;
+}
+
+// Equivalent to Python's `%` operator for strings.
+std::string percentFormat( const std::string &format, const Value *args, size_t numArgs )
+{
+	std::string result;
+	size_t nextArg = 0;
+	for( size_t i = 0, e = format.size(); i < e; ++i )
+	{
+		if( format[i] != '%' )
+		{
+			result += format[i];
+			continue;
+		}
+		else if( i + 1 < e && format[i+1] == '%' )
+		{
+			result += '%';
+			++i;
+			continue;
+		}
+
+		// Translate the printf style conversion into a Python format
+		// specification, of the form `[align][sign][#][0][width][.precision][type]`.
+
+		std::string align, sign, alternate, zero;
+		for( ++i; i < e && strchr( "-+ #0", format[i] ); ++i )
+		{
+			switch( format[i] )
+			{
+				case '-' : align = "<"; break;
+				case '+' : sign = "+"; break;
+				case ' ' : sign = sign.empty() ? " " : sign; break;
+				case '#' : alternate = "#"; break;
+				default : zero = "0";
+			}
+		}
+
+		std::string width;
+		for( ; i < e && isdigit( format[i] ); ++i )
+		{
+			width += format[i];
+		}
+
+		std::string precision;
+		if( i < e && format[i] == '.' )
+		{
+			for( precision = "."; ++i < e && isdigit( format[i] ); )
+			{
+				precision += format[i];
+			}
+		}
+
+		if( i >= e )
+		{
+			throw IECore::Exception( "Incomplete format" );
+		}
+		if( nextArg >= numArgs )
+		{
+			throw IECore::Exception( "Not enough arguments for format string" );
+		}
+
+		const Value &arg = args[nextArg++];
+		switch( format[i] )
+		{
+			case 's' :
+			case 'r' :
+				result += formatValue(
+					Value( format[i] == 's' ? toString( arg ) : repr( arg ) ),
+					( align.empty() ? ">" : align ) + width + precision
+				);
+				break;
+			case 'd' :
+			case 'i' :
+			case 'u' :
+			case 'x' :
+			case 'X' :
+			case 'o' :
+			case 'e' :
+			case 'E' :
+			case 'f' :
+			case 'F' :
+			case 'g' :
+			case 'G' :
+			{
+				const char type = strchr( "iu", format[i] ) ? 'd' : format[i];
+				result += formatValue( arg, align + sign + alternate + ( align.empty() ? zero : "" ) + width + precision + type );
+				break;
+			}
+			default :
+				throw IECore::Exception( fmt::format( "Unsupported format character '{}'", format[i] ) );
+		}
+	}
+
+	if( nextArg < numArgs )
+	{
+		throw IECore::Exception( "Not all arguments converted during string formatting" );
+	}
+
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Functions
+//////////////////////////////////////////////////////////////////////////
+
+enum class Function : unsigned char
+{
+	// Conversions
+	Int,
+	Float,
+	Str,
+	Bool,
+	Repr,
+	V2i,
+	V3i,
+	V2f,
+	V3f,
+	Color3f,
+	Color4f,
+	// Maths
+	Abs,
+	Min,
+	Max,
+	Floor,
+	Ceil,
+	Round,
+	Sqrt,
+	Pow,
+	Sin,
+	Cos,
+	Tan,
+	Clamp,
+	Mix,
+	// Strings
+	Len,
+	Format,
+	PercentFormat,
+	Upper,
+	Lower,
+	Strip,
+	ZFill,
+	Replace,
+	StartsWith,
+	EndsWith
+};
+
+struct FunctionDescription
+{
+	const char *name;
+	Function function;
+	// Argument counts, including the string for methods.
+	size_t minArguments;
+	size_t maxArguments;
+	// Called as `string.name( ... )` rather than `name( ... )`.
+	bool method;
+};
+
+const size_t g_unlimited = std::numeric_limits<size_t>::max();
+
+const FunctionDescription g_functions[] = {
+	{ "int", Function::Int, 0, 1, false },
+	{ "float", Function::Float, 0, 1, false },
+	{ "str", Function::Str, 0, 1, false },
+	{ "bool", Function::Bool, 0, 1, false },
+	{ "repr", Function::Repr, 1, 1, false },
+	{ "V2i", Function::V2i, 0, 2, false },
+	{ "V3i", Function::V3i, 0, 3, false },
+	{ "V2f", Function::V2f, 0, 2, false },
+	{ "V3f", Function::V3f, 0, 3, false },
+	{ "Color3f", Function::Color3f, 0, 3, false },
+	{ "Color4f", Function::Color4f, 0, 4, false },
+	{ "abs", Function::Abs, 1, 1, false },
+	{ "min", Function::Min, 2, g_unlimited, false },
+	{ "max", Function::Max, 2, g_unlimited, false },
+	{ "floor", Function::Floor, 1, 1, false },
+	{ "ceil", Function::Ceil, 1, 1, false },
+	{ "round", Function::Round, 1, 2, false },
+	{ "sqrt", Function::Sqrt, 1, 1, false },
+	{ "pow", Function::Pow, 2, 2, false },
+	{ "sin", Function::Sin, 1, 1, false },
+	{ "cos", Function::Cos, 1, 1, false },
+	{ "tan", Function::Tan, 1, 1, false },
+	{ "clamp", Function::Clamp, 3, 3, false },
+	{ "mix", Function::Mix, 3, 3, false },
+	{ "len", Function::Len, 1, 1, false },
+	{ "format", Function::Format, 1, g_unlimited, true },
+	{ "upper", Function::Upper, 1, 1, true },
+	{ "lower", Function::Lower, 1, 1, true },
+	{ "strip", Function::Strip, 1, 1, true },
+	{ "zfill", Function::ZFill, 2, 2, true },
+	{ "replace", Function::Replace, 3, 3, true },
+	{ "startswith", Function::StartsWith, 2, 2, true },
+	{ "endswith", Function::EndsWith, 2, 2, true },
+	// Not callable by name. Used to implement `string % ( a, b, ... )`.
+	{ "%", Function::PercentFormat, 1, g_unlimited, false },
+};
+
+const FunctionDescription *findFunction( const std::string &name, bool method )
+{
+	for( const auto &f : g_functions )
+	{
+		if( f.method == method && name == f.name )
+		{
+			return &f;
+		}
+	}
+	return nullptr;
+}
+
+const FunctionDescription &functionDescription( Function function )
+{
+	for( const auto &f : g_functions )
+	{
+		if( f.function == function )
+		{
+			return f;
+		}
+	}
+	throw IECore::Exception( "Unknown function" );
+}
+
+Value constructVector( Type type, const Value *args, size_t numArgs )
+{
+	const int d = dimension( type );
+	Value result;
+	result.type = type;
+	if( numArgs == 1 && dimension( args[0].type ) == d )
+	{
+		// Conversion from another vector type.
+		std::copy( args[0].v, args[0].v + d, result.v );
+	}
+	else if( numArgs == 1 )
+	{
+		std::fill( result.v, result.v + d, number( args[0], typeName( type ) ) );
+	}
+	else if( numArgs == (size_t)d )
+	{
+		for( int i = 0; i < d; ++i )
+		{
+			result.v[i] = number( args[i], typeName( type ) );
+		}
+	}
+	else if( numArgs )
+	{
+		throw IECore::Exception( fmt::format( "{}() takes 0, 1 or {} arguments", typeName( type ), d ) );
+	}
+
+	if( isIntegral( type ) )
+	{
+		for( int i = 0; i < d; ++i )
+		{
+			result.v[i] = std::trunc( result.v[i] );
+		}
+	}
+
+	return result;
+}
+
+template<typename F>
+Value unaryMaths( const Value &a, const char *name, bool floatResult, F &&f )
+{
+	const int d = dimension( a.type );
+	if( !d )
+	{
+		throw IECore::Exception( fmt::format( "{}() requires a number, not \"{}\"", name, typeName( a.type ) ) );
+	}
+
+	Value result = a;
+	if( result.type == Type::Bool )
+	{
+		result.type = Type::Int;
+	}
+	if( floatResult )
+	{
+		result.type = floatType( result.type );
+	}
+	for( int i = 0; i < d; ++i )
+	{
+		result.v[i] = f( a.v[i] );
+	}
+	return result;
+}
+
+const std::string &stringArgument( const Value *args, size_t index, const char *name )
+{
+	if( args[index].type != Type::String )
+	{
+		throw IECore::Exception( fmt::format( "{}() requires a string, not \"{}\"", name, typeName( args[index].type ) ) );
+	}
+	return args[index].s;
+}
+
+Value callFunction( Function function, const Value *args, size_t numArgs )
+{
+	const char *name = functionDescription( function ).name;
+	switch( function )
+	{
+		case Function::Int :
+			if( !numArgs )
+			{
+				return intValue( 0 );
+			}
+			else if( args[0].type == Type::String )
+			{
+				const std::string s = boost::trim_copy( args[0].s );
+				char *end = nullptr;
+				const long long i = strtoll( s.c_str(), &end, 10 );
+				if( s.empty() || *end )
+				{
+					throw IECore::Exception( fmt::format( "Invalid literal for int() : {}", repr( args[0] ) ) );
+				}
+				return intValue( i );
+			}
+			return intValue( std::trunc( number( args[0], name ) ) );
+		case Function::Float :
+			if( !numArgs )
+			{
+				return floatValue( 0 );
+			}
+			else if( args[0].type == Type::String )
+			{
+				const std::string s = boost::trim_copy( args[0].s );
+				char *end = nullptr;
+				const double f = strtod( s.c_str(), &end );
+				if( s.empty() || *end )
+				{
+					throw IECore::Exception( fmt::format( "Could not convert string to float : {}", repr( args[0] ) ) );
+				}
+				return floatValue( f );
+			}
+			return floatValue( number( args[0], name ) );
+		case Function::Str :
+			return Value( numArgs ? toString( args[0] ) : std::string() );
+		case Function::Bool :
+			return boolValue( numArgs && truthy( args[0] ) );
+		case Function::Repr :
+			return Value( repr( args[0] ) );
+		case Function::V2i :
+			return constructVector( Type::V2i, args, numArgs );
+		case Function::V3i :
+			return constructVector( Type::V3i, args, numArgs );
+		case Function::V2f :
+			return constructVector( Type::V2f, args, numArgs );
+		case Function::V3f :
+			return constructVector( Type::V3f, args, numArgs );
+		case Function::Color3f :
+			return constructVector( Type::Color3f, args, numArgs );
+		case Function::Color4f :
+			return constructVector( Type::Color4f, args, numArgs );
+		case Function::Abs :
+			return unaryMaths( args[0], name, false, [] ( double x ) { return std::abs( x ); } );
+		case Function::Min :
+		case Function::Max :
+		{
+			const OpCode op = function == Function::Min ? OpCode::Less : OpCode::Greater;
+			const Value *result = args;
+			for( size_t i = 1; i < numArgs; ++i )
+			{
+				if( compare( op, args[i], *result ) )
+				{
+					result = args + i;
+				}
+			}
+			return *result;
+		}
+		case Function::Floor :
+			if( dimension( args[0].type ) == 1 )
+			{
+				return intValue( std::floor( args[0].v[0] ) );
+			}
+			return unaryMaths( args[0], name, false, [] ( double x ) { return std::floor( x ); } );
+		case Function::Ceil :
+			if( dimension( args[0].type ) == 1 )
+			{
+				return intValue( std::ceil( args[0].v[0] ) );
+			}
+			return unaryMaths( args[0], name, false, [] ( double x ) { return std::ceil( x ); } );
+		case Function::Round :
+			// Like Python, we round halfway cases to the nearest even number,
+			// which is the default rounding mode for `nearbyint()`.
+			if( numArgs == 1 )
+			{
+				return intValue( std::nearbyint( number( args[0], name ) ) );
+			}
+			else
+			{
+				const double scale = std::pow( 10.0, number( args[1], name ) );
+				return floatValue( std::nearbyint( number( args[0], name ) * scale ) / scale );
+			}
+		case Function::Sqrt :
+			return unaryMaths( args[0], name, true, [] ( double x ) { return std::sqrt( x ); } );
+		case Function::Pow :
+			return binaryOperation( OpCode::Power, args[0], args[1] );
+		case Function::Sin :
+			return unaryMaths( args[0], name, true, [] ( double x ) { return std::sin( x ); } );
+		case Function::Cos :
+			return unaryMaths( args[0], name, true, [] ( double x ) { return std::cos( x ); } );
+		case Function::Tan :
+			return unaryMaths( args[0], name, true, [] ( double x ) { return std::tan( x ); } );
+		case Function::Clamp :
+		{
+			const Value lower = componentwise( OpCode::Call, args[0], args[1], false, [] ( double x, double y ) { return std::max( x, y ); } );
+			return componentwise( OpCode::Call, lower, args[2], false, [] ( double x, double y ) { return std::min( x, y ); } );
+		}
+		case Function::Mix :
+			return arithmetic( OpCode::Add, args[0], arithmetic( OpCode::Multiply, arithmetic( OpCode::Subtract, args[1], args[0] ), args[2] ) );
+		case Function::Len :
+			if( args[0].type == Type::String )
+			{
+				return intValue( args[0].s.size() );
+			}
+			else if( dimension( args[0].type ) > 1 )
+			{
+				return intValue( dimension( args[0].type ) );
+			}
+			throw IECore::Exception( fmt::format( "Object of type \"{}\" has no len()", typeName( args[0].type ) ) );
+		case Function::Format :
+			return Value( strFormat( stringArgument( args, 0, name ), args + 1, numArgs - 1 ) );
+		case Function::PercentFormat :
+			return Value( percentFormat( stringArgument( args, 0, name ), args + 1, numArgs - 1 ) );
+		case Function::Upper :
+			return Value( boost::to_upper_copy( stringArgument( args, 0, name ) ) );
+		case Function::Lower :
+			return Value( boost::to_lower_copy( stringArgument( args, 0, name ) ) );
+		case Function::Strip :
+			return Value( boost::trim_copy( stringArgument( args, 0, name ) ) );
+		case Function::ZFill :
+		{
+			std::string s = stringArgument( args, 0, name );
+			const size_t width = static_cast<size_t>( std::max( 0.0, number( args[1], name ) ) );
+			if( width > s.size() )
+			{
+				const size_t signSize = s.size() && ( s[0] == '-' || s[0] == '+' ) ? 1 : 0;
+				s.insert( signSize, width - s.size(), '0' );
+			}
+			return Value( s );
+		}
+		case Function::Replace :
+			return Value( boost::replace_all_copy( stringArgument( args, 0, name ), stringArgument( args, 1, name ), stringArgument( args, 2, name ) ) );
+		case Function::StartsWith :
+			return boolValue( boost::starts_with( stringArgument( args, 0, name ), stringArgument( args, 1, name ) ) );
+		case Function::EndsWith :
+			return boolValue( boost::ends_with( stringArgument( args, 0, name ), stringArgument( args, 1, name ) ) );
+	}
+
+	return Value();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Program. The compiled form of an expression, consisting of
+// instructions for a simple register machine.
+//////////////////////////////////////////////////////////////////////////
+
+const uint16_t g_noRegister = std::numeric_limits<uint16_t>::max();
+
+struct Instruction
+{
+	OpCode opCode;
+	uint16_t result;
+	uint16_t a;
+	uint16_t b;
+	uint32_t index;
+};
+
+struct Program
+{
+	std::vector<Instruction> instructions;
+	std::vector<Value> constants;
+	std::vector<InternedString> contextNames;
+	std::vector<uint16_t> outputRegisters;
+	size_t numRegisters = 0;
+};
+
+// Sized to avoid allocation for typical expressions.
+using Registers = boost::container::small_vector<Value, 16>;
+
+void loadInput( const ValuePlug *plug, Value &result )
+{
+	switch( (Gaffer::TypeId)plug->typeId() )
+	{
+		case BoolPlugTypeId :
+			result = boolValue( static_cast<const BoolPlug *>( plug )->getValue() );
+			break;
+		case IntPlugTypeId :
+			result = intValue( static_cast<const IntPlug *>( plug )->getValue() );
+			break;
+		case FloatPlugTypeId :
+			result = floatValue( static_cast<const FloatPlug *>( plug )->getValue() );
+			break;
+		case StringPlugTypeId :
+			setString( result, static_cast<const StringPlug *>( plug )->getValue() );
+			break;
+		case V2iPlugTypeId :
+			setVector( result, Type::V2i, static_cast<const V2iPlug *>( plug )->getValue() );
+			break;
+		case V3iPlugTypeId :
+			setVector( result, Type::V3i, static_cast<const V3iPlug *>( plug )->getValue() );
+			break;
+		case V2fPlugTypeId :
+			setVector( result, Type::V2f, static_cast<const V2fPlug *>( plug )->getValue() );
+			break;
+		case V3fPlugTypeId :
+			setVector( result, Type::V3f, static_cast<const V3fPlug *>( plug )->getValue() );
+			break;
+		case Color3fPlugTypeId :
+			setVector( result, Type::Color3f, static_cast<const Color3fPlug *>( plug )->getValue() );
+			break;
+		case Color4fPlugTypeId :
+			setVector( result, Type::Color4f, static_cast<const Color4fPlug *>( plug )->getValue() );
+			break;
+		default :
+			throw IECore::Exception( fmt::format( "Unsupported plug type \"{}\"", plug->typeName() ) );
+	}
+}
+
+void loadContext( const Context *context, const InternedString &name, const Value *defaultValue, Value &result )
+{
+	switch( context->variableTypeId( name ) )
+	{
+		case InvalidTypeId :
+			if( !defaultValue )
+			{
+				throw IECore::Exception( fmt::format( "Context has no variable named \"{}\"", name.string() ) );
+			}
+			result = *defaultValue;
+			break;
+		case BoolDataTypeId :
+			result = boolValue( context->get<bool>( name ) );
+			break;
+		case IntDataTypeId :
+			result = intValue( context->get<int>( name ) );
+			break;
+		case FloatDataTypeId :
+			result = floatValue( context->get<float>( name ) );
+			break;
+		case StringDataTypeId :
+			setString( result, context->get<std::string>( name ) );
+			break;
+		case V2iDataTypeId :
+			setVector( result, Type::V2i, context->get<V2i>( name ) );
+			break;
+		case V3iDataTypeId :
+			setVector( result, Type::V3i, context->get<V3i>( name ) );
+			break;
+		case V2fDataTypeId :
+			setVector( result, Type::V2f, context->get<V2f>( name ) );
+			break;
+		case V3fDataTypeId :
+			setVector( result, Type::V3f, context->get<V3f>( name ) );
+			break;
+		case Color3fDataTypeId :
+			setVector( result, Type::Color3f, context->get<Color3f>( name ) );
+			break;
+		case Color4fDataTypeId :
+			setVector( result, Type::Color4f, context->get<Color4f>( name ) );
+			break;
+		default :
+			throw IECore::Exception( fmt::format( "Context variable \"{}\" has unsupported type", name.string() ) );
+	}
+}
+
+void run( const Program &program, const Context *context, const std::vector<const ValuePlug *> &inputs, Registers &registers )
+{
+	registers.resize( program.numRegisters );
+
+	const Instruction *instructions = program.instructions.data();
+	const size_t size = program.instructions.size();
+	size_t pc = 0;
+	while( pc < size )
+	{
+		const Instruction &instruction = instructions[pc++];
+		switch( instruction.opCode )
+		{
+			case OpCode::LoadConstant :
+				registers[instruction.result] = program.constants[instruction.index];
+				break;
+			case OpCode::LoadInput :
+				loadInput( inputs[instruction.index], registers[instruction.result] );
+				break;
+			case OpCode::LoadContext :
+				loadContext(
+					context, program.contextNames[instruction.index],
+					instruction.a != g_noRegister ? &registers[instruction.a] : nullptr,
+					registers[instruction.result]
+				);
+				break;
+			case OpCode::ContextContains :
+				registers[instruction.result] = boolValue( context->variableTypeId( program.contextNames[instruction.index] ) != InvalidTypeId );
+				break;
+			case OpCode::Copy :
+				registers[instruction.result] = registers[instruction.a];
+				break;
+			case OpCode::Move :
+				registers[instruction.result] = std::move( registers[instruction.a] );
+				break;
+			case OpCode::Negate :
+			case OpCode::Not :
+				registers[instruction.result] = unaryOperation( instruction.opCode, registers[instruction.a] );
+				break;
+			case OpCode::Add :
+			case OpCode::Subtract :
+			case OpCode::Multiply :
+			case OpCode::Divide :
+			case OpCode::FloorDivide :
+			case OpCode::Modulo :
+			case OpCode::Power :
+			case OpCode::Equal :
+			case OpCode::NotEqual :
+			case OpCode::Less :
+			case OpCode::LessEqual :
+			case OpCode::Greater :
+			case OpCode::GreaterEqual :
+			case OpCode::Subscript :
+				registers[instruction.result] = binaryOperation( instruction.opCode, registers[instruction.a], registers[instruction.b] );
+				break;
+			case OpCode::Component :
+				registers[instruction.result] = component( registers[instruction.a], instruction.index );
+				break;
+			case OpCode::Call :
+				registers[instruction.result] = callFunction( static_cast<Function>( instruction.index ), &registers[instruction.a], instruction.b );
+				break;
+			case OpCode::Jump :
+				pc = instruction.index;
+				break;
+			case OpCode::JumpIfFalse :
+				if( !truthy( registers[instruction.a] ) )
+				{
+					pc = instruction.index;
+				}
+				break;
+			case OpCode::JumpIfTrue :
+				if( truthy( registers[instruction.a] ) )
+				{
+					pc = instruction.index;
+				}
+				break;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Tokenizer
+//////////////////////////////////////////////////////////////////////////
+
+struct Token
+{
+	enum class Kind
+	{
+		Name,
+		Int,
+		Float,
+		String,
+		FormatString,
+		Operator,
+		Newline,
+		Indent,
+		Dedent,
+		End
+	};
+
+	Kind kind;
+	std::string text;
+	double number;
+	int line;
+};
+
+IECore::Exception syntaxError( int line, const std::string &message )
+{
+	return IECore::Exception( fmt::format( "Line {} : {}", line, message ) );
+}
+
+// Tokenizes Python-like source, generating Indent and Dedent tokens to
+// represent the block structure, and ignoring newlines within brackets.
+std::vector<Token> tokenize( const std::string &source, int line = 1 )
+{
+	std::vector<Token> tokens;
+	std::vector<int> indents = { 0 };
+	int depth = 0;
+	bool lineStart = true;
+
+	auto addToken = [&] ( Token::Kind kind, const std::string &text = "", double number = 0 ) {
+		tokens.push_back( { kind, text, number, line } );
+	};
+
+	// Prefix for the next string literal, if any.
+	char stringPrefix = 0;
+
+	size_t i = 0;
+	const size_t size = source.size();
+	while( i < size )
+	{
+		if( lineStart && depth == 0 )
+		{
+			// Measure indentation, skipping blank and comment-only lines.
+			int indent = 0;
+			for( ; i < size && ( source[i] == ' ' || source[i] == '\t' ); ++i )
+			{
+				indent = source[i] == '\t' ? ( indent / 8 + 1 ) * 8 : indent + 1;
+			}
+			if( i == size )
+			{
+				break;
+			}
+			else if( source[i] == '\n' || source[i] == '\r' || source[i] == '#' )
+			{
+				i = source.find( '\n', i );
+				i = i == std::string::npos ? size : i + 1;
+				line++;
+				continue;
+			}
+
+			lineStart = false;
+			if( indent > indents.back() )
+			{
+				indents.push_back( indent );
+				addToken( Token::Kind::Indent );
+			}
+			while( indent < indents.back() )
+			{
+				indents.pop_back();
+				addToken( Token::Kind::Dedent );
+			}
+			if( indent != indents.back() )
+			{
+				throw syntaxError( line, "Inconsistent indentation" );
+			}
+		}
+
+		const char c = source[i];
+		if( c == '\n' )
+		{
+			if( depth == 0 )
+			{
+				addToken( Token::Kind::Newline );
+				lineStart = true;
+			}
+			line++;
+			i++;
+		}
+		else if( c == ' ' || c == '\t' || c == '\r' )
+		{
+			i++;
+		}
+		else if( c == '#' )
+		{
+			i = source.find( '\n', i );
+			i = i == std::string::npos ? size : i;
+		}
+		else if( c == '\\' && i + 1 < size && source[i+1] == '\n' )
+		{
+			line++;
+			i += 2;
+		}
+		else if( isalpha( c ) || c == '_' )
+		{
+			size_t end = i;
+			while( end < size && ( isalnum( source[end] ) || source[end] == '_' ) )
+			{
+				end++;
+			}
+			const std::string name = source.substr( i, end - i );
+			i = end;
+			if( ( name == "f" || name == "r" ) && i < size && ( source[i] == '"' || source[i] == '\'' ) )
+			{
+				// Prefixed string literal, handled below.
+				stringPrefix = name[0];
+			}
+			else
+			{
+				addToken( Token::Kind::Name, name );
+			}
+		}
+		else if( isdigit( c ) || ( c == '.' && i + 1 < size && isdigit( source[i+1] ) ) )
+		{
+			const char *begin = source.c_str() + i;
+			char *end = nullptr;
+			const double number = strtod( begin, &end );
+			const std::string text( begin, end - begin );
+			addToken(
+				text.find_first_of( ".eE" ) == std::string::npos ? Token::Kind::Int : Token::Kind::Float,
+				text, number
+			);
+			i += end - begin;
+		}
+		else if( c == '"' || c == '\'' )
+		{
+			const bool raw = stringPrefix == 'r';
+			addToken( stringPrefix == 'f' ? Token::Kind::FormatString : Token::Kind::String );
+			stringPrefix = 0;
+			std::string &text = tokens.back().text;
+
+			for( ++i; i < size && source[i] != c; ++i )
+			{
+				if( source[i] == '\n' )
+				{
+					break;
+				}
+				else if( source[i] == '\\' && i + 1 < size && !raw )
+				{
+					switch( source[++i] )
+					{
+						case 'n' : text += '\n'; break;
+						case 't' : text += '\t'; break;
+						case '\\' : text += '\\'; break;
+						case '\'' : text += '\''; break;
+						case '"' : text += '"'; break;
+						case '\n' : line++; break;
+						default : text += '\\'; text += source[i];
+					}
+				}
+				else
+				{
+					text += source[i];
+				}
+			}
+
+			if( i >= size || source[i] != c )
+			{
+				throw syntaxError( line, "Unterminated string" );
+			}
+			i++;
+		}
+		else
+		{
+			static const char *g_operators[] = {
+				"**", "//", "==", "!=", "<=", ">=", "+=", "-=", "*=", "/=",
+				"+", "-", "*", "/", "%", "<", ">", "=", "(", ")", "[", "]", ",", ".", ":", ";"
+			};
+
+			std::string op;
+			for( const char *o : g_operators )
+			{
+				if( source.compare( i, strlen( o ), o ) == 0 )
+				{
+					op = o;
+					break;
+				}
+			}
+
+			if( op.empty() )
+			{
+				throw syntaxError( line, fmt::format( "Unexpected character '{}'", c ) );
+			}
+			else if( op == "(" || op == "[" )
+			{
+				depth++;
+			}
+			else if( ( op == ")" || op == "]" ) && depth )
+			{
+				depth--;
+			}
+
+			addToken( Token::Kind::Operator, op );
+			i += op.size();
+		}
+	}
+
+	if( tokens.size() && tokens.back().kind != Token::Kind::Newline )
+	{
+		addToken( Token::Kind::Newline );
+	}
+	for( size_t j = 1; j < indents.size(); ++j )
+	{
+		addToken( Token::Kind::Dedent );
+	}
+	addToken( Token::Kind::End );
+
+	return tokens;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Compiler. Parses source into an expression tree for each statement,
+// folding constants as it goes, and then generates instructions from
+// the tree.
+//////////////////////////////////////////////////////////////////////////
+
+struct Expr;
+using ExprPtr = std::unique_ptr<Expr>;
+
+struct Expr
+{
+
+	enum class Kind
+	{
+		Constant,
+		Input,
+		Register,
+		Context,
+		ContextContains,
+		Unary,
+		Binary,
+		Compare,
+		And,
+		Or,
+		Conditional,
+		Component,
+		Call,
+		Tuple
+	};
+
+	Expr( Kind kind, int line )
+		:	kind( kind ), line( line ), op( OpCode::Copy ), index( 0 )
+	{
+	}
+
+	Kind kind;
+	int line;
+	// Constant value.
+	Value value;
+	// Unary and binary operators.
+	OpCode op;
+	// Comparison operators.
+	std::vector<OpCode> ops;
+	// Input, register, context name, component or function index.
+	size_t index;
+	std::vector<ExprPtr> children;
+
+};
+
+class Compiler
+{
+
+	public :
+
+		Compiler( const std::string &source )
+			:	m_tokens( tokenize( source ) ), m_position( 0 ), m_nextRegister( 0 )
+		{
+		}
+
+		// Compiles the source, returning the program along with the paths
+		// to the plugs it reads from and writes to, and the context variables
+		// it reads. Paths are sorted, so that the order of plugs on the
+		// Expression node is independent of the order of statements.
+		Program compile( std::vector<std::string> &inputPaths, std::vector<std::string> &outputPaths, std::vector<InternedString> &contextVariables )
+		{
+			while( !match( Token::Kind::End ) )
+			{
+				if( !match( Token::Kind::Newline ) )
+				{
+					statement();
+				}
+			}
+
+			// Sort inputs, remapping the indices used by LoadInput.
+			std::vector<size_t> inputOrder( m_inputPaths.size() );
+			std::iota( inputOrder.begin(), inputOrder.end(), 0 );
+			std::sort( inputOrder.begin(), inputOrder.end(), [this] ( size_t a, size_t b ) { return m_inputPaths[a] < m_inputPaths[b]; } );
+			std::vector<uint32_t> inputIndices( inputOrder.size() );
+			for( size_t i = 0; i < inputOrder.size(); ++i )
+			{
+				inputPaths.push_back( m_inputPaths[inputOrder[i]] );
+				inputIndices[inputOrder[i]] = i;
+			}
+			for( auto &instruction : m_program.instructions )
+			{
+				if( instruction.opCode == OpCode::LoadInput )
+				{
+					instruction.index = inputIndices[instruction.index];
+				}
+			}
+
+			// Sort outputs along with their registers.
+			std::vector<std::pair<std::string, uint16_t>> outputs;
+			for( size_t i = 0; i < m_outputPaths.size(); ++i )
+			{
+				outputs.push_back( { m_outputPaths[i], m_outputRegisters[i] } );
+			}
+			std::sort( outputs.begin(), outputs.end() );
+			for( const auto &o : outputs )
+			{
+				outputPaths.push_back( o.first );
+				m_program.outputRegisters.push_back( o.second );
+			}
+
+			contextVariables = m_program.contextNames;
+			return std::move( m_program );
+		}
+
+	private :
+
+		// Statements
+		// ==========
+
+		void statement()
+		{
+			if( matchName( "if" ) )
+			{
+				ifStatement();
+			}
+			else
+			{
+				simpleStatements();
+			}
+		}
+
+		void ifStatement()
+		{
+			std::vector<size_t> endJumps;
+			do
+			{
+				const size_t base = m_nextRegister;
+				const uint16_t condition = compileExpression( expression().get() );
+				m_nextRegister = base;
+				const size_t conditionJump = emit( OpCode::JumpIfFalse, 0, condition );
+				expect( ":" );
+				block();
+				endJumps.push_back( emit( OpCode::Jump ) );
+				patch( conditionJump );
+			} while( matchName( "elif" ) );
+
+			if( matchName( "else" ) )
+			{
+				expect( ":" );
+				block();
+			}
+
+			for( size_t jump : endJumps )
+			{
+				patch( jump );
+			}
+		}
+
+		void block()
+		{
+			if( !match( Token::Kind::Newline ) )
+			{
+				simpleStatements();
+				return;
+			}
+
+			if( !match( Token::Kind::Indent ) )
+			{
+				throw syntaxError( current().line, "Expected an indented block" );
+			}
+			while( !match( Token::Kind::Dedent ) )
+			{
+				statement();
+			}
+		}
+
+		void simpleStatements()
+		{
+			do
+			{
+				if( current().kind == Token::Kind::Newline )
+				{
+					break;
+				}
+				simpleStatement();
+			} while( matchOperator( ";" ) );
+
+			if( !match( Token::Kind::Newline ) )
+			{
+				throw unexpected();
+			}
+		}
+
+		void simpleStatement()
+		{
+			if( matchName( "pass" ) )
+			{
+				return;
+			}
+
+			// Target. We don't declare new local variables until after
+			// the value has been parsed, because they can't be referenced
+			// by their own definition.
+
+			const Token &target = current();
+			if( target.kind != Token::Kind::Name )
+			{
+				throw unexpected();
+			}
+			else if( isReserved( target.text ) )
+			{
+				throw syntaxError( target.line, "Expected assignment to a plug or variable" );
+			}
+
+			uint16_t targetRegister = g_noRegister;
+			if( target.text == "parent" )
+			{
+				targetRegister = outputRegister( plugPath() );
+			}
+			else
+			{
+				auto it = m_locals.find( target.text );
+				if( it != m_locals.end() )
+				{
+					targetRegister = it->second;
+				}
+				m_position++;
+			}
+
+			// Operator.
+
+			static const std::pair<const char *, OpCode> g_assignments[] = {
+				{ "=", OpCode::Copy }, { "+=", OpCode::Add }, { "-=", OpCode::Subtract },
+				{ "*=", OpCode::Multiply }, { "/=", OpCode::Divide }
+			};
+
+			OpCode op = OpCode::Subscript;
+			for( const auto &a : g_assignments )
+			{
+				if( matchOperator( a.first ) )
+				{
+					op = a.second;
+					break;
+				}
+			}
+
+			if( op == OpCode::Subscript )
+			{
+				throw unexpected();
+			}
+
+			// Value.
+
+			ExprPtr value = expression();
+			if( op != OpCode::Copy )
+			{
+				if( targetRegister == g_noRegister )
+				{
+					throw syntaxError( target.line, fmt::format( "Name \"{}\" is not defined", target.text ) );
+				}
+				ExprPtr targetExpr = std::make_unique<Expr>( Expr::Kind::Register, target.line );
+				targetExpr->index = targetRegister;
+				value = binary( op, std::move( targetExpr ), std::move( value ) );
+			}
+
+			if( targetRegister == g_noRegister )
+			{
+				targetRegister = allocateNamedRegister();
+				m_locals[target.text] = targetRegister;
+			}
+
+			const size_t base = m_nextRegister;
+			transfer( targetRegister, compileExpression( value.get() ) );
+			m_nextRegister = base;
+		}
+
+		// Expressions
+		// ===========
+
+		ExprPtr expression()
+		{
+			ExprPtr result = orExpression();
+			if( matchName( "if" ) )
+			{
+				ExprPtr conditional = std::make_unique<Expr>( Expr::Kind::Conditional, result->line );
+				conditional->children.push_back( orExpression() );
+				conditional->children.push_back( std::move( result ) );
+				expectName( "else" );
+				conditional->children.push_back( expression() );
+				if( conditional->children[0]->kind == Expr::Kind::Constant )
+				{
+					return std::move( conditional->children[truthy( conditional->children[0]->value ) ? 1 : 2] );
+				}
+				result = std::move( conditional );
+			}
+			return result;
+		}
+
+		ExprPtr orExpression()
+		{
+			return logical( Expr::Kind::Or, "or", &Compiler::andExpression );
+		}
+
+		ExprPtr andExpression()
+		{
+			return logical( Expr::Kind::And, "and", &Compiler::notExpression );
+		}
+
+		ExprPtr logical( Expr::Kind kind, const char *keyword, ExprPtr (Compiler::*operand)() )
+		{
+			ExprPtr result = (this->*operand)();
+			while( matchName( keyword ) )
+			{
+				ExprPtr e = std::make_unique<Expr>( kind, result->line );
+				e->children.push_back( std::move( result ) );
+				e->children.push_back( (this->*operand)() );
+				result = std::move( e );
+			}
+			return result;
+		}
+
+		ExprPtr notExpression()
+		{
+			if( matchName( "not" ) )
+			{
+				return unary( OpCode::Not, notExpression() );
+			}
+			return comparison();
+		}
+
+		ExprPtr comparison()
+		{
+			static const std::pair<const char *, OpCode> g_comparisons[] = {
+				{ "==", OpCode::Equal }, { "!=", OpCode::NotEqual }, { "<", OpCode::Less },
+				{ "<=", OpCode::LessEqual }, { ">", OpCode::Greater }, { ">=", OpCode::GreaterEqual }
+			};
+
+			ExprPtr first = sum();
+
+			// `"name" in context` and `"name" not in context`.
+			const bool negated = current().kind == Token::Kind::Name && current().text == "not" && peek().kind == Token::Kind::Name && peek().text == "in";
+			if( negated || matchName( "in" ) )
+			{
+				if( negated )
+				{
+					m_position += 2;
+				}
+				const int line = first->line;
+				expectName( "context" );
+				if( first->kind != Expr::Kind::Constant || first->value.type != Type::String )
+				{
+					throw syntaxError( line, "Context name must be a string" );
+				}
+				ExprPtr result = std::make_unique<Expr>( Expr::Kind::ContextContains, line );
+				result->index = contextName( first->value.s );
+				return negated ? unary( OpCode::Not, std::move( result ) ) : std::move( result );
+			}
+
+			ExprPtr result;
+			while( true )
+			{
+				OpCode op = OpCode::Copy;
+				for( const auto &c : g_comparisons )
+				{
+					if( matchOperator( c.first ) )
+					{
+						op = c.second;
+						break;
+					}
+				}
+				if( op == OpCode::Copy )
+				{
+					break;
+				}
+				if( !result )
+				{
+					result = std::make_unique<Expr>( Expr::Kind::Compare, first->line );
+					result->children.push_back( std::move( first ) );
+				}
+				result->ops.push_back( op );
+				result->children.push_back( sum() );
+			}
+
+			if( !result )
+			{
+				return first;
+			}
+			else if( result->ops.size() == 1 )
+			{
+				return binary( result->ops[0], std::move( result->children[0] ), std::move( result->children[1] ) );
+			}
+			return result;
+		}
+
+		ExprPtr sum()
+		{
+			ExprPtr result = term();
+			while( true )
+			{
+				if( matchOperator( "+" ) )
+				{
+					result = binary( OpCode::Add, std::move( result ), term() );
+				}
+				else if( matchOperator( "-" ) )
+				{
+					result = binary( OpCode::Subtract, std::move( result ), term() );
+				}
+				else
+				{
+					return result;
+				}
+			}
+		}
+
+		ExprPtr term()
+		{
+			ExprPtr result = factor();
+			while( true )
+			{
+				if( matchOperator( "*" ) )
+				{
+					result = binary( OpCode::Multiply, std::move( result ), factor() );
+				}
+				else if( matchOperator( "/" ) )
+				{
+					result = binary( OpCode::Divide, std::move( result ), factor() );
+				}
+				else if( matchOperator( "//" ) )
+				{
+					result = binary( OpCode::FloorDivide, std::move( result ), factor() );
+				}
+				else if( matchOperator( "%" ) )
+				{
+					ExprPtr rhs = factor();
+					if( rhs->kind == Expr::Kind::Tuple )
+					{
+						// `string % ( a, b, ... )`
+						rhs->children.insert( rhs->children.begin(), std::move( result ) );
+						result = call( Function::PercentFormat, std::move( rhs->children ), rhs->line );
+					}
+					else
+					{
+						result = binary( OpCode::Modulo, std::move( result ), std::move( rhs ) );
+					}
+				}
+				else
+				{
+					return result;
+				}
+			}
+		}
+
+		ExprPtr factor()
+		{
+			if( matchOperator( "-" ) )
+			{
+				return unary( OpCode::Negate, factor() );
+			}
+			else if( matchOperator( "+" ) )
+			{
+				return factor();
+			}
+			return power();
+		}
+
+		ExprPtr power()
+		{
+			ExprPtr result = postfix();
+			if( matchOperator( "**" ) )
+			{
+				result = binary( OpCode::Power, std::move( result ), factor() );
+			}
+			return result;
+		}
+
+		ExprPtr postfix()
+		{
+			ExprPtr result = atom();
+			while( true )
+			{
+				if( matchOperator( "[" ) )
+				{
+					ExprPtr index = expression();
+					expect( "]" );
+					result = binary( OpCode::Subscript, std::move( result ), std::move( index ) );
+				}
+				else if( matchOperator( "." ) )
+				{
+					const Token &name = expect( Token::Kind::Name );
+					if( atOperator( "(" ) )
+					{
+						const FunctionDescription *function = findFunction( name.text, /* method = */ true );
+						if( !function )
+						{
+							throw syntaxError( name.line, fmt::format( "Unsupported method \"{}\"", name.text ) );
+						}
+						std::vector<ExprPtr> arguments;
+						arguments.push_back( std::move( result ) );
+						result = call( *function, std::move( arguments ) );
+					}
+					else
+					{
+						static const std::string g_components[] = { "xr", "yg", "zb", "a" };
+						ExprPtr c = std::make_unique<Expr>( Expr::Kind::Component, name.line );
+						c->index = 4;
+						for( size_t i = 0; i < 4; ++i )
+						{
+							if( name.text.size() == 1 && g_components[i].find( name.text[0] ) != std::string::npos )
+							{
+								c->index = i;
+							}
+						}
+						if( c->index == 4 )
+						{
+							throw syntaxError( name.line, fmt::format( "Unsupported attribute \"{}\"", name.text ) );
+						}
+						c->children.push_back( std::move( result ) );
+						result = fold( std::move( c ) );
+					}
+				}
+				else
+				{
+					return result;
+				}
+			}
+		}
+
+		ExprPtr atom()
+		{
+			const Token &token = current();
+			switch( token.kind )
+			{
+				case Token::Kind::Int :
+					m_position++;
+					return constant( intValue( token.number ), token.line );
+				case Token::Kind::Float :
+					m_position++;
+					return constant( floatValue( token.number ), token.line );
+				case Token::Kind::String :
+				{
+					// Adjacent literals are concatenated, as in Python.
+					std::string s;
+					while( current().kind == Token::Kind::String )
+					{
+						s += current().text;
+						m_position++;
+					}
+					return constant( Value( s ), token.line );
+				}
+				case Token::Kind::FormatString :
+					m_position++;
+					return formatString( token );
+				case Token::Kind::Operator :
+					if( token.text == "(" )
+					{
+						m_position++;
+						ExprPtr result = expression();
+						if( atOperator( "," ) )
+						{
+							ExprPtr tuple = std::make_unique<Expr>( Expr::Kind::Tuple, token.line );
+							tuple->children.push_back( std::move( result ) );
+							while( matchOperator( "," ) && !atOperator( ")" ) )
+							{
+								tuple->children.push_back( expression() );
+							}
+							result = std::move( tuple );
+						}
+						expect( ")" );
+						return result;
+					}
+					break;
+				case Token::Kind::Name :
+					return name();
+				default :
+					break;
+			}
+
+			throw unexpected();
+		}
+
+		ExprPtr name()
+		{
+			const Token &token = current();
+			if( token.text == "True" || token.text == "False" )
+			{
+				m_position++;
+				return constant( boolValue( token.text == "True" ), token.line );
+			}
+			else if( token.text == "None" )
+			{
+				m_position++;
+				return constant( Value(), token.line );
+			}
+			else if( token.text == "parent" )
+			{
+				ExprPtr result = std::make_unique<Expr>( Expr::Kind::Input, token.line );
+				result->index = inputIndex( plugPath() );
+				return result;
+			}
+			else if( token.text == "context" )
+			{
+				m_position++;
+				return contextAccess( token.line );
+			}
+			else if( peek().kind == Token::Kind::Operator && peek().text == "(" )
+			{
+				const FunctionDescription *function = findFunction( token.text, /* method = */ false );
+				if( !function )
+				{
+					throw syntaxError( token.line, fmt::format( "Unsupported function \"{}\"", token.text ) );
+				}
+				m_position++;
+				return call( *function, {} );
+			}
+
+			auto it = m_locals.find( token.text );
+			if( it == m_locals.end() || isReserved( token.text ) )
+			{
+				throw syntaxError( token.line, fmt::format( "Name \"{}\" is not defined", token.text ) );
+			}
+			m_position++;
+			ExprPtr result = std::make_unique<Expr>( Expr::Kind::Register, token.line );
+			result->index = it->second;
+			return result;
+		}
+
+		// Parses `context["name"]`, `context.get( "name", default )`
+		// and the time accessors, following the `context` token.
+		ExprPtr contextAccess( int line )
+		{
+			ExprPtr result = std::make_unique<Expr>( Expr::Kind::Context, line );
+			if( matchOperator( "[" ) )
+			{
+				result->index = contextName( expect( Token::Kind::String ).text );
+				expect( "]" );
+				return result;
+			}
+
+			expect( "." );
+			const std::string method = expect( Token::Kind::Name ).text;
+			expect( "(" );
+			if( method == "get" )
+			{
+				if( current().kind != Token::Kind::String )
+				{
+					throw syntaxError( line, "Context name must be a string" );
+				}
+				result->index = contextName( expect( Token::Kind::String ).text );
+				result->children.push_back( matchOperator( "," ) ? expression() : constant( Value(), line ) );
+			}
+			else if( method == "getFrame" )
+			{
+				result->index = contextName( "frame" );
+			}
+			else if( method == "getFramesPerSecond" )
+			{
+				result->index = contextName( "framesPerSecond" );
+			}
+			else if( method == "getTime" )
+			{
+				result->index = contextName( "frame" );
+				ExprPtr fps = std::make_unique<Expr>( Expr::Kind::Context, line );
+				fps->index = contextName( "framesPerSecond" );
+				expect( ")" );
+				return binary( OpCode::Divide, std::move( result ), std::move( fps ) );
+			}
+			else
+			{
+				throw syntaxError( line, fmt::format( "Unsupported context method \"{}\"", method ) );
+			}
+			expect( ")" );
+			return result;
+		}
+
+		// Parses the arguments for a call, having consumed the function name.
+		ExprPtr call( const FunctionDescription &function, std::vector<ExprPtr> arguments )
+		{
+			const int line = current().line;
+			expect( "(" );
+			if( !matchOperator( ")" ) )
+			{
+				do
+				{
+					if( atOperator( ")" ) )
+					{
+						break;
+					}
+					arguments.push_back( expression() );
+				} while( matchOperator( "," ) );
+				expect( ")" );
+			}
+
+			if( arguments.size() < function.minArguments || arguments.size() > function.maxArguments )
+			{
+				throw syntaxError( line, fmt::format( "Wrong number of arguments for \"{}\"", function.name ) );
+			}
+
+			return call( function.function, std::move( arguments ), line );
+		}
+
+		ExprPtr call( Function function, std::vector<ExprPtr> arguments, int line )
+		{
+			ExprPtr result = std::make_unique<Expr>( Expr::Kind::Call, line );
+			result->index = static_cast<size_t>( function );
+			result->children = std::move( arguments );
+			return fold( std::move( result ) );
+		}
+
+		// Converts an f-string into a call to `str.format()`.
+		ExprPtr formatString( const Token &token )
+		{
+			std::vector<ExprPtr> arguments;
+			arguments.push_back( nullptr );
+
+			std::string format;
+			const std::string &text = token.text;
+			for( size_t i = 0, e = text.size(); i < e; ++i )
+			{
+				if( text[i] != '{' || ( i + 1 < e && text[i+1] == '{' ) )
+				{
+					format += text[i];
+					if( ( text[i] == '{' || text[i] == '}' ) && i + 1 < e && text[i+1] == text[i] )
+					{
+						format += text[++i];
+					}
+					continue;
+				}
+
+				// Find the end of the replacement field, and the start of any
+				// conversion or format specification, skipping over brackets and
+				// strings in the expression.
+				size_t end = i + 1;
+				size_t expressionEnd = std::string::npos;
+				int depth = 0;
+				char quote = 0;
+				for( ; end < e; ++end )
+				{
+					const char c = text[end];
+					if( quote )
+					{
+						quote = c == quote ? 0 : quote;
+					}
+					else if( c == '"' || c == '\'' )
+					{
+						quote = c;
+					}
+					else if( c == '(' || c == '[' || c == '{' )
+					{
+						depth++;
+					}
+					else if( ( c == ')' || c == ']' || c == '}' ) && depth )
+					{
+						depth--;
+					}
+					else if( c == '}' )
+					{
+						break;
+					}
+					else if( ( c == ':' || c == '!' ) && !depth && expressionEnd == std::string::npos && text.compare( end, 2, "!=" ) )
+					{
+						expressionEnd = end;
+					}
+				}
+
+				if( end >= e )
+				{
+					throw syntaxError( token.line, "Unterminated replacement field in f-string" );
+				}
+
+				expressionEnd = std::min( expressionEnd, end );
+				arguments.push_back( subExpression( text.substr( i + 1, expressionEnd - i - 1 ), token.line ) );
+				format += "{" + text.substr( expressionEnd, end - expressionEnd ) + "}";
+				i = end;
+			}
+
+			arguments[0] = constant( Value( format ), token.line );
+			return call( Function::Format, std::move( arguments ), token.line );
+		}
+
+		ExprPtr subExpression( const std::string &source, int line )
+		{
+			std::vector<Token> tokens = tokenize( source, line );
+			std::swap( tokens, m_tokens );
+			const size_t position = m_position;
+			m_position = 0;
+
+			ExprPtr result = expression();
+			if( !match( Token::Kind::Newline ) || current().kind != Token::Kind::End )
+			{
+				throw unexpected();
+			}
+
+			std::swap( tokens, m_tokens );
+			m_position = position;
+			return result;
+		}
+
+		// Parses `parent["a"]["b"]...`, returning `a.b`.
+		std::string plugPath()
+		{
+			const int line = current().line;
+			m_position++;
+
+			std::string result;
+			while( matchOperator( "[" ) )
+			{
+				if( current().kind != Token::Kind::String )
+				{
+					throw syntaxError( line, "Plug names must be strings" );
+				}
+				result += ( result.empty() ? "" : "." ) + expect( Token::Kind::String ).text;
+				expect( "]" );
+			}
+
+			if( result.empty() )
+			{
+				throw syntaxError( line, "Expected plug name after \"parent\"" );
+			}
+
+			return result;
+		}
+
+		// Expression construction
+		// =======================
+
+		ExprPtr constant( const Value &value, int line )
+		{
+			ExprPtr result = std::make_unique<Expr>( Expr::Kind::Constant, line );
+			result->value = value;
+			return result;
+		}
+
+		ExprPtr unary( OpCode op, ExprPtr operand )
+		{
+			ExprPtr result = std::make_unique<Expr>( Expr::Kind::Unary, operand->line );
+			result->op = op;
+			result->children.push_back( std::move( operand ) );
+			return fold( std::move( result ) );
+		}
+
+		ExprPtr binary( OpCode op, ExprPtr a, ExprPtr b )
+		{
+			ExprPtr result = std::make_unique<Expr>( Expr::Kind::Binary, a->line );
+			result->op = op;
+			result->children.push_back( std::move( a ) );
+			result->children.push_back( std::move( b ) );
+			return fold( std::move( result ) );
+		}
+
+		// Evaluates operations with constant operands at compile time. Errors
+		// are deferred until execution, so that they are reported in the same
+		// way regardless of whether or not the operands are constant.
+		ExprPtr fold( ExprPtr e )
+		{
+			std::vector<Value> operands;
+			for( const auto &c : e->children )
+			{
+				if( c->kind != Expr::Kind::Constant )
+				{
+					return e;
+				}
+				operands.push_back( c->value );
+			}
+
+			try
+			{
+				switch( e->kind )
+				{
+					case Expr::Kind::Unary :
+						return constant( unaryOperation( e->op, operands[0] ), e->line );
+					case Expr::Kind::Binary :
+						return constant( binaryOperation( e->op, operands[0], operands[1] ), e->line );
+					case Expr::Kind::Component :
+						return constant( component( operands[0], e->index ), e->line );
+					case Expr::Kind::Call :
+						return constant( callFunction( static_cast<Function>( e->index ), operands.data(), operands.size() ), e->line );
+					default :
+						return e;
+				}
+			}
+			catch( ... )
+			{
+				return e;
+			}
+		}
+
+		// Code generation
+		// ===============
+
+		// Generates code for `e`, returning the register that holds the result.
+		uint16_t compileExpression( const Expr *e )
+		{
+			if( e->kind == Expr::Kind::Register )
+			{
+				return e->index;
+			}
+			else if( e->kind == Expr::Kind::Tuple )
+			{
+				throw syntaxError( e->line, "Tuples are only supported for string formatting" );
+			}
+
+			const uint16_t result = allocateRegister();
+			switch( e->kind )
+			{
+				case Expr::Kind::Constant :
+					emit( OpCode::LoadConstant, result, 0, 0, constantIndex( e->value ) );
+					break;
+				case Expr::Kind::Input :
+					emit( OpCode::LoadInput, result, 0, 0, e->index );
+					break;
+				case Expr::Kind::Context :
+					emit(
+						OpCode::LoadContext, result,
+						e->children.size() ? compileExpression( e->children[0].get() ) : g_noRegister,
+						0, e->index
+					);
+					break;
+				case Expr::Kind::ContextContains :
+					emit( OpCode::ContextContains, result, 0, 0, e->index );
+					break;
+				case Expr::Kind::Unary :
+					emit( e->op, result, compileExpression( e->children[0].get() ) );
+					break;
+				case Expr::Kind::Binary :
+				{
+					const uint16_t a = compileExpression( e->children[0].get() );
+					emit( e->op, result, a, compileExpression( e->children[1].get() ) );
+					break;
+				}
+				case Expr::Kind::Compare :
+				{
+					// `a < b < c` is equivalent to `a < b and b < c`, except
+					// that `b` is only evaluated once.
+					std::vector<size_t> jumps;
+					uint16_t a = compileExpression( e->children[0].get() );
+					for( size_t i = 0; i < e->ops.size(); ++i )
+					{
+						if( i )
+						{
+							jumps.push_back( emit( OpCode::JumpIfFalse, 0, result ) );
+						}
+						const uint16_t b = compileExpression( e->children[i+1].get() );
+						emit( e->ops[i], result, a, b );
+						a = b;
+					}
+					for( size_t jump : jumps )
+					{
+						patch( jump );
+					}
+					break;
+				}
+				case Expr::Kind::And :
+				case Expr::Kind::Or :
+				{
+					transfer( result, compileExpression( e->children[0].get() ) );
+					const size_t jump = emit( e->kind == Expr::Kind::And ? OpCode::JumpIfFalse : OpCode::JumpIfTrue, 0, result );
+					transfer( result, compileExpression( e->children[1].get() ) );
+					patch( jump );
+					break;
+				}
+				case Expr::Kind::Conditional :
+				{
+					const size_t elseJump = emit( OpCode::JumpIfFalse, 0, compileExpression( e->children[0].get() ) );
+					transfer( result, compileExpression( e->children[1].get() ) );
+					const size_t endJump = emit( OpCode::Jump );
+					patch( elseJump );
+					transfer( result, compileExpression( e->children[2].get() ) );
+					patch( endJump );
+					break;
+				}
+				case Expr::Kind::Component :
+					emit( OpCode::Component, result, compileExpression( e->children[0].get() ), 0, e->index );
+					break;
+				case Expr::Kind::Call :
+				{
+					// Arguments must be in consecutive registers.
+					const uint16_t first = m_nextRegister;
+					for( size_t i = 0; i < e->children.size(); ++i )
+					{
+						allocateRegister();
+					}
+					for( size_t i = 0; i < e->children.size(); ++i )
+					{
+						transfer( first + i, compileExpression( e->children[i].get() ) );
+					}
+					emit( OpCode::Call, result, first, e->children.size(), e->index );
+					break;
+				}
+				default :
+					break;
+			}
+
+			return result;
+		}
+
+		size_t emit( OpCode op, uint16_t result = 0, uint16_t a = 0, uint16_t b = 0, uint32_t index = 0 )
+		{
+			m_program.instructions.push_back( { op, result, a, b, index } );
+			return m_program.instructions.size() - 1;
+		}
+
+		// Points the jump at `instruction` to the next instruction to be emitted.
+		void patch( size_t instruction )
+		{
+			m_program.instructions[instruction].index = m_program.instructions.size();
+		}
+
+		// Transfers a value from `source` to `destination`, stealing it from
+		// temporary registers, which are never read twice.
+		void transfer( uint16_t destination, uint16_t source )
+		{
+			if( destination != source )
+			{
+				emit( m_namedRegisters.count( source ) ? OpCode::Copy : OpCode::Move, destination, source );
+			}
+		}
+
+		uint16_t allocateRegister()
+		{
+			if( m_nextRegister >= g_noRegister )
+			{
+				throw IECore::Exception( "Expression is too complex" );
+			}
+			m_program.numRegisters = std::max( m_program.numRegisters, m_nextRegister + 1 );
+			return m_nextRegister++;
+		}
+
+		// Allocates a register for a local variable or output. These are only
+		// allocated between statements, when no temporary registers are in use.
+		uint16_t allocateNamedRegister()
+		{
+			const uint16_t result = allocateRegister();
+			m_namedRegisters.insert( result );
+			return result;
+		}
+
+		uint32_t constantIndex( const Value &value )
+		{
+			m_program.constants.push_back( value );
+			return m_program.constants.size() - 1;
+		}
+
+		uint32_t contextName( const std::string &name )
+		{
+			auto it = std::find( m_program.contextNames.begin(), m_program.contextNames.end(), InternedString( name ) );
+			if( it == m_program.contextNames.end() )
+			{
+				m_program.contextNames.push_back( name );
+				return m_program.contextNames.size() - 1;
+			}
+			return it - m_program.contextNames.begin();
+		}
+
+		uint32_t inputIndex( const std::string &path )
+		{
+			auto it = std::find( m_inputPaths.begin(), m_inputPaths.end(), path );
+			if( it == m_inputPaths.end() )
+			{
+				m_inputPaths.push_back( path );
+				return m_inputPaths.size() - 1;
+			}
+			return it - m_inputPaths.begin();
+		}
+
+		uint16_t outputRegister( const std::string &path )
+		{
+			auto it = std::find( m_outputPaths.begin(), m_outputPaths.end(), path );
+			if( it == m_outputPaths.end() )
+			{
+				m_outputPaths.push_back( path );
+				m_outputRegisters.push_back( allocateNamedRegister() );
+				return m_outputRegisters.back();
+			}
+			return m_outputRegisters[it - m_outputPaths.begin()];
+		}
+
+		// Tokens
+		// ======
+
+		const Token &current() const
+		{
+			return m_tokens[m_position];
+		}
+
+		const Token &peek() const
+		{
+			return m_tokens[std::min( m_position + 1, m_tokens.size() - 1 )];
+		}
+
+		bool atOperator( const char *op ) const
+		{
+			return current().kind == Token::Kind::Operator && current().text == op;
+		}
+
+		bool match( Token::Kind kind )
+		{
+			if( current().kind == kind )
+			{
+				m_position++;
+				return true;
+			}
+			return false;
+		}
+
+		bool matchOperator( const char *op )
+		{
+			if( atOperator( op ) )
+			{
+				m_position++;
+				return true;
+			}
+			return false;
+		}
+
+		bool matchName( const char *name )
+		{
+			if( current().kind == Token::Kind::Name && current().text == name )
+			{
+				m_position++;
+				return true;
+			}
+			return false;
+		}
+
+		const Token &expect( Token::Kind kind )
+		{
+			if( current().kind != kind )
+			{
+				throw unexpected();
+			}
+			return m_tokens[m_position++];
+		}
+
+		void expect( const char *op )
+		{
+			if( !matchOperator( op ) )
+			{
+				throw syntaxError( current().line, fmt::format( "Expected \"{}\"", op ) );
+			}
+		}
+
+		void expectName( const char *name )
+		{
+			if( !matchName( name ) )
+			{
+				throw syntaxError( current().line, fmt::format( "Expected \"{}\"", name ) );
+			}
+		}
+
+		IECore::Exception unexpected() const
+		{
+			const Token &token = current();
+			switch( token.kind )
+			{
+				case Token::Kind::Newline :
+				case Token::Kind::End :
+					return syntaxError( token.line, "Unexpected end of line" );
+				case Token::Kind::Indent :
+					return syntaxError( token.line, "Unexpected indent" );
+				case Token::Kind::Dedent :
+					return syntaxError( token.line, "Unexpected dedent" );
+				default :
+					return syntaxError( token.line, fmt::format( "Unexpected \"{}\"", token.text ) );
+			}
+		}
+
+		static bool isReserved( const std::string &name )
+		{
+			static const std::unordered_set<std::string> g_reserved = {
+				"and", "or", "not", "in", "if", "elif", "else", "pass",
+				"True", "False", "None", "context"
+			};
+			return g_reserved.count( name );
+		}
+
+		std::vector<Token> m_tokens;
+		size_t m_position;
+
+		Program m_program;
+		size_t m_nextRegister;
+		std::unordered_set<uint16_t> m_namedRegisters;
+		std::unordered_map<std::string, uint16_t> m_locals;
+		std::vector<std::string> m_inputPaths;
+		std::vector<std::string> m_outputPaths;
+		std::vector<uint16_t> m_outputRegisters;
+
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Plug utilities
+//////////////////////////////////////////////////////////////////////////
+
+bool supportedPlugType( const ValuePlug *plug )
+{
+	switch( (Gaffer::TypeId)plug->typeId() )
+	{
+		case BoolPlugTypeId :
+		case IntPlugTypeId :
+		case FloatPlugTypeId :
+		case StringPlugTypeId :
+		case V2iPlugTypeId :
+		case V3iPlugTypeId :
+		case V2fPlugTypeId :
+		case V3fPlugTypeId :
+		case Color3fPlugTypeId :
+		case Color4fPlugTypeId :
+			return true;
+		default :
+			return false;
+	}
+}
+
+Value plugValue( const ValuePlug *plug, bool defaultValue )
+{
+	Value result;
+	switch( (Gaffer::TypeId)plug->typeId() )
+	{
+		case BoolPlugTypeId :
+			return boolValue( defaultValue ? static_cast<const BoolPlug *>( plug )->defaultValue() : static_cast<const BoolPlug *>( plug )->getValue() );
+		case IntPlugTypeId :
+			return intValue( defaultValue ? static_cast<const IntPlug *>( plug )->defaultValue() : static_cast<const IntPlug *>( plug )->getValue() );
+		case FloatPlugTypeId :
+			return floatValue( defaultValue ? static_cast<const FloatPlug *>( plug )->defaultValue() : static_cast<const FloatPlug *>( plug )->getValue() );
+		case StringPlugTypeId :
+			return Value( defaultValue ? static_cast<const StringPlug *>( plug )->defaultValue() : static_cast<const StringPlug *>( plug )->getValue() );
+		case V2iPlugTypeId :
+			setVector( result, Type::V2i, defaultValue ? static_cast<const V2iPlug *>( plug )->defaultValue() : static_cast<const V2iPlug *>( plug )->getValue() );
+			return result;
+		case V3iPlugTypeId :
+			setVector( result, Type::V3i, defaultValue ? static_cast<const V3iPlug *>( plug )->defaultValue() : static_cast<const V3iPlug *>( plug )->getValue() );
+			return result;
+		case V2fPlugTypeId :
+			setVector( result, Type::V2f, defaultValue ? static_cast<const V2fPlug *>( plug )->defaultValue() : static_cast<const V2fPlug *>( plug )->getValue() );
+			return result;
+		case V3fPlugTypeId :
+			setVector( result, Type::V3f, defaultValue ? static_cast<const V3fPlug *>( plug )->defaultValue() : static_cast<const V3fPlug *>( plug )->getValue() );
+			return result;
+		case Color3fPlugTypeId :
+			setVector( result, Type::Color3f, defaultValue ? static_cast<const Color3fPlug *>( plug )->defaultValue() : static_cast<const Color3fPlug *>( plug )->getValue() );
+			return result;
+		case Color4fPlugTypeId :
+			setVector( result, Type::Color4f, defaultValue ? static_cast<const Color4fPlug *>( plug )->defaultValue() : static_cast<const Color4fPlug *>( plug )->getValue() );
+			return result;
+		default :
+			return result;
+	}
+}
+
+ObjectPtr toObject( const Value &value )
+{
+	switch( value.type )
+	{
+		case Type::None :
+			return new NullObject;
+		case Type::Bool :
+			return new BoolData( value.v[0] != 0 );
+		case Type::Int :
+			return new IntData( static_cast<int>( value.v[0] ) );
+		case Type::Float :
+			return new FloatData( static_cast<float>( value.v[0] ) );
+		case Type::String :
+			return new StringData( value.s );
+		case Type::V2i :
+			return new V2iData( getVector<V2i>( value ) );
+		case Type::V3i :
+			return new V3iData( getVector<V3i>( value ) );
+		case Type::V2f :
+			return new V2fData( getVector<V2f>( value ) );
+		case Type::V3f :
+			return new V3fData( getVector<V3f>( value ) );
+		case Type::Color3f :
+			return new Color3fData( getVector<Color3f>( value ) );
+		case Type::Color4f :
+			return new Color4fData( getVector<Color4f>( value ) );
+	}
+	return nullptr;
+}
+
+Value fromObject( const Object *object )
+{
+	Value result;
+	switch( object->typeId() )
+	{
+		case BoolDataTypeId :
+			return boolValue( static_cast<const BoolData *>( object )->readable() );
+		case IntDataTypeId :
+			return intValue( static_cast<const IntData *>( object )->readable() );
+		case FloatDataTypeId :
+			return floatValue( static_cast<const FloatData *>( object )->readable() );
+		case StringDataTypeId :
+			return Value( static_cast<const StringData *>( object )->readable() );
+		case V2iDataTypeId :
+			setVector( result, Type::V2i, static_cast<const V2iData *>( object )->readable() );
+			break;
+		case V3iDataTypeId :
+			setVector( result, Type::V3i, static_cast<const V3iData *>( object )->readable() );
+			break;
+		case V2fDataTypeId :
+			setVector( result, Type::V2f, static_cast<const V2fData *>( object )->readable() );
+			break;
+		case V3fDataTypeId :
+			setVector( result, Type::V3f, static_cast<const V3fData *>( object )->readable() );
+			break;
+		case Color3fDataTypeId :
+			setVector( result, Type::Color3f, static_cast<const Color3fData *>( object )->readable() );
+			break;
+		case Color4fDataTypeId :
+			setVector( result, Type::Color4f, static_cast<const Color4fData *>( object )->readable() );
+			break;
+		default :
+			break;
+	}
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// NativeExpressionEngine
+//////////////////////////////////////////////////////////////////////////
+
+class NativeExpressionEngine : public Gaffer::Expression::Engine
+{
+
+	public :
+
+		IE_CORE_DECLAREMEMBERPTR( NativeExpressionEngine );
+
+		NativeExpressionEngine()
+		{
+		}
+
+		void parse( Expression *node, const std::string &expression, std::vector<ValuePlug *> &inputs, std::vector<ValuePlug *> &outputs, std::vector<IECore::InternedString> &contextVariables ) override
+		{
+			std::vector<std::string> inputPaths, outputPaths;
+			Program program = Compiler( expression ).compile( inputPaths, outputPaths, contextVariables );
+
+			for( const auto &path : inputPaths )
+			{
+				inputs.push_back( plug( node, path ) );
+			}
+			for( const auto &path : outputPaths )
+			{
+				outputs.push_back( plug( node, path ) );
+			}
+
+			m_program = std::move( program );
+		}
+
+		IECore::ConstObjectVectorPtr execute( const Gaffer::Context *context, const std::vector<const Gaffer::ValuePlug *> &proxyInputs ) const override
+		{
+			Registers registers;
+			run( m_program, context, proxyInputs, registers );
+
+			ObjectVectorPtr result = new ObjectVector;
+			result->members().reserve( m_program.outputRegisters.size() );
+			for( uint16_t r : m_program.outputRegisters )
+			{
+				result->members().push_back( toObject( registers[r] ) );
+			}
+
+			return result;
+		}
+
+		ValuePlug::CachePolicy executeCachePolicy() const override
+		{
+			return ValuePlug::CachePolicy::Default;
+		}
+
+		void apply( Gaffer::ValuePlug *proxyOutput, const Gaffer::ValuePlug *topLevelProxyOutput, const IECore::Object *value ) const override
+		{
+			// NullObject signifies that the expression didn't
+			// provide a value at all - set the plug to its default.
+			if( value->typeId() == NullObjectTypeId )
+			{
+				proxyOutput->setToDefault();
+				return;
+			}
+
+			Value v = fromObject( value );
+			if( proxyOutput != topLevelProxyOutput && dimension( v.type ) > 1 )
+			{
+				// Extract the component for a child of a compound plug.
+				const auto &children = topLevelProxyOutput->children();
+				const size_t index = std::find( children.begin(), children.end(), proxyOutput ) - children.begin();
+				if( index >= (size_t)dimension( v.type ) )
+				{
+					throw IECore::Exception( fmt::format(
+						"Cannot set \"{}\" from value of type \"{}\"", topLevelProxyOutput->typeName(), typeName( v.type )
+					) );
+				}
+				v = componentValue( v.type, v.v[index] );
+			}
+
+			switch( (Gaffer::TypeId)proxyOutput->typeId() )
+			{
+				case BoolPlugTypeId :
+					static_cast<BoolPlug *>( proxyOutput )->setValue( number( v, "BoolPlug" ) != 0 );
+					return;
+				case IntPlugTypeId :
+					static_cast<IntPlug *>( proxyOutput )->setValue( static_cast<int>( number( v, "IntPlug" ) ) );
+					return;
+				case FloatPlugTypeId :
+					static_cast<FloatPlug *>( proxyOutput )->setValue( static_cast<float>( number( v, "FloatPlug" ) ) );
+					return;
+				case StringPlugTypeId :
+					if( v.type == Type::String )
+					{
+						static_cast<StringPlug *>( proxyOutput )->setValue( v.s );
+						return;
+					}
+					break;
+				default :
+					break;
+			}
+
+			throw IECore::Exception( fmt::format(
+				"Cannot set \"{}\" from value of type \"{}\"", proxyOutput->typeName(), typeName( v.type )
+			) );
+		}
+
+		std::string identifier( const Expression *node, const ValuePlug *plug ) const override
+		{
+			if( !supportedPlugType( plug ) )
+			{
+				return "";
+			}
+
+			const std::string relativeName = node->isAncestorOf( plug ) ? plug->relativeName( node ) : plug->relativeName( node->parent<Node>() );
+			return "parent[\"" + boost::replace_all_copy( relativeName, ".", "\"][\"" ) + "\"]";
+		}
+
+		std::string replace( const Expression *node, const std::string &expression, const std::vector<const ValuePlug *> &oldPlugs, const std::vector<const ValuePlug *> &newPlugs ) const override
+		{
+			std::string result = expression;
+			for( size_t i = 0; i < oldPlugs.size(); ++i )
+			{
+				std::string replacement;
+				if( newPlugs[i] )
+				{
+					replacement = identifier( node, newPlugs[i] );
+				}
+				else if( oldPlugs[i]->direction() == Plug::In )
+				{
+					replacement = literal( plugValue( oldPlugs[i], /* defaultValue = */ true ) );
+				}
+				else
+				{
+					replacement = "__disconnected";
+				}
+
+				// Match either quote style, escaping everything else.
+				const std::string identifier = this->identifier( node, oldPlugs[i] );
+				if( identifier.empty() )
+				{
+					continue;
+				}
+				std::string regex;
+				for( char c : identifier )
+				{
+					if( c == '"' )
+					{
+						regex += "[\"']";
+					}
+					else if( isalnum( c ) || c == '_' )
+					{
+						regex += c;
+					}
+					else
+					{
+						regex += std::string( "\\" ) + c;
+					}
+				}
+
+				result = boost::regex_replace( result, boost::regex( regex ), replacement, boost::format_literal );
+			}
+
+			return result;
+		}
+
+		std::string defaultExpression( const ValuePlug *output ) const override
+		{
+			const Node *parentNode = output->node() ? output->node()->ancestor<Node>() : nullptr;
+			if( !parentNode || !supportedPlugType( output ) )
+			{
+				return "";
+			}
+
+			return "parent[\"" + boost::replace_all_copy( output->relativeName( parentNode ), ".", "\"][\"" ) + "\"] = " +
+				literal( plugValue( output, /* defaultValue = */ false ) );
+		}
+
+	private :
+
+		static ValuePlug *plug( Expression *node, const std::string &path )
+		{
+			Node *parent = node->parent<Node>();
+			ValuePlug *result = parent ? parent->descendant<ValuePlug>( path ) : nullptr;
+			if( !result )
+			{
+				throw IECore::Exception( fmt::format( "\"{}\" does not exist", path ) );
+			}
+
+			if( !supportedPlugType( result ) )
+			{
+				throw IECore::Exception( fmt::format( "\"{}\" has unsupported type \"{}\"", path, result->typeName() ) );
+			}
+
+			return result;
+		}
+
+		Program m_program;
+
+		static Expression::Engine::EngineDescription<NativeExpressionEngine> g_engineDescription;
+
+};
+
+Expression::Engine::EngineDescription<NativeExpressionEngine> NativeExpressionEngine::g_engineDescription( "native" );
+
+//////////////////////////////////////////////////////////////////////////
+// Python conversion
+//////////////////////////////////////////////////////////////////////////
+
+// Applies `f` to the parts of `source` outside string literals.
+template<typename F>
+std::string transformCode( const std::string &source, F &&f )
+{
+	std::string result;
+	size_t codeStart = 0;
+	for( size_t i = 0, e = source.size(); i < e; ++i )
+	{
+		const char quote = source[i];
+		if( quote != '"' && quote != '\'' )
+		{
+			continue;
+		}
+
+		result += f( source.substr( codeStart, i - codeStart ) );
+		size_t end = i + 1;
+		while( end < e && source[end] != quote && source[end] != '\n' )
+		{
+			end += source[end] == '\\' ? 2 : 1;
+		}
+		end = std::min( end + 1, e );
+		result += source.substr( i, end - i );
+		codeStart = end;
+		i = end - 1;
+	}
+
+	return result + f( source.substr( std::min( codeStart, source.size() ) ) );
+}
+
+} // namespace
+
+std::string Gaffer::NativeExpressionEngine::convertPythonExpression( const std::string &pythonExpression )
+{
+	static const boost::regex g_import( R"(^[ \t]*(import|from)\s[^\n;]*;?[ \t]*)" );
+	static const boost::regex g_module( R"(\b(imath|math|IECore|Gaffer)\.(\w+))" );
+	// Python doesn't allow `None` to be assigned to a plug, whereas the native
+	// language uses it to reset a plug to its default value. We don't convert
+	// such expressions, so that their behaviour is preserved.
+	static const boost::regex g_none( R"(\bNone\b)" );
+	static const std::unordered_map<std::string, std::string> g_names = {
+		{ "imath.V2i", "V2i" }, { "imath.V3i", "V3i" }, { "imath.V2f", "V2f" }, { "imath.V3f", "V3f" },
+		{ "imath.Color3f", "Color3f" }, { "imath.Color4f", "Color4f" },
+		{ "math.floor", "floor" }, { "math.ceil", "ceil" }, { "math.sqrt", "sqrt" }, { "math.pow", "pow" },
+		{ "math.sin", "sin" }, { "math.cos", "cos" }, { "math.tan", "tan" }, { "math.fabs", "abs" }
+	};
+
+	bool supported = true;
+	std::string result = transformCode(
+		pythonExpression,
+		[&] ( const std::string &code ) {
+			supported = supported && !boost::regex_search( code, g_none );
+
+			// Loop so that we remove all of `import a; import b`.
+			std::string c = code;
+			for( std::string previous; previous != c; )
+			{
+				previous = c;
+				c = boost::regex_replace( previous, g_import, "" );
+			}
+
+			std::string converted;
+			auto last = c.cbegin();
+			for( boost::sregex_iterator it( c.begin(), c.end(), g_module ), eIt; it != eIt; ++it )
+			{
+				auto name = g_names.find( it->str() );
+				supported = supported && name != g_names.end();
+				converted.append( last, (*it)[0].first );
+				converted += name != g_names.end() ? name->second : it->str();
+				last = (*it)[0].second;
+			}
+			converted.append( last, c.cend() );
+			return converted;
+		}
+	);
+
+	if( !supported )
+	{
+		return "";
+	}
+
+	// Remove blank lines left behind by imports.
+	boost::trim_left( result );
+
+	// Validate the result by compiling it.
+	try
+	{
+		std::vector<std::string> inputPaths, outputPaths;
+		std::vector<InternedString> contextVariables;
+		Compiler( result ).compile( inputPaths, outputPaths, contextVariables );
+		if( outputPaths.empty() )
+		{
+			return "";
+		}
+	}
+	catch( const std::exception & )
+	{
+		return "";
+	}
+
+	return result;
+}
+
+bool Gaffer::NativeExpressionEngine::convertPythonExpression( Expression *expression )
+{
+	std::string language;
+	const std::string pythonExpression = expression->getExpression( language );
+	if( language != "python" )
+	{
+		return false;
+	}
+
+	const std::string nativeExpression = convertPythonExpression( pythonExpression );
+	if( nativeExpression.empty() )
+	{
+		return false;
+	}
+
+	try
+	{
+		expression->setExpression( nativeExpression, "native" );
+	}
+	catch( const std::exception & )
+	{
+		return false;
+	}
+
+	return true;
+}
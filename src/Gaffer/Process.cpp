@@ -231,6 +231,14 @@ bool Process::forceMonitoringInternal( const ThreadState &s, const Plug *plug, c
 	return false;
 }
 
+void Process::monitorCacheLookupInternal( const ThreadState &s, const Plug *plug, const IECore::InternedString &processType, Monitor::CacheLookup lookup )
+{
+	for( const auto &m : *s.m_monitors )
+	{
+		m->cacheLookup( plug, processType, lookup );
+	}
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 // ProcessException
@@ -40,22 +40,106 @@
 #include "Gaffer/Action.h"
 #include "Gaffer/ComputeNode.h"
 #include "Gaffer/Context.h"
+#include "Gaffer/MemoryPressure.h"
 #include "Gaffer/Private/IECorePreview/LRUCache.h"
 #include "Gaffer/Process.h"
+#include "Gaffer/TypeIds.h"
+#include "Gaffer/Version.h"
 
+#include "IECore/MemoryIndexedIO.h"
 #include "IECore/MessageHandler.h"
+#include "IECore/TypedData.h"
+#include "IECore/TypedData.inl"
+#include "IECore/VectorTypedData.h"
 
 #include "boost/bind/bind.hpp"
+#include "boost/interprocess/mapped_region.hpp"
+#include "boost/interprocess/shared_memory_object.hpp"
+
+#ifndef _MSC_VER
+	#include <signal.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#else
+	#include <process.h>
+#endif
 
 #include "tbb/enumerable_thread_specific.h"
 
 #include "fmt/format.h"
 
+#include <algorithm>
 #include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_set>
 
 using namespace Gaffer;
 
+//////////////////////////////////////////////////////////////////////////
+// EncodedCacheValueData. Stores a value encoded by a CacheCodec in the
+// compute cache, along with the codec needed to decode it again.
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+struct EncodedCacheValue
+{
+	IECore::ConstObjectPtr value;
+	ValuePlug::ConstCacheCodecPtr codec;
+
+	bool operator == ( const EncodedCacheValue &rhs ) const
+	{
+		return value == rhs.value && codec == rhs.codec;
+	}
+};
+
+} // namespace
+
+namespace IECore
+{
+
+IECORE_DECLARE_TYPEDDATA( EncodedCacheValueData, EncodedCacheValue, void, IECore::SharedDataHolder );
+
+IECORE_RUNTIMETYPED_DEFINETEMPLATESPECIALISATION( EncodedCacheValueData, Gaffer::EncodedCacheValueDataTypeId )
+
+template<>
+void EncodedCacheValueData::save( SaveContext *context ) const
+{
+	throw IECore::NotImplementedException( "EncodedCacheValueData::save Not implemented" );
+}
+
+template<>
+void EncodedCacheValueData::load( LoadContextPtr context )
+{
+	throw IECore::NotImplementedException( "EncodedCacheValueData::load Not implemented" );
+}
+
+template<>
+void EncodedCacheValueData::memoryUsage( Object::MemoryAccumulator &accumulator ) const
+{
+	Data::memoryUsage( accumulator );
+	accumulator.accumulate( sizeof( EncodedCacheValue ) );
+	accumulator.accumulate( readable().value.get() );
+}
+
+template<>
+MurmurHash SharedDataHolder<EncodedCacheValue>::hash() const
+{
+	return readable().value->hash();
+}
+
+template class TypedData<EncodedCacheValue>;
+
+} // namespace IECore
+
 //////////////////////////////////////////////////////////////////////////
 // Utilities
 //////////////////////////////////////////////////////////////////////////
@@ -63,6 +147,26 @@ using namespace Gaffer;
 namespace
 {
 
+IECore::ConstObjectPtr encodeCachedValue( IECore::ConstObjectPtr value, const ValuePlug::CacheCodec *codec )
+{
+	if( IECore::ConstObjectPtr encoded = codec->encode( value.get() ) )
+	{
+		return new IECore::EncodedCacheValueData( { encoded, codec } );
+	}
+	return value;
+}
+
+IECore::ConstObjectPtr decodeCachedValue( IECore::ConstObjectPtr value )
+{
+	if( value->typeId() != (IECore::TypeId)EncodedCacheValueDataTypeId )
+	{
+		return value;
+	}
+
+	const EncodedCacheValue &encoded = static_cast<const IECore::EncodedCacheValueData *>( value.get() )->readable();
+	return encoded.codec->decode( encoded.value.get() );
+}
+
 // Before using the HashProcess/ComputeProcess classes to get a hash or
 // a value, we first traverse back down the chain of input plugs to the
 // start, or till we find a plug of a different type. This traversal is
@@ -275,6 +379,7 @@ class ValuePlug::HashProcess : public Process
 				{
 					if( auto result = threadData.cache.getIfCached( cacheKey ) )
 					{
+						Process::monitorCacheLookup( threadState, p, staticType, Monitor::CacheLookup::Hit );
 						return *result;
 					}
 				}
@@ -284,6 +389,7 @@ class ValuePlug::HashProcess : public Process
 				IECore::MurmurHash result;
 				if( cachePolicy == CachePolicy::Default )
 				{
+					Process::monitorCacheLookup( threadState, p, staticType, Monitor::CacheLookup::Miss );
 					result = HashProcess( p, plug, computeNode ).run();
 				}
 				else
@@ -295,6 +401,7 @@ class ValuePlug::HashProcess : public Process
 					}
 					if( cachedValue )
 					{
+						Process::monitorCacheLookup( threadState, p, staticType, Monitor::CacheLookup::Hit );
 						result = *cachedValue;
 					}
 					else
@@ -393,6 +500,17 @@ class ValuePlug::HashProcess : public Process
 			return usage;
 		}
 
+		static size_t totalCacheEvictions()
+		{
+			size_t evictions = g_cache.evictions();
+			tbb::enumerable_thread_specific<ThreadData>::iterator it, eIt;
+			for( it = g_threadData.begin(), eIt = g_threadData.end(); it != eIt; ++it )
+			{
+				evictions += it->cache.evictions();
+			}
+			return evictions;
+		}
+
 		static void dirtyLegacyCache()
 		{
 			if( g_hashCacheMode != HashCacheMode::Standard )
@@ -453,7 +571,9 @@ class ValuePlug::HashProcess : public Process
 			}
 		}
 
-		using CacheType = IECorePreview::LRUCache<HashCacheKey, IECore::MurmurHash, IECorePreview::LRUCachePolicy::Parallel>;
+		// Many threads frequently hash the same upstream plugs, so we use
+		// lock-free reads to avoid contention in `getIfCached()`.
+		using CacheType = IECorePreview::LRUCache<HashCacheKey, IECore::MurmurHash, IECorePreview::LRUCachePolicy::ParallelLockFreeRead>;
 		static CacheType g_cache;
 
 		static size_t cacheCostFunction( const IECore::MurmurHash &value )
@@ -492,6 +612,698 @@ ValuePlug::HashProcess::CacheType ValuePlug::HashProcess::g_cache( CacheType::Ge
 std::atomic<uint64_t> ValuePlug::HashProcess::g_legacyGlobalDirtyCount( 0 );
 ValuePlug::HashCacheMode ValuePlug::HashProcess::g_hashCacheMode( defaultHashCacheMode() );
 
+//////////////////////////////////////////////////////////////////////////
+// Serialisation of values for the disk and shared memory caches.
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+const IECore::IndexedIO::EntryID g_cacheEntryName( "value" );
+
+// Records whether any warnings or errors have been emitted, without
+// outputting them.
+class FailureMessageHandler : public IECore::MessageHandler
+{
+
+	public :
+
+		void handle( Level level, const std::string &context, const std::string &message ) override
+		{
+			if( level == Error || level == Warning )
+			{
+				m_failed = true;
+			}
+		}
+
+		bool failed() const
+		{
+			return m_failed;
+		}
+
+	private :
+
+		bool m_failed = false;
+
+};
+
+IE_CORE_DECLAREPTR( FailureMessageHandler );
+
+IECore::ConstObjectPtr deserialiseCacheValue( IECore::ConstCharVectorDataPtr buffer )
+{
+	IECore::IndexedIOPtr io = new IECore::MemoryIndexedIO( buffer, IECore::IndexedIO::rootPath, IECore::IndexedIO::Read );
+	return IECore::Object::load( io, g_cacheEntryName );
+}
+
+// Returns the serialised form of `value`, or null if it doesn't round-trip
+// exactly. Nodes must opt in to sharing values via
+// `ComputeNode::computeCacheShareable()`, but generic nodes may still pass
+// through values of any type. Some types aren't registered for loading, and
+// others report "Not implemented" via the message handler rather than
+// throwing, so we verify by loading the value back again.
+IECore::ConstCharVectorDataPtr serialiseCacheValue( const IECore::Object *value )
+{
+	if( !IECore::Object::isType( value->typeId() ) )
+	{
+		return nullptr;
+	}
+
+	FailureMessageHandlerPtr messageHandler = new FailureMessageHandler;
+	IECore::MessageHandler::Scope messageHandlerScope( messageHandler.get() );
+	try
+	{
+		IECore::MemoryIndexedIOPtr io = new IECore::MemoryIndexedIO( nullptr, IECore::IndexedIO::rootPath, IECore::IndexedIO::Write );
+		value->save( io, g_cacheEntryName );
+		IECore::ConstCharVectorDataPtr buffer = io->buffer();
+		IECore::ConstObjectPtr loaded = deserialiseCacheValue( buffer );
+		if( !messageHandler->failed() && loaded->isEqualTo( value ) )
+		{
+			return buffer;
+		}
+	}
+	catch( const std::exception & )
+	{
+	}
+
+	return nullptr;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// The DiskCache provides optional persistent storage for the results of
+// expensive computes, so that they may be reused by subsequent processes.
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Entries are stored one per file, in their serialised form. Loading an
+// entry updates its modification time, so that when the total size of the
+// entries exceeds the limit, the least recently used ones can be removed.
+class DiskCache
+{
+
+	public :
+
+		DiskCache( const std::string &directory, size_t sizeLimit )
+			:	m_directory( directory ),
+				// Hashes are not guaranteed to be stable between Gaffer versions,
+				// so we keep the entries for each version separate.
+				m_root(
+					std::filesystem::path( directory ) /
+					fmt::format( "gaffer-{}.{}.{}", GAFFER_MILESTONE_VERSION, GAFFER_MAJOR_VERSION, GAFFER_MINOR_VERSION )
+				),
+				m_sizeLimit( sizeLimit ), m_usage( 0 )
+		{
+			std::vector<EntryFile> entries;
+			m_usage = scan( entries );
+		}
+
+		const std::string &directory() const
+		{
+			return m_directory;
+		}
+
+		size_t sizeLimit() const
+		{
+			return m_sizeLimit;
+		}
+
+		// Returns true if a value with the specified memory usage is
+		// small enough to be worth serialising for storage.
+		bool accepts( size_t memoryUsage ) const
+		{
+			return memoryUsage <= m_sizeLimit / 4;
+		}
+
+		// Returns the value stored for `hash`, or null if there is no such
+		// value. Unreadable entries are treated as cache misses. If `buffer`
+		// is provided, it receives the serialised form of the value.
+		IECore::ConstObjectPtr load( const IECore::MurmurHash &hash, IECore::ConstCharVectorDataPtr *buffer = nullptr ) const
+		{
+			const std::filesystem::path fileName = entryPath( hash );
+			std::error_code errorCode;
+			const std::uintmax_t fileSize = std::filesystem::file_size( fileName, errorCode );
+			if( errorCode )
+			{
+				return nullptr;
+			}
+
+			try
+			{
+				IECore::CharVectorDataPtr fileBuffer = new IECore::CharVectorData;
+				fileBuffer->writable().resize( fileSize );
+				std::ifstream file( fileName, std::ios::binary );
+				if( !file.read( fileBuffer->writable().data(), fileSize ) )
+				{
+					throw IECore::IOException( "Failed to read file" );
+				}
+				IECore::ConstObjectPtr result = deserialiseCacheValue( fileBuffer );
+				std::filesystem::last_write_time( fileName, std::filesystem::file_time_type::clock::now(), errorCode );
+				if( buffer )
+				{
+					*buffer = fileBuffer;
+				}
+				return result;
+			}
+			catch( const std::exception &e )
+			{
+				IECore::msg( IECore::Msg::Warning, "ValuePlug", fmt::format( "Unable to read cache entry \"{}\" : {}", fileName.string(), e.what() ) );
+				return nullptr;
+			}
+		}
+
+		// Stores the serialised value `buffer` for `hash`. Failure to write is
+		// reported but is not considered an error, as the value remains
+		// available to the caller.
+		void save( const IECore::MurmurHash &hash, const IECore::CharVectorData *buffer ) const
+		{
+			const std::vector<char> &bytes = buffer->readable();
+			if( bytes.size() > m_sizeLimit / 4 )
+			{
+				// Would evict too many other entries.
+				return;
+			}
+
+			const std::filesystem::path fileName = entryPath( hash );
+			// We write to a temporary file and then rename it, so that other
+			// processes never see a partially written entry. The temporary name
+			// must be unique to this process and thread.
+			static std::atomic_uint64_t g_tempFileCount( 0 );
+			const std::filesystem::path tempFileName = fileName.parent_path() / fmt::format(
+				"{}.{}.{}.tmp", fileName.stem().string(), processID(), g_tempFileCount++
+			);
+			try
+			{
+				std::filesystem::create_directories( fileName.parent_path() );
+				{
+					std::ofstream file( tempFileName, std::ios::binary );
+					if( !file.write( bytes.data(), bytes.size() ) )
+					{
+						throw IECore::IOException( "Failed to write file" );
+					}
+				}
+				std::filesystem::rename( tempFileName, fileName );
+			}
+			catch( const std::exception &e )
+			{
+				IECore::msg( IECore::Msg::Warning, "ValuePlug", fmt::format( "Unable to write cache entry \"{}\" : {}", fileName.string(), e.what() ) );
+				std::error_code errorCode;
+				std::filesystem::remove( tempFileName, errorCode );
+				return;
+			}
+
+			if( m_usage.fetch_add( bytes.size() ) + bytes.size() > m_sizeLimit )
+			{
+				trim();
+			}
+		}
+
+	private :
+
+		struct EntryFile
+		{
+			std::filesystem::file_time_type time;
+			std::uintmax_t size;
+			std::filesystem::path path;
+		};
+
+		// Returns the total size of all entries, filling `entries` with their
+		// details.
+		size_t scan( std::vector<EntryFile> &entries ) const
+		{
+			size_t result = 0;
+			std::error_code errorCode;
+			for( std::filesystem::recursive_directory_iterator it( m_root, errorCode ), eIt; !errorCode && it != eIt; it.increment( errorCode ) )
+			{
+				if( it->path().extension() != g_extension )
+				{
+					continue;
+				}
+				std::error_code entryErrorCode;
+				EntryFile entry = { it->last_write_time( entryErrorCode ), it->file_size( entryErrorCode ), it->path() };
+				if( !entryErrorCode )
+				{
+					result += entry.size;
+					entries.push_back( entry );
+				}
+			}
+			return result;
+		}
+
+		// Removes the least recently used entries until we're comfortably within
+		// the size limit. Other processes may be writing to the same directory,
+		// so we measure the actual usage rather than relying on `m_usage`.
+		void trim() const
+		{
+			std::unique_lock<std::mutex> lock( m_trimMutex, std::try_to_lock );
+			if( !lock.owns_lock() )
+			{
+				// Another thread is already trimming.
+				return;
+			}
+
+			std::vector<EntryFile> entries;
+			size_t usage = scan( entries );
+			std::sort(
+				entries.begin(), entries.end(),
+				[] ( const EntryFile &a, const EntryFile &b ) { return a.time < b.time; }
+			);
+
+			const size_t targetUsage = m_sizeLimit / 4 * 3;
+			for( const auto &entry : entries )
+			{
+				if( usage <= targetUsage )
+				{
+					break;
+				}
+				std::error_code errorCode;
+				if( std::filesystem::remove( entry.path, errorCode ) )
+				{
+					usage -= entry.size;
+				}
+			}
+
+			m_usage = usage;
+		}
+
+		std::filesystem::path entryPath( const IECore::MurmurHash &hash ) const
+		{
+			// Entries are distributed between subdirectories to avoid
+			// excessively large directories.
+			const std::string hashString = hash.toString();
+			return m_root / hashString.substr( 0, 2 ) / ( hashString + g_extension );
+		}
+
+		static int processID()
+		{
+#ifdef _MSC_VER
+			return _getpid();
+#else
+			return getpid();
+#endif
+		}
+
+		static constexpr const char *g_extension = ".bin";
+
+		const std::string m_directory;
+		const std::filesystem::path m_root;
+		const size_t m_sizeLimit;
+		mutable std::atomic_size_t m_usage;
+		mutable std::mutex m_trimMutex;
+
+};
+
+using ConstDiskCachePtr = std::shared_ptr<const DiskCache>;
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// The SharedMemoryCache provides optional storage for the results of
+// expensive computes in a shared memory segment, so that they may be
+// reused by other processes running concurrently on the same host.
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// The segment consists of a header containing a direct-mapped table of
+// entries, followed by a data region which is used as a ring buffer. Values
+// are stored in their serialised form, because IECore objects can't live in
+// shared memory directly. Newly stored values simply overwrite the oldest
+// ones, and entries are validated against the absolute write position of
+// the ring buffer (which increases monotonically) to determine whether or
+// not their data is still intact.
+//
+// All access to the header is guarded by a spin lock holding the ID of the
+// owning process. This is only ever held for a handful of instructions, and
+// never while copying data, so contention is low. But we must be robust to
+// processes that are killed while holding it, so lock acquisition is bounded,
+// and a lock held by a process that no longer exists may be stolen. Process
+// IDs are qualified by PID namespace, because the segment may be shared
+// between containers, and a PID is meaningless outside its own namespace.
+class SharedMemoryCache
+{
+
+	public :
+
+		// Opens the segment called `name`, creating it with a size of
+		// `memoryLimit` bytes if it doesn't exist already. Throws if the
+		// segment can't be opened.
+		SharedMemoryCache( const std::string &name, size_t memoryLimit )
+			:	m_name( name )
+		{
+			using namespace boost::interprocess;
+
+			shared_memory_object segment;
+			try
+			{
+				segment = shared_memory_object( create_only, m_name.c_str(), read_write );
+				segment.truncate( std::max( memoryLimit, minimumSize() ) );
+			}
+			catch( const interprocess_exception &e )
+			{
+				if( e.get_error_code() != already_exists_error )
+				{
+					throw;
+				}
+				segment = shared_memory_object( open_only, m_name.c_str(), read_write );
+				// Wait for the creator to size the segment.
+				offset_t size = 0;
+				for( int i = 0; i < 1000 && segment.get_size( size ) && (size_t)size < minimumSize(); ++i )
+				{
+					std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+				}
+				if( (size_t)size < minimumSize() )
+				{
+					throw IECore::Exception( fmt::format( "Shared memory segment \"{}\" has invalid size", m_name ) );
+				}
+			}
+
+			m_region = mapped_region( segment, read_write );
+
+			// Zero-initialised memory is a valid empty cache, so all we need
+			// to do is check that the segment was created by the same version
+			// of Gaffer, using the same layout.
+			uint64_t existingMagic = 0;
+			header()->magic.compare_exchange_strong( existingMagic, magic() );
+			if( existingMagic != 0 && existingMagic != magic() )
+			{
+				throw IECore::Exception( fmt::format( "Shared memory segment \"{}\" was created by a different version of Gaffer", m_name ) );
+			}
+		}
+
+		const std::string &name() const
+		{
+			return m_name;
+		}
+
+		size_t size() const
+		{
+			return m_region.get_size();
+		}
+
+		// Returns the value stored for `hash`, or null if there is no such
+		// value.
+		IECore::ConstObjectPtr load( const IECore::MurmurHash &hash ) const
+		{
+			Entry entry;
+			{
+				Lock lock( header() );
+				if( !lock.acquired() )
+				{
+					return nullptr;
+				}
+				entry = slot( hash );
+				if( entry.h1 != hash.h1() || entry.h2 != hash.h2() || !entry.size || !intact( entry ) )
+				{
+					return nullptr;
+				}
+			}
+
+			// Copy the data out without holding the lock, and then check that
+			// it wasn't overwritten while we were copying it.
+
+			IECore::CharVectorDataPtr buffer = new IECore::CharVectorData;
+			buffer->writable().resize( entry.size );
+			std::memcpy( buffer->writable().data(), data() + entry.position % capacity(), entry.size );
+			std::atomic_thread_fence( std::memory_order_acquire );
+			if( !intact( entry ) || checksum( buffer->readable() ) != entry.checksum )
+			{
+				return nullptr;
+			}
+
+			try
+			{
+				return deserialiseCacheValue( buffer );
+			}
+			catch( const std::exception &e )
+			{
+				IECore::msg( IECore::Msg::Warning, "ValuePlug", fmt::format( "Unable to read shared cache entry : {}", e.what() ) );
+				return nullptr;
+			}
+		}
+
+		// Returns true if a value with the specified memory usage is small
+		// enough to be worth serialising for storage. Values that would occupy
+		// a significant fraction of the segment are not stored, since they
+		// would evict too many other entries.
+		bool accepts( size_t memoryUsage ) const
+		{
+			return memoryUsage <= capacity() / 4;
+		}
+
+		// Stores the serialised value `buffer` for `hash`.
+		void save( const IECore::MurmurHash &hash, const IECore::CharVectorData *buffer ) const
+		{
+			const std::vector<char> &bytes = buffer->readable();
+			if( bytes.empty() || bytes.size() > capacity() / 4 )
+			{
+				return;
+			}
+
+			// Reserve space at the head of the ring buffer, wrapping rather
+			// than splitting the data at the end.
+
+			Entry entry;
+			entry.h1 = hash.h1();
+			entry.h2 = hash.h2();
+			entry.size = bytes.size();
+			entry.checksum = checksum( bytes );
+			{
+				Lock lock( header() );
+				if( !lock.acquired() )
+				{
+					return;
+				}
+				uint64_t position = header()->head.load( std::memory_order_relaxed );
+				const uint64_t offset = position % capacity();
+				if( offset + entry.size > capacity() )
+				{
+					position += capacity() - offset;
+				}
+				entry.position = position;
+				header()->head.store( position + entry.size, std::memory_order_release );
+			}
+
+			std::memcpy( data() + entry.position % capacity(), bytes.data(), entry.size );
+
+			// Publish the entry, provided that other writers haven't already
+			// lapped us and claimed the space again.
+
+			Lock lock( header() );
+			if( lock.acquired() && intact( entry ) )
+			{
+				slot( hash ) = entry;
+			}
+		}
+
+		static void remove( const std::string &name )
+		{
+			boost::interprocess::shared_memory_object::remove( name.c_str() );
+		}
+
+	private :
+
+		struct Entry
+		{
+			uint64_t h1 = 0;
+			uint64_t h2 = 0;
+			uint64_t position = 0;
+			uint64_t size = 0;
+			uint64_t checksum = 0;
+		};
+
+		struct Header
+		{
+			std::atomic<uint64_t> magic;
+			std::atomic<uint64_t> lock;
+			std::atomic<uint64_t> head;
+		};
+
+		static_assert( std::atomic<uint64_t>::is_always_lock_free, "Shared memory requires lock-free atomics" );
+
+		class Lock
+		{
+
+			public :
+
+				Lock( Header *header )
+					:	m_header( header ), m_acquired( false )
+				{
+					const uint64_t processID = currentProcessID();
+					for( int i = 0; i < 100000; ++i )
+					{
+						uint64_t owner = 0;
+						if( m_header->lock.compare_exchange_weak( owner, processID, std::memory_order_acquire ) )
+						{
+							m_acquired = true;
+							return;
+						}
+						if( i && i % 10000 == 0 && !processExists( owner ) )
+						{
+							// Owner was killed while holding the lock. Steal it.
+							if( m_header->lock.compare_exchange_strong( owner, processID, std::memory_order_acquire ) )
+							{
+								m_acquired = true;
+								return;
+							}
+						}
+						std::this_thread::yield();
+					}
+				}
+
+				~Lock()
+				{
+					if( m_acquired )
+					{
+						m_header->lock.store( 0, std::memory_order_release );
+					}
+				}
+
+				bool acquired() const
+				{
+					return m_acquired;
+				}
+
+			private :
+
+				Header *m_header;
+				bool m_acquired;
+
+		};
+
+		// Returns an ID in which the upper 32 bits identify the PID namespace
+		// and the lower 32 bits hold the PID itself.
+		static uint64_t currentProcessID()
+		{
+#ifdef _MSC_VER
+			return _getpid();
+#else
+			return ( pidNamespaceID() << 32 ) | (uint32_t)getpid();
+#endif
+		}
+
+		static bool processExists( uint64_t processID )
+		{
+#ifdef _MSC_VER
+			// We have no cheap way of checking, so we assume the owner is still
+			// alive, and rely on bounded acquisition to avoid deadlock.
+			return true;
+#else
+			if( processID == 0 )
+			{
+				return true;
+			}
+			if( ( processID >> 32 ) != pidNamespaceID() )
+			{
+				// The owner is in another PID namespace, so `kill()` can't
+				// tell us anything about it. Assume it is still alive, and
+				// rely on bounded acquisition to avoid deadlock.
+				return true;
+			}
+			return kill( (pid_t)( processID & 0xffffffff ), 0 ) == 0 || errno != ESRCH;
+#endif
+		}
+
+#ifndef _MSC_VER
+		// Returns the inode of our PID namespace, which uniquely identifies it
+		// for the lifetime of the namespace. Returns 0 if namespaces aren't
+		// available, in which case all processes are assumed to share one.
+		static uint64_t pidNamespaceID()
+		{
+			static const uint64_t g_id = [] {
+				struct stat s;
+				if( stat( "/proc/self/ns/pid", &s ) == 0 )
+				{
+					return (uint64_t)(uint32_t)s.st_ino;
+				}
+				return uint64_t( 0 );
+			}();
+			return g_id;
+		}
+#endif
+
+		static uint64_t checksum( const std::vector<char> &bytes )
+		{
+			IECore::MurmurHash h;
+			h.append( bytes.data(), bytes.size() );
+			return h.h1() ^ h.h2();
+		}
+
+		// The number of slots is derived from the size of the segment, so that
+		// all processes agree on the layout.
+		size_t numSlots() const
+		{
+			return std::max<size_t>( 1024, size() / 32768 );
+		}
+
+		size_t headerSize() const
+		{
+			return sizeof( Header ) + numSlots() * sizeof( Entry );
+		}
+
+		size_t capacity() const
+		{
+			return size() - headerSize();
+		}
+
+		static size_t minimumSize()
+		{
+			return sizeof( Header ) + 1024 * sizeof( Entry ) + 1024 * 1024;
+		}
+
+		Header *header() const
+		{
+			return static_cast<Header *>( m_region.get_address() );
+		}
+
+		Entry &slot( const IECore::MurmurHash &hash ) const
+		{
+			Entry *slots = reinterpret_cast<Entry *>( header() + 1 );
+			return slots[hash.h1() % numSlots()];
+		}
+
+		char *data() const
+		{
+			return static_cast<char *>( m_region.get_address() ) + headerSize();
+		}
+
+		// Returns true if the data for `entry` hasn't been overwritten by
+		// more recent entries.
+		bool intact( const Entry &entry ) const
+		{
+			return header()->head.load( std::memory_order_acquire ) <= entry.position + capacity();
+		}
+
+		// Identifies the layout of the segment. Values are serialised using
+		// the hashes of the current Gaffer version, and hashes are not
+		// guaranteed to be stable between versions, so the version is
+		// included too.
+		static uint64_t magic()
+		{
+			static const uint64_t g_magic = [] {
+				IECore::MurmurHash h;
+				h.append( "gaffer03" );
+				h.append( GAFFER_MILESTONE_VERSION );
+				h.append( GAFFER_MAJOR_VERSION );
+				h.append( GAFFER_MINOR_VERSION );
+				// Zero is reserved to mean "uninitialised".
+				return std::max<uint64_t>( h.h1(), 1 );
+			}();
+			return g_magic;
+		}
+
+		const std::string m_name;
+		boost::interprocess::mapped_region m_region;
+
+};
+
+using ConstSharedMemoryCachePtr = std::shared_ptr<const SharedMemoryCache>;
+
+} // namespace
+
 //////////////////////////////////////////////////////////////////////////
 // The ComputeProcess manages the task of calling ComputeNode::compute()
 // and storing a cache of recently computed results.
@@ -506,12 +1318,48 @@ class ValuePlug::ComputeProcess : public Process
 
 		static size_t getCacheMemoryLimit()
 		{
-			return g_cache.getMaxCost();
+			return g_cacheMemoryLimit;
 		}
 
 		static void setCacheMemoryLimit( size_t bytes )
 		{
-			return g_cache.setMaxCost( bytes );
+			g_cacheMemoryLimit = bytes;
+			g_cache.setMaxCost( bytes );
+		}
+
+		// Called by MemoryPressure to adapt the cache's limit,
+		// using `g_cacheMemoryLimit` as an upper bound.
+		static void adaptCacheMemoryLimit( size_t usage, size_t target )
+		{
+			const size_t upperBound = g_cacheMemoryLimit;
+			size_t limit = g_cache.getMaxCost();
+			if( !target )
+			{
+				limit = upperBound;
+			}
+			else if( usage > target )
+			{
+				// Shrink by the amount we are over target, starting from the
+				// current contents of the cache, since it may not be full.
+				// Setting the limit evicts immediately, rather than waiting
+				// for the next insertion to do so. We retain a minimum size
+				// because the allocator may not return freed memory to the
+				// system, in which case usage will remain high regardless.
+				const size_t excess = usage - target;
+				const size_t current = std::min( limit, g_cache.currentCost() );
+				limit = std::max( current > excess ? current - excess : 0, upperBound / 16 );
+			}
+			else
+			{
+				// Grow gradually, to avoid oscillating.
+				limit = limit + ( target - usage ) / 2;
+			}
+
+			limit = std::min( limit, upperBound );
+			if( limit != g_cache.getMaxCost() )
+			{
+				g_cache.setMaxCost( limit );
+			}
 		}
 
 		static size_t cacheMemoryUsage()
@@ -519,11 +1367,89 @@ class ValuePlug::ComputeProcess : public Process
 			return g_cache.currentCost();
 		}
 
+		static size_t cacheEvictions()
+		{
+			return g_cache.evictions();
+		}
+
+		static size_t cacheEvictedMemory()
+		{
+			return g_cache.evictedCost();
+		}
+
 		static void clearCache()
 		{
 			g_cache.clear();
 		}
 
+		static void setCacheEvictionPolicy( CacheEvictionPolicy policy )
+		{
+			g_cache.setEvictionPolicy(
+				policy == CacheEvictionPolicy::CostAware ? CacheType::EvictionPolicy::CostAware : CacheType::EvictionPolicy::LRU
+			);
+		}
+
+		static CacheEvictionPolicy getCacheEvictionPolicy()
+		{
+			return g_cache.getEvictionPolicy() == CacheType::EvictionPolicy::CostAware ? CacheEvictionPolicy::CostAware : CacheEvictionPolicy::LRU;
+		}
+
+		static void setCacheDirectory( const std::string &directory, size_t sizeLimit )
+		{
+			ConstDiskCachePtr diskCache;
+			if( !directory.empty() )
+			{
+				diskCache = std::make_shared<const DiskCache>( directory, sizeLimit );
+			}
+			std::atomic_store( &g_diskCache, diskCache );
+		}
+
+		static std::string getCacheDirectory()
+		{
+			ConstDiskCachePtr diskCache = std::atomic_load( &g_diskCache );
+			return diskCache ? diskCache->directory() : "";
+		}
+
+		static size_t getCacheDirectorySizeLimit()
+		{
+			ConstDiskCachePtr diskCache = std::atomic_load( &g_diskCache );
+			return diskCache ? diskCache->sizeLimit() : 0;
+		}
+
+		static void setSharedCache( const std::string &name, size_t memoryLimit )
+		{
+			ConstSharedMemoryCachePtr sharedCache;
+			if( !name.empty() )
+			{
+				try
+				{
+					sharedCache = std::make_shared<const SharedMemoryCache>( name, memoryLimit );
+				}
+				catch( const std::exception &e )
+				{
+					throw IECore::Exception( fmt::format( "Unable to open shared cache \"{}\" : {}", name, e.what() ) );
+				}
+			}
+			std::atomic_store( &g_sharedCache, sharedCache );
+		}
+
+		static std::string getSharedCacheName()
+		{
+			ConstSharedMemoryCachePtr sharedCache = std::atomic_load( &g_sharedCache );
+			return sharedCache ? sharedCache->name() : "";
+		}
+
+		static size_t getSharedCacheMemoryLimit()
+		{
+			ConstSharedMemoryCachePtr sharedCache = std::atomic_load( &g_sharedCache );
+			return sharedCache ? sharedCache->size() : 0;
+		}
+
+		static void removeSharedCache( const std::string &name )
+		{
+			SharedMemoryCache::remove( name );
+		}
+
 		static const IECore::Object *value( const ValuePlug *plug, IECore::ConstObjectPtr &owner, const IECore::MurmurHash *precomputedHash )
 		{
 			const ValuePlug *p = sourcePlug( plug );
@@ -589,8 +1515,9 @@ class ValuePlug::ComputeProcess : public Process
 			{
 				if( auto result = g_cache.getIfCached( hash ) )
 				{
+					Process::monitorCacheLookup( threadState, p, staticType, Monitor::CacheLookup::Hit );
 					// Move avoids unnecessary additional addRef/removeRef.
-					owner = std::move( *result );
+					owner = decodeCachedValue( std::move( *result ) );
 					return owner.get();
 				}
 			}
@@ -605,6 +1532,8 @@ class ValuePlug::ComputeProcess : public Process
 				// lightweight enough and unlikely enough to be shared that in
 				// the worst case it's OK to do it redundantly on a few threads
 				// before it gets cached.
+				Process::monitorCacheLookup( threadState, p, staticType, Monitor::CacheLookup::Miss );
+				const auto startTime = std::chrono::steady_clock::now();
 				owner = ComputeProcess( p, plug, computeNode ).run();
 				// Store the value in the cache, but only if it isn't there already.
 				// The check is useful because it's common for an upstream compute
@@ -616,14 +1545,41 @@ class ValuePlug::ComputeProcess : public Process
 				// upstream node will already have computed the same result) and the
 				// attribute data itself consists of many small objects for which
 				// computing memory usage is slow.
-				g_cache.setIfUncached( hash, owner, cacheCostFunction );
+				if( const CacheCodec *codec = computeNode ? computeNode->computeCacheCodec( p ) : nullptr )
+				{
+					IECore::ConstObjectPtr cachedValue = encodeCachedValue( owner, codec );
+					g_cache.setIfUncached( hash, cachedValue, cacheCostFunction, std::chrono::steady_clock::now() - startTime );
+					// Return the decoded value rather than the original, so that results
+					// are consistent between cache hits and misses if the codec is lossy.
+					owner = decodeCachedValue( std::move( cachedValue ) );
+				}
+				else
+				{
+					g_cache.setIfUncached( hash, owner, cacheCostFunction, std::chrono::steady_clock::now() - startTime );
+				}
+				MemoryPressure::update();
 				return owner.get();
 			}
 			else
 			{
+				// The compute is expensive enough to warrant collaboration, so
+				// it may also be worth storing in the shared and disk caches, if
+				// we have them and the node allows it.
+				ConstDiskCachePtr diskCache;
+				ConstSharedMemoryCachePtr sharedCache;
+				if( computeNode->computeCacheShareable( p ) )
+				{
+					diskCache = std::atomic_load( &g_diskCache );
+					sharedCache = std::atomic_load( &g_sharedCache );
+				}
+				// The result is returned exactly as it is stored in the cache,
+				// so may need decoding.
 				owner = acquireCollaborativeResult<ComputeProcess>(
-					hash, p, plug, computeNode
+					hash, p, plug, computeNode, std::move( diskCache ), std::move( sharedCache ), &hash,
+					computeNode->computeCacheCodec( p )
 				);
+				owner = decodeCachedValue( std::move( owner ) );
+				MemoryPressure::update();
 				return owner.get();
 			}
 		}
@@ -649,9 +1605,15 @@ class ValuePlug::ComputeProcess : public Process
 
 		// Interface required by `Process::acquireCollaborativeResult()`.
 
-		ComputeProcess( const ValuePlug *plug, const ValuePlug *destinationPlug, const ComputeNode *computeNode )
-			:	Process( staticType, plug, destinationPlug ), m_computeNode( computeNode )
+		ComputeProcess(
+			const ValuePlug *plug, const ValuePlug *destinationPlug, const ComputeNode *computeNode,
+			ConstDiskCachePtr diskCache = nullptr, ConstSharedMemoryCachePtr sharedCache = nullptr, const IECore::MurmurHash *hash = nullptr,
+			const CacheCodec *codec = nullptr
+		)
+			:	Process( staticType, plug, destinationPlug ), m_computeNode( computeNode ),
+				m_diskCache( std::move( diskCache ) ), m_sharedCache( std::move( sharedCache ) ), m_hash( hash ), m_codec( codec )
 		{
+			assert( ( !m_diskCache && !m_sharedCache ) || m_hash );
 		}
 
 		IECore::ConstObjectPtr run() const
@@ -672,8 +1634,51 @@ class ValuePlug::ComputeProcess : public Process
 					{
 						throw IECore::Exception( "Plug has no ComputeNode." );
 					}
+					if( m_sharedCache )
+					{
+						if( IECore::ConstObjectPtr result = m_sharedCache->load( *m_hash ) )
+						{
+							return encode( result );
+						}
+					}
+					if( m_diskCache )
+					{
+						IECore::ConstCharVectorDataPtr buffer;
+						if( IECore::ConstObjectPtr result = m_diskCache->load( *m_hash, &buffer ) )
+						{
+							// Promote to the shared cache, so other processes
+							// can avoid the slower disk access.
+							if( m_sharedCache )
+							{
+								m_sharedCache->save( *m_hash, buffer.get() );
+							}
+							return encode( result );
+						}
+					}
 					// Cast is ok - see comment above.
 					m_computeNode->compute( const_cast<ValuePlug *>( valuePlug ), context() );
+					if( m_result )
+					{
+						// Serialisation is expensive, so we check that the value
+						// is small enough to be stored before doing it.
+						const size_t memoryUsage = m_result->memoryUsage();
+						const bool shared = m_sharedCache && m_sharedCache->accepts( memoryUsage );
+						const bool disk = m_diskCache && m_diskCache->accepts( memoryUsage );
+						if( shared || disk )
+						{
+							if( IECore::ConstCharVectorDataPtr buffer = serialiseCacheValue( m_result.get() ) )
+							{
+								if( shared )
+								{
+									m_sharedCache->save( *m_hash, buffer.get() );
+								}
+								if( disk )
+								{
+									m_diskCache->save( *m_hash, buffer.get() );
+								}
+							}
+						}
+					}
 				}
 				// The calls above should cause setValue() to be called on the result plug, which in
 				// turn will call ValuePlug::setObjectValue(), which will then store the result in
@@ -685,7 +1690,7 @@ class ValuePlug::ComputeProcess : public Process
 				}
 				// Move to avoid unnecessary reference count increment/decrement - we don't
 				// need `m_result` any more.
-				return std::move( m_result );
+				return encode( std::move( m_result ) );
 			}
 			catch( ... )
 			{
@@ -704,15 +1709,35 @@ class ValuePlug::ComputeProcess : public Process
 
 	private :
 
+		// The disk and shared caches store unencoded values, but the
+		// result we return is stored directly in `g_cache`.
+		IECore::ConstObjectPtr encode( IECore::ConstObjectPtr value ) const
+		{
+			return m_codec ? encodeCachedValue( std::move( value ), m_codec ) : value;
+		}
+
 		const ComputeNode *m_computeNode;
+		const ConstDiskCachePtr m_diskCache;
+		const ConstSharedMemoryCachePtr m_sharedCache;
+		const IECore::MurmurHash *m_hash;
+		const CacheCodec *m_codec;
 		IECore::ConstObjectPtr m_result;
 
+		static std::atomic_size_t g_cacheMemoryLimit;
+		static const bool g_memoryPressureRegistration;
+		static ConstDiskCachePtr g_diskCache;
+		static ConstSharedMemoryCachePtr g_sharedCache;
+
 };
 
 const IECore::InternedString ValuePlug::ComputeProcess::staticType( ValuePlug::computeProcessType() );
 // Using a null `GetterFunction` because it will never get called, because we only ever call `getIfCached()`.
 // Note : The default size here is overridden by `startup/Gaffer/cache.py`.
-ValuePlug::ComputeProcess::CacheType ValuePlug::ComputeProcess::g_cache( CacheType::GetterFunction(), 1024 * 1024 * 1024 * 1, CacheType::RemovalCallback(), /* cacheErrors = */ false ); // 1 gig
+std::atomic_size_t ValuePlug::ComputeProcess::g_cacheMemoryLimit( 1024 * 1024 * 1024 * 1 ); // 1 gig
+ValuePlug::ComputeProcess::CacheType ValuePlug::ComputeProcess::g_cache( CacheType::GetterFunction(), g_cacheMemoryLimit, CacheType::RemovalCallback(), /* cacheErrors = */ false );
+ConstDiskCachePtr ValuePlug::ComputeProcess::g_diskCache;
+ConstSharedMemoryCachePtr ValuePlug::ComputeProcess::g_sharedCache;
+const bool ValuePlug::ComputeProcess::g_memoryPressureRegistration = ( MemoryPressure::registerHandler( "ValuePlug", &ValuePlug::ComputeProcess::adaptCacheMemoryLimit ), true );
 
 //////////////////////////////////////////////////////////////////////////
 // SetValueAction implementation
@@ -1149,11 +2174,66 @@ size_t ValuePlug::cacheMemoryUsage()
 	return ComputeProcess::cacheMemoryUsage();
 }
 
+size_t ValuePlug::cacheEvictions()
+{
+	return ComputeProcess::cacheEvictions();
+}
+
+size_t ValuePlug::cacheEvictedMemory()
+{
+	return ComputeProcess::cacheEvictedMemory();
+}
+
 void ValuePlug::clearCache()
 {
 	ComputeProcess::clearCache();
 }
 
+void ValuePlug::setCacheEvictionPolicy( CacheEvictionPolicy policy )
+{
+	ComputeProcess::setCacheEvictionPolicy( policy );
+}
+
+ValuePlug::CacheEvictionPolicy ValuePlug::getCacheEvictionPolicy()
+{
+	return ComputeProcess::getCacheEvictionPolicy();
+}
+
+void ValuePlug::setCacheDirectory( const std::string &directory, size_t sizeLimit )
+{
+	ComputeProcess::setCacheDirectory( directory, sizeLimit );
+}
+
+std::string ValuePlug::getCacheDirectory()
+{
+	return ComputeProcess::getCacheDirectory();
+}
+
+size_t ValuePlug::getCacheDirectorySizeLimit()
+{
+	return ComputeProcess::getCacheDirectorySizeLimit();
+}
+
+void ValuePlug::setSharedCache( const std::string &name, size_t memoryLimit )
+{
+	ComputeProcess::setSharedCache( name, memoryLimit );
+}
+
+std::string ValuePlug::getSharedCacheName()
+{
+	return ComputeProcess::getSharedCacheName();
+}
+
+size_t ValuePlug::getSharedCacheMemoryLimit()
+{
+	return ComputeProcess::getSharedCacheMemoryLimit();
+}
+
+void ValuePlug::removeSharedCache( const std::string &name )
+{
+	ComputeProcess::removeSharedCache( name );
+}
+
 size_t ValuePlug::getHashCacheSizeLimit()
 {
 	return HashProcess::getCacheSizeLimit();
@@ -1174,6 +2254,11 @@ size_t ValuePlug::hashCacheTotalUsage()
 	return HashProcess::totalCacheUsage();
 }
 
+size_t ValuePlug::hashCacheTotalEvictions()
+{
+	return HashProcess::totalCacheEvictions();
+}
+
 void ValuePlug::setHashCacheMode( ValuePlug::HashCacheMode hashCacheMode )
 {
 	HashProcess::setHashCacheMode( hashCacheMode );
@@ -36,12 +36,21 @@
 
 #include "GafferImage/Blur.h"
 
+#include "GafferImage/BufferAlgo.h"
 #include "GafferImage/FilterAlgo.h"
 #include "GafferImage/Resample.h"
+#include "GafferImage/Sampler.h"
 
 #include "Gaffer/StringPlug.h"
 
+#include "tbb/parallel_for.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
 using namespace Imath;
+using namespace IECore;
 using namespace Gaffer;
 using namespace GafferImage;
 
@@ -49,6 +58,124 @@ GAFFER_NODE_DEFINE_TYPE( Blur );
 
 const char *g_blurFilterName = "smoothGaussian";
 
+namespace
+{
+
+// Coefficients for the third order recursive approximation to the gaussian described
+// in "Recursive implementation of the Gaussian filter", Young and van Vliet, 1995.
+struct RecursiveGaussian
+{
+
+	RecursiveGaussian( float radius )
+	{
+		if( radius <= 0.0f )
+		{
+			// Identity. We still need a margin of one pixel, to cover the
+			// data window expansion performed by the Convolution method.
+			b = 1.0; a1 = a2 = a3 = 0.0;
+			margin = 1;
+			return;
+		}
+
+		// Match the standard deviation of the "smoothGaussian" filter used by the
+		// Convolution method, which has weights of `exp( -5 * ( x / r )^2 )` for a
+		// support radius `r` of `radius + 1`.
+		const double sigma = ( radius + 1.0 ) / sqrt( 10.0 );
+
+		double q = sigma >= 2.5 ? 0.98711 * sigma - 0.96330 : 3.97156 - 4.14554 * sqrt( 1.0 - 0.26891 * sigma );
+		q = std::max( q, 0.0 );
+		const double q2 = q * q;
+		const double q3 = q2 * q;
+
+		const double b0 = 1.57825 + 2.44413 * q + 1.4281 * q2 + 0.422205 * q3;
+		a1 = ( 2.44413 * q + 2.85619 * q2 + 1.26661 * q3 ) / b0;
+		a2 = -( 1.4281 * q2 + 1.26661 * q3 ) / b0;
+		a3 = ( 0.422205 * q3 ) / b0;
+		b = 1.0 - ( a1 + a2 + a3 );
+
+		// Distance beyond the data window for which we run the recursion. This must
+		// cover the expanded data window, and be long enough for the response to an
+		// edge to settle, so that starting the backward pass at the end is accurate.
+		margin = (int)ceil( 8.0 * sigma );
+	}
+
+	double b;
+	double a1, a2, a3;
+	int margin;
+
+};
+
+// Filters `size` elements, where each element is `width` contiguous values and consecutive
+// elements are `stride` apart. This allows many independent signals to be filtered at once,
+// which vectorises well. Accumulation is performed in double precision, because the poles of
+// the filter are very close to 1 for large radii.
+void recursiveGaussian( const RecursiveGaussian &gaussian, float *data, int size, int width, int stride, vector<double> &buffer )
+{
+	// Forward pass. There are three extra elements at each end of the buffer, so that we can
+	// initialise the filter state to its steady state for a constant input. This is exact
+	// because we always start and end the recursion in regions of constant value outside the
+	// data window.
+
+	buffer.resize( ( size + 6 ) * width );
+	double *w = buffer.data() + 3 * width;
+
+	for( int i = -3; i < 0; ++i )
+	{
+		std::copy( data, data + width, w + i * width );
+	}
+
+	for( int i = 0; i < size; ++i )
+	{
+		const float *in = data + i * stride;
+		double *out = w + i * width;
+		for( int c = 0; c < width; ++c )
+		{
+			out[c] = gaussian.b * in[c] + gaussian.a1 * out[c - width] + gaussian.a2 * out[c - 2 * width] + gaussian.a3 * out[c - 3 * width];
+		}
+	}
+
+	// Backward pass, performed in place in the buffer.
+
+	for( int i = size; i < size + 3; ++i )
+	{
+		std::copy( w + ( size - 1 ) * width, w + size * width, w + i * width );
+	}
+
+	for( int i = size - 1; i >= 0; --i )
+	{
+		double *v = w + i * width;
+		float *out = data + i * stride;
+		for( int c = 0; c < width; ++c )
+		{
+			v[c] = gaussian.b * v[c] + gaussian.a1 * v[c + width] + gaussian.a2 * v[c + 2 * width] + gaussian.a3 * v[c + 3 * width];
+			out[c] = v[c];
+		}
+	}
+}
+
+// Applies `recursiveGaussian()` to `width` interleaved signals in parallel, splitting them
+// into groups of adjacent signals.
+void parallelRecursiveGaussian( const RecursiveGaussian &gaussian, float *data, int size, int width, const Canceller *canceller )
+{
+	const int groupSize = 16;
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<int>( 0, ( width + groupSize - 1 ) / groupSize ),
+		[&] ( const tbb::blocked_range<int> &range ) {
+			vector<double> buffer;
+			for( int i = range.begin(); i < range.end(); ++i )
+			{
+				Canceller::check( canceller );
+				const int begin = i * groupSize;
+				recursiveGaussian( gaussian, data + begin, size, std::min( groupSize, width - begin ), width, buffer );
+			}
+		},
+		taskGroupContext
+	);
+}
+
+} // namespace
+
 size_t Blur::g_firstPlugIndex = 0;
 
 Blur::Blur( const std::string &name )
@@ -61,12 +188,16 @@ Blur::Blur( const std::string &name )
 	addChild( new V2fPlug( "radius", Plug::In, V2f( 0 ), V2f( 0 ) ) );
 	addChild( resample->boundingModePlug()->createCounterpart( "boundingMode", Plug::In ) );
 	addChild( new BoolPlug( "expandDataWindow" ) );
+	addChild( new IntPlug( "method", Plug::In, (int)Method::Convolution, (int)Method::Convolution, (int)Method::Recursive ) );
 
 	addChild( new V2fPlug( "__filterScale", Plug::Out ) );
 
 	addChild( new AtomicBox2iPlug( "__resampledDataWindow", Plug::In, Box2i(), Plug::Default & ~Plug::Serialisable ) );
 	addChild( new FloatVectorDataPlug( "__resampledChannelData", Plug::In, ImagePlug::blackTile(), Plug::Default & ~Plug::Serialisable ) );
 
+	addChild( new FloatVectorDataPlug( "__horizontalPass", Plug::Out, ImagePlug::blackTile() ) );
+	addChild( new FloatVectorDataPlug( "__verticalPass", Plug::Out, ImagePlug::blackTile() ) );
+
 	addChild( resample );
 
 	resample->inPlug()->setInput( inPlug() );
@@ -118,44 +249,74 @@ const Gaffer::BoolPlug *Blur::expandDataWindowPlug() const
 	return getChild<BoolPlug>( g_firstPlugIndex + 2 );
 }
 
+Gaffer::IntPlug *Blur::methodPlug()
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 3 );
+}
+
+const Gaffer::IntPlug *Blur::methodPlug() const
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 3 );
+}
+
 Gaffer::V2fPlug *Blur::filterScalePlug()
 {
-	return getChild<V2fPlug>( g_firstPlugIndex + 3 );
+	return getChild<V2fPlug>( g_firstPlugIndex + 4 );
 }
 
 const Gaffer::V2fPlug *Blur::filterScalePlug() const
 {
-	return getChild<V2fPlug>( g_firstPlugIndex + 3 );
+	return getChild<V2fPlug>( g_firstPlugIndex + 4 );
 }
 
 Gaffer::AtomicBox2iPlug *Blur::resampledDataWindowPlug()
 {
-	return getChild<AtomicBox2iPlug>( g_firstPlugIndex + 4 );
+	return getChild<AtomicBox2iPlug>( g_firstPlugIndex + 5 );
 }
 
 const Gaffer::AtomicBox2iPlug *Blur::resampledDataWindowPlug() const
 {
-	return getChild<AtomicBox2iPlug>( g_firstPlugIndex + 4 );
+	return getChild<AtomicBox2iPlug>( g_firstPlugIndex + 5 );
 }
 
 Gaffer::FloatVectorDataPlug *Blur::resampledChannelDataPlug()
 {
-	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 5 );
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 6 );
 }
 
 const Gaffer::FloatVectorDataPlug *Blur::resampledChannelDataPlug() const
 {
-	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 5 );
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 6 );
+}
+
+Gaffer::FloatVectorDataPlug *Blur::horizontalPassPlug()
+{
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 7 );
+}
+
+const Gaffer::FloatVectorDataPlug *Blur::horizontalPassPlug() const
+{
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 7 );
+}
+
+Gaffer::FloatVectorDataPlug *Blur::verticalPassPlug()
+{
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 8 );
+}
+
+const Gaffer::FloatVectorDataPlug *Blur::verticalPassPlug() const
+{
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 8 );
 }
 
 Resample *Blur::resample()
 {
-	return getChild<Resample>( g_firstPlugIndex + 6 );
+	return getChild<Resample>( g_firstPlugIndex + 9 );
 }
 
 const Resample *Blur::resample() const
 {
-	return getChild<Resample>( g_firstPlugIndex + 6 );
+	return getChild<Resample>( g_firstPlugIndex + 9 );
 }
 
 void Blur::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
@@ -174,13 +335,40 @@ void Blur::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs )
 		outputs.push_back( filterScalePlug()->getChild<ValuePlug>( input->getName() ) );
 		outputs.push_back( outPlug()->dataWindowPlug() );
 		outputs.push_back( outPlug()->channelDataPlug() );
+		outputs.push_back( horizontalPassPlug() );
+		outputs.push_back( verticalPassPlug() );
 	}
 	else if(
-		input == resampledChannelDataPlug()
+		input == resampledChannelDataPlug() ||
+		input == methodPlug() ||
+		input == verticalPassPlug()
 	)
 	{
 		outputs.push_back( outPlug()->channelDataPlug() );
 	}
+
+	if(
+		input == inPlug()->channelDataPlug() ||
+		input == inPlug()->dataWindowPlug() ||
+		input == boundingModePlug()
+	)
+	{
+		outputs.push_back( horizontalPassPlug() );
+	}
+
+	if(
+		input == horizontalPassPlug() ||
+		input == inPlug()->dataWindowPlug() ||
+		input == boundingModePlug()
+	)
+	{
+		outputs.push_back( verticalPassPlug() );
+	}
+
+	if( input == inPlug()->dataWindowPlug() )
+	{
+		outputs.push_back( outPlug()->channelDataPlug() );
+	}
 }
 
 void Blur::hash( const ValuePlug *output, const Context *context, IECore::MurmurHash &h ) const
@@ -191,6 +379,54 @@ void Blur::hash( const ValuePlug *output, const Context *context, IECore::Murmur
 	{
 		radiusPlug()->getChild<ValuePlug>( output->getName() )->hash( h );
 	}
+	else if( output == horizontalPassPlug() )
+	{
+		Box2i dataWindow;
+		float radius;
+		Sampler::BoundingMode boundingMode;
+		{
+			ImagePlug::GlobalScope c( context );
+			dataWindow = inPlug()->dataWindowPlug()->getValue();
+			radius = radiusPlug()->getValue().x;
+			boundingMode = (Sampler::BoundingMode)boundingModePlug()->getValue();
+		}
+
+		const V2i &tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+		const int margin = RecursiveGaussian( radius ).margin;
+		const Box2i region(
+			V2i( dataWindow.min.x - margin, tileOrigin.y ),
+			V2i( dataWindow.max.x + margin, tileOrigin.y + ImagePlug::tileSize() )
+		);
+
+		Sampler sampler( inPlug(), context->get<std::string>( ImagePlug::channelNameContextName ), region, boundingMode );
+		sampler.hash( h );
+		h.append( radius );
+	}
+	else if( output == verticalPassPlug() )
+	{
+		Box2i dataWindow;
+		V2f radius;
+		int boundingMode;
+		{
+			ImagePlug::GlobalScope c( context );
+			dataWindow = inPlug()->dataWindowPlug()->getValue();
+			radius = radiusPlug()->getValue();
+			boundingMode = boundingModePlug()->getValue();
+		}
+
+		h.append( dataWindow );
+		h.append( radius );
+		h.append( boundingMode );
+		h.append( context->get<V2i>( ImagePlug::tileOriginContextName ).x );
+
+		ImagePlug::ChannelDataScope channelDataScope( context );
+		V2i horizontalPassOrigin( 0, ImagePlug::tileOrigin( dataWindow.min ).y );
+		for( ; horizontalPassOrigin.y < dataWindow.max.y; horizontalPassOrigin.y += ImagePlug::tileSize() )
+		{
+			channelDataScope.setTileOrigin( &horizontalPassOrigin );
+			horizontalPassPlug()->hash( h );
+		}
+	}
 }
 
 void Blur::compute( ValuePlug *output, const Context *context ) const
@@ -214,10 +450,148 @@ void Blur::compute( ValuePlug *output, const Context *context ) const
 		);
 		return;
 	}
+	else if( output == horizontalPassPlug() )
+	{
+		// Filter all the rows of a row of tiles, from the margin before the data window
+		// to the margin after it. Outside the data window, the sampler provides the constant
+		// values specified by the bounding mode, so we can start the recursion in the steady
+		// state for that value.
+
+		Box2i dataWindow;
+		float radius;
+		Sampler::BoundingMode boundingMode;
+		{
+			ImagePlug::GlobalScope c( context );
+			dataWindow = inPlug()->dataWindowPlug()->getValue();
+			radius = radiusPlug()->getValue().x;
+			boundingMode = (Sampler::BoundingMode)boundingModePlug()->getValue();
+		}
+
+		const V2i &tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+		const RecursiveGaussian gaussian( radius );
+		const Box2i region(
+			V2i( dataWindow.min.x - gaussian.margin, tileOrigin.y ),
+			V2i( dataWindow.max.x + gaussian.margin, tileOrigin.y + ImagePlug::tileSize() )
+		);
+
+		Sampler sampler( inPlug(), context->get<std::string>( ImagePlug::channelNameContextName ), region, boundingMode );
+
+		// Store transposed, so that the recursion can process all rows together.
+		FloatVectorDataPtr resultData = new FloatVectorData;
+		vector<float> &result = resultData->writable();
+		result.resize( region.size().x * ImagePlug::tileSize() );
+		sampler.visitPixels(
+			region,
+			[&result, &region] ( float v, int x, int y ) {
+				result[( x - region.min.x ) * ImagePlug::tileSize() + y - region.min.y] = v;
+			}
+		);
+
+		if( radius > 0.0f )
+		{
+			parallelRecursiveGaussian( gaussian, result.data(), region.size().x, ImagePlug::tileSize(), context->canceller() );
+		}
+
+		static_cast<FloatVectorDataPlug *>( output )->setValue( resultData );
+		return;
+	}
+	else if( output == verticalPassPlug() )
+	{
+		// Gather the horizontal pass for a column of tiles, for all rows from the margin
+		// before the data window to the margin after it, and then filter vertically.
+
+		Box2i dataWindow;
+		V2f radius;
+		Sampler::BoundingMode boundingMode;
+		{
+			ImagePlug::GlobalScope c( context );
+			dataWindow = inPlug()->dataWindowPlug()->getValue();
+			radius = radiusPlug()->getValue();
+			boundingMode = (Sampler::BoundingMode)boundingModePlug()->getValue();
+		}
+
+		const int tileSize = ImagePlug::tileSize();
+		const int tileOriginX = context->get<V2i>( ImagePlug::tileOriginContextName ).x;
+		const int horizontalMargin = RecursiveGaussian( radius.x ).margin;
+		const int horizontalPassMinX = dataWindow.min.x - horizontalMargin;
+		const int horizontalPassWidth = dataWindow.size().x + 2 * horizontalMargin;
+
+		const RecursiveGaussian gaussian( radius.y );
+		const int minY = dataWindow.min.y - gaussian.margin;
+		const int height = dataWindow.size().y + 2 * gaussian.margin;
+
+		FloatVectorDataPtr resultData = new FloatVectorData;
+		vector<float> &result = resultData->writable();
+		result.resize( height * tileSize, 0.0f );
+
+		const int firstTileY = ImagePlug::tileOrigin( dataWindow.min ).y;
+		const int numTileRows = ( dataWindow.max.y - firstTileY + tileSize - 1 ) / tileSize;
+
+		const ThreadState &threadState = ThreadState::current();
+		tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+		tbb::parallel_for(
+			tbb::blocked_range<int>( 0, numTileRows ),
+			[&] ( const tbb::blocked_range<int> &range ) {
+				ImagePlug::ChannelDataScope channelDataScope( threadState );
+				for( int i = range.begin(); i < range.end(); ++i )
+				{
+					const V2i horizontalPassOrigin( 0, firstTileY + i * tileSize );
+					channelDataScope.setTileOrigin( &horizontalPassOrigin );
+					ConstFloatVectorDataPtr horizontalPassData = horizontalPassPlug()->getValue();
+					const vector<float> &horizontalPass = horizontalPassData->readable();
+
+					const int yBegin = std::max( horizontalPassOrigin.y, dataWindow.min.y );
+					const int yEnd = std::min( horizontalPassOrigin.y + tileSize, dataWindow.max.y );
+					for( int x = 0; x < tileSize; ++x )
+					{
+						const int horizontalPassX = std::clamp( tileOriginX + x - horizontalPassMinX, 0, horizontalPassWidth - 1 );
+						const float *in = &horizontalPass[horizontalPassX * tileSize];
+						for( int y = yBegin; y < yEnd; ++y )
+						{
+							result[( y - minY ) * tileSize + x] = in[y - horizontalPassOrigin.y];
+						}
+					}
+				}
+			},
+			taskGroupContext
+		);
+
+		if( boundingMode == Sampler::Clamp )
+		{
+			// Extend the first and last rows of the data window into the margins.
+			// In Black mode, the margins are already zero.
+			const float *first = &result[( dataWindow.min.y - minY ) * tileSize];
+			const float *last = &result[( dataWindow.max.y - 1 - minY ) * tileSize];
+			for( int i = 0; i < gaussian.margin; ++i )
+			{
+				std::copy( first, first + tileSize, &result[i * tileSize] );
+				std::copy( last, last + tileSize, &result[( height - 1 - i ) * tileSize] );
+			}
+		}
+
+		if( radius.y > 0.0f )
+		{
+			parallelRecursiveGaussian( gaussian, result.data(), height, tileSize, context->canceller() );
+		}
+
+		static_cast<FloatVectorDataPlug *>( output )->setValue( resultData );
+		return;
+	}
 
 	FlatImageProcessor::compute( output, context );
 }
 
+Gaffer::ValuePlug::CachePolicy Blur::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == horizontalPassPlug() || output == verticalPassPlug() )
+	{
+		// These are shared by all the tiles in a row or column, and
+		// are computed using parallel tasks.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return FlatImageProcessor::computeCachePolicy( output );
+}
+
 void Blur::hashDataWindow( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	if( radiusPlug()->getValue() != V2f( 0 ) && expandDataWindowPlug()->getValue() )
@@ -244,24 +618,77 @@ Imath::Box2i Blur::computeDataWindow( const Gaffer::Context *context, const Imag
 
 void Blur::hashChannelData( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
-	if( radiusPlug()->getValue() != V2f( 0 ) )
+	const V2f radius = radiusPlug()->getValue();
+	if( radius == V2f( 0 ) )
 	{
-		h = resampledChannelDataPlug()->hash();
+		h = inPlug()->channelDataPlug()->hash();
+	}
+	else if( (Method)methodPlug()->getValue() == Method::Recursive )
+	{
+		FlatImageProcessor::hashChannelData( parent, context, h );
+
+		const Box2i dataWindow = inPlug()->dataWindow();
+		if( BufferAlgo::empty( dataWindow ) )
+		{
+			return;
+		}
+
+		const V2i &tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+		const V2i verticalPassOrigin( tileOrigin.x, 0 );
+		ImagePlug::ChannelDataScope channelDataScope( context );
+		channelDataScope.setTileOrigin( &verticalPassOrigin );
+		verticalPassPlug()->hash( h );
+		h.append( tileOrigin.y );
 	}
 	else
 	{
-		h = inPlug()->channelDataPlug()->hash();
+		h = resampledChannelDataPlug()->hash();
 	}
 }
 
 IECore::ConstFloatVectorDataPtr Blur::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
 {
-	if( radiusPlug()->getValue() != V2f( 0 ) )
+	const V2f radius = radiusPlug()->getValue();
+	if( radius == V2f( 0 ) )
 	{
-		return resampledChannelDataPlug()->getValue();
+		return inPlug()->channelDataPlug()->getValue();
+	}
+	else if( (Method)methodPlug()->getValue() == Method::Recursive )
+	{
+		const Box2i dataWindow = inPlug()->dataWindow();
+		if( BufferAlgo::empty( dataWindow ) )
+		{
+			return ImagePlug::blackTile();
+		}
+
+		ConstFloatVectorDataPtr verticalPassData;
+		{
+			const V2i verticalPassOrigin( tileOrigin.x, 0 );
+			ImagePlug::ChannelDataScope channelDataScope( context );
+			channelDataScope.setTileOrigin( &verticalPassOrigin );
+			verticalPassData = verticalPassPlug()->getValue();
+		}
+
+		// Copy out the rows for this tile. Outside the region covered by
+		// the vertical pass, the result has settled to a constant value.
+		const vector<float> &verticalPass = verticalPassData->readable();
+		const int tileSize = ImagePlug::tileSize();
+		const int minY = dataWindow.min.y - RecursiveGaussian( radius.y ).margin;
+		const int height = verticalPass.size() / tileSize;
+
+		FloatVectorDataPtr resultData = new FloatVectorData;
+		vector<float> &result = resultData->writable();
+		result.resize( ImagePlug::tilePixels() );
+		for( int y = 0; y < tileSize; ++y )
+		{
+			const int i = std::clamp( tileOrigin.y + y - minY, 0, height - 1 );
+			std::copy( &verticalPass[i * tileSize], &verticalPass[i * tileSize] + tileSize, &result[y * tileSize] );
+		}
+
+		return resultData;
 	}
 	else
 	{
-		return inPlug()->channelDataPlug()->getValue();
+		return resampledChannelDataPlug()->getValue();
 	}
 }
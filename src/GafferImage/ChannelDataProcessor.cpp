@@ -169,7 +169,7 @@ void ChannelDataProcessor::hashChannelData( const GafferImage::ImagePlug *output
 
 IECore::ConstFloatVectorDataPtr ChannelDataProcessor::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
 {
-	IECore::FloatVectorDataPtr outData = inPlug()->channelData( channelName, tileOrigin )->copy();
+	IECore::ConstFloatVectorDataPtr inData = inPlug()->channelData( channelName, tileOrigin );
 
 	IECore::ConstStringVectorDataPtr channelNamesData;
 	bool unpremult = false;
@@ -200,8 +200,24 @@ IECore::ConstFloatVectorDataPtr ChannelDataProcessor::computeChannelData( const
 		{
 			postAlphaData = alphaData;
 		}
+	}
+
+	// If the input is uniform, then we can process a single value
+	// and output a uniform tile, provided that any alpha we depend
+	// on is also uniform.
+	float uniformValue = 0;
+	bool uniform = processesUniformTiles() && ImagePlug::isUniformTile( inData.get(), uniformValue );
+	if( uniform && alphaData )
+	{
+		float alphaValue;
+		uniform = ImagePlug::isUniformTile( alphaData.get(), alphaValue ) && ImagePlug::isUniformTile( postAlphaData.get(), alphaValue );
+	}
+
+	IECore::FloatVectorDataPtr outData = uniform ? new IECore::FloatVectorData( std::vector<float>( 1, uniformValue ) ) : inData->copy();
 
-		int size = alphaData->readable().size();
+	if( alphaData )
+	{
+		int size = outData->readable().size();
 		const float *A = &alphaData->readable().front();
 		float *O = &outData->writable().front();
 		for( int j = 0; j < size; j++ )
@@ -218,7 +234,7 @@ IECore::ConstFloatVectorDataPtr ChannelDataProcessor::computeChannelData( const
 	processChannelData( context, parent, channelName, outData );
 	if( unpremult && postAlphaData )
 	{
-		int size = postAlphaData->readable().size();
+		int size = outData->readable().size();
 		const float *A = &postAlphaData->readable().front();
 		float *O = &outData->writable().front();
 
@@ -250,5 +266,15 @@ IECore::ConstFloatVectorDataPtr ChannelDataProcessor::computeChannelData( const
 		}
 
 	}
+
+	if( uniform )
+	{
+		return ImagePlug::uniformTile( outData->readable()[0] );
+	}
 	return outData;
 }
+
+bool ChannelDataProcessor::processesUniformTiles() const
+{
+	return false;
+}
@@ -59,6 +59,16 @@ struct ColorProcessorData : public IECore::Data
 
 IE_CORE_DECLAREPTR( ColorProcessorData );
 
+// A node in a chain of ColorProcessors, processed in a single pass
+// by `ColorProcessor::compute()`.
+struct ColorProcessorStage
+{
+	ConstColorProcessorDataPtr colorProcessorData;
+	bool unpremult = false;
+	// Channels which aren't processed are passed through unchanged.
+	bool processed[3] = { true, true, true };
+};
+
 const IECore::InternedString g_layerNameKey( "image:colorProcessor:__layerName" );
 
 } // namespace
@@ -231,86 +241,192 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 	else if( output == colorDataPlug() )
 	{
 		ConstStringVectorDataPtr channelNamesData;
-		ConstColorProcessorDataPtr colorProcessorData;
-		bool unpremult;
 		{
 			ImagePlug::GlobalScope globalScope( context );
 			channelNamesData = inPlug()->channelNamesPlug()->getValue();
-			unpremult = processUnpremultipliedPlug()->getValue();
-			colorProcessorData = boost::static_pointer_cast<const ColorProcessorData>( colorProcessorPlug()->getValue() );
 		}
 		const vector<string> &channelNames = channelNamesData->readable();
 
 		const string &layerName = context->get<string>( g_layerNameKey );
 
-		FloatVectorDataPtr rgb[3];
-		ConstFloatVectorDataPtr alpha;
-		int samples = -1;
+		const string rgbNames[3] = {
+			ImageAlgo::channelName( layerName, "R" ),
+			ImageAlgo::channelName( layerName, "G" ),
+			ImageAlgo::channelName( layerName, "B" )
+		};
+
+		bool rgbExists[3];
+		for( int i = 0; i < 3; ++i )
 		{
-			ImagePlug::ChannelDataScope channelDataScope( context );
+			rgbExists[i] = ImageAlgo::channelExists( channelNames, rgbNames[i] );
+		}
+
+		if( !rgbExists[0] && !rgbExists[1] && !rgbExists[2] )
+		{
+			throw IECore::Exception( "Cannot evaluate color data plug with no source channels" );
+		}
 
-			if( unpremult && ImageAlgo::channelExists( channelNames, ImageAlgo::channelNameA ) )
+		// Gather the chain of directly connected ColorProcessors that ends with
+		// us, so that we can process the whole chain in a single pass rather than
+		// computing and caching intermediate colour data for every node. Each
+		// node still hashes its own output, and the result is identical to that
+		// of processing the nodes one by one.
+		//
+		// The trade-off is that there are no intermediate results for us to reuse
+		// when only the last node of the chain is edited, so every stage is run
+		// again. This is acceptable because the stages are cheap per-pixel
+		// operations, while the expensive parts - computing each node's processor
+		// and the input tiles at the head of the chain - are still cached.
+
+		vector<ColorProcessorStage> stages;
+		bool anyUnpremult = false;
+		const ColorProcessor *head = this;
+		for( const ColorProcessor *node = this; node; )
+		{
+			ColorProcessorStage stage;
+			string channels;
+			bool enabled = true;
 			{
-				channelDataScope.setChannelName( &ImageAlgo::channelNameA );
-				alpha = inPlug()->channelDataPlug()->getValue();
+				ImagePlug::GlobalScope globalScope( context );
+				if( node != this )
+				{
+					enabled = node->enabled();
+				}
+				if( enabled )
+				{
+					stage.colorProcessorData = boost::static_pointer_cast<const ColorProcessorData>( node->colorProcessorPlug()->getValue() );
+					stage.unpremult = node->processUnpremultipliedPlug()->getValue();
+					channels = node->channelsPlug()->getValue();
+				}
 			}
 
-			int i = 0;
-			for( const auto &baseName : { "R", "G", "B" } )
+			if( enabled && stage.colorProcessorData->colorProcessor )
 			{
-				string channelName = ImageAlgo::channelName( layerName, baseName );
-				if( ImageAlgo::channelExists( channelNames, channelName ) )
+				bool processesAny = false;
+				for( int i = 0; i < 3; ++i )
 				{
-					channelDataScope.setChannelName( &channelName );
-					rgb[i] = inPlug()->channelDataPlug()->getValue()->copy();
-
-					samples = rgb[i]->readable().size();
-
-					if( unpremult && alpha )
-					{
-						const float *A = &alpha->readable().front();
-						float *C = &rgb[i]->writable().front();
-						for( int j = 0; j < samples; j++ )
-						{
-							if( *A != 0 )
-							{
-								*C /= *A;
-							}
-							A++;
-							C++;
-						}
-					}
+					// We always process all channels for ourselves, since `computeChannelData()`
+					// applies our own channel mask. But upstream nodes pass through channels
+					// that they don't process, and those that don't exist will be
+					// substituted with black by the next node.
+					stage.processed[i] = node == this || (
+						rgbExists[i] && node->channelEnabled( rgbNames[i] ) &&
+						StringAlgo::matchMultiple( rgbNames[i], channels )
+					);
+					processesAny = processesAny || stage.processed[i];
 				}
-				else
+				if( processesAny )
 				{
-					rgb[i] = nullptr;
+					anyUnpremult = anyUnpremult || stage.unpremult;
+					stages.push_back( stage );
 				}
-				i++;
 			}
 
-			if( samples == -1 )
+			head = node;
+			const Plug *input = node->inPlug()->channelDataPlug()->getInput();
+			const ColorProcessor *upstream = input ? IECore::runTimeCast<const ColorProcessor>( input->node() ) : nullptr;
+			node = upstream && input == upstream->outPlug()->channelDataPlug() ? upstream : nullptr;
+		}
+
+		ConstFloatVectorDataPtr inputs[3];
+		ConstFloatVectorDataPtr alpha;
+		{
+			ImagePlug::ChannelDataScope channelDataScope( context );
+
+			if( anyUnpremult && ImageAlgo::channelExists( channelNames, ImageAlgo::channelNameA ) )
 			{
-				throw IECore::Exception( "Cannot evaluate color data plug with no source channels" );
+				channelDataScope.setChannelName( &ImageAlgo::channelNameA );
+				alpha = head->inPlug()->channelDataPlug()->getValue();
 			}
 
-			for( int k = 0; k < 3; k++ )
+			for( int i = 0; i < 3; ++i )
 			{
-				if( !rgb[k] )
+				if( rgbExists[i] )
 				{
-					rgb[k] = new FloatVectorData();
-					rgb[k]->writable().resize( samples, 0.0f );
+					channelDataScope.setChannelName( &rgbNames[i] );
+					inputs[i] = head->inPlug()->channelDataPlug()->getValue();
 				}
 			}
+		}
+
+		// If all the inputs are uniform, then we only need to process
+		// a single pixel, and can output uniform tiles. Missing channels
+		// are treated as black, so are uniform by definition.
+		bool uniform = true;
+		float uniformValues[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		for( int i = 0; i < 3 && uniform; ++i )
+		{
+			uniform = !inputs[i] || ImagePlug::isUniformTile( inputs[i].get(), uniformValues[i] );
+		}
+		if( uniform && alpha )
+		{
+			uniform = ImagePlug::isUniformTile( alpha.get(), uniformValues[3] );
+		}
+
+		int samples = -1;
+		FloatVectorDataPtr rgb[3];
+		for( int i = 0; i < 3; ++i )
+		{
+			if( uniform )
+			{
+				rgb[i] = new FloatVectorData( std::vector<float>( 1, uniformValues[i] ) );
+			}
+			else if( inputs[i] )
+			{
+				rgb[i] = inputs[i]->copy();
+			}
+			else
+			{
+				continue;
+			}
+			samples = rgb[i]->readable().size();
+		}
 
+		for( int k = 0; k < 3; k++ )
+		{
+			if( !rgb[k] )
+			{
+				rgb[k] = new FloatVectorData();
+				rgb[k]->writable().resize( samples, 0.0f );
+			}
 		}
 
-		colorProcessorData->colorProcessor( rgb[0].get(), rgb[1].get(), rgb[2].get() );
+		// Process the chain, starting with the most upstream node.
 
-		if( unpremult && alpha )
+		for( auto it = stages.rbegin(); it != stages.rend(); ++it )
 		{
-			for( int i = 0; i < 3; i++ )
+			FloatVectorDataPtr passThrough[3];
+			for( int i = 0; i < 3; ++i )
+			{
+				if( !it->processed[i] )
+				{
+					passThrough[i] = rgb[i]->copy();
+				}
+			}
+
+			if( it->unpremult && alpha )
 			{
-				if( unpremult && alpha )
+				for( int i = 0; i < 3; i++ )
+				{
+					const float *A = &alpha->readable().front();
+					float *C = &rgb[i]->writable().front();
+					for( int j = 0; j < samples; j++ )
+					{
+						if( *A != 0 )
+						{
+							*C /= *A;
+						}
+						A++;
+						C++;
+					}
+				}
+			}
+
+			it->colorProcessorData->colorProcessor( rgb[0].get(), rgb[1].get(), rgb[2].get() );
+
+			if( it->unpremult && alpha )
+			{
+				for( int i = 0; i < 3; i++ )
 				{
 					const float *A = &alpha->readable().front();
 					float *C = &rgb[i]->writable().front();
@@ -326,6 +442,25 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 					}
 				}
 			}
+
+			for( int i = 0; i < 3; ++i )
+			{
+				if( passThrough[i] )
+				{
+					rgb[i] = passThrough[i];
+				}
+			}
+		}
+
+		if( uniform )
+		{
+			ObjectVectorPtr result = new ObjectVector();
+			for( int i = 0; i < 3; ++i )
+			{
+				result->members().push_back( boost::const_pointer_cast<FloatVectorData>( ImagePlug::uniformTile( rgb[i]->readable()[0] ) ) );
+			}
+			static_cast<ObjectPlug *>( output )->setValue( result );
+			return;
 		}
 
 		ObjectVectorPtr result = new ObjectVector();
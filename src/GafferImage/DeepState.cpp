@@ -40,6 +40,10 @@
 #include "GafferImage/ImageAlgo.h"
 #include "GafferImage/DeepState.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
 using namespace std;
 using namespace Imath;
 using namespace IECore;
@@ -698,58 +702,99 @@ IECore::ConstFloatVectorDataPtr sumByWeights( const std::vector<float> &input,
 	return resultData;
 }
 
+// Returns an unsigned integer whose ordering matches the ordering of `f`. Negative
+// zero is treated as equal to positive zero, as it is by float comparison.
+inline uint32_t sortableBits( float f )
+{
+	f += 0.0f;
+	uint32_t i;
+	std::memcpy( &i, &f, sizeof( i ) );
+	return ( i & 0x80000000 ) ? ~i : ( i | 0x80000000 );
+}
+
+// The sort key for a single sample. We gather the keys for each pixel into a
+// contiguous buffer before sorting, so that comparisons don't need to index
+// into the Z and ZBack channels at scattered locations. Comparing the packed
+// key orders by Z, and then by ZBack, and ties are broken by the original index
+// so that equal samples preserve their initial order.
+struct SampleSortKey
+{
+	uint64_t depth;
+	int index;
+
+	bool operator<( const SampleSortKey &other ) const
+	{
+		return depth < other.depth || ( depth == other.depth && index < other.index );
+	}
+};
+
+// Below this many samples, an insertion sort beats `std::sort()`. This is also
+// the common case for volumes that have been split into many pixels.
+constexpr int g_insertionSortThreshold = 24;
+
 // Given the Z and ZBack channels, and corresponding sampleOffsets, return an IntVectorData
 // a list of sample indices that would produce sorted samples.
 IECore::IntVectorDataPtr computeSampleSorting(
 	const vector<int> &sampleOffsets, const vector<float> &z, const vector<float> &zBack
 )
 {
-	// We compare based on the Z channel - if it is equal, compare based on ZBack
-	struct CompareDepth
-	{
-		const vector<float> &m_zSamples;
-		const vector<float> &m_zBackSamples;
+	IntVectorDataPtr resultData = new IntVectorData();
+	std::vector<int> &result = resultData->writable();
+	result.resize( sampleOffsets.back() );
 
-		CompareDepth( const vector<float> &zSamples, const vector<float> &zBackSamples )
-			: m_zSamples( zSamples ), m_zBackSamples( zBackSamples )
-		{}
+	std::vector<SampleSortKey> keys;
 
-		bool operator()( int a, int b ) const
+	int prevOffset = 0;
+	for( int offset : sampleOffsets )
+	{
+		const int numSamples = offset - prevOffset;
+		if( numSamples <= 1 )
 		{
-			if( m_zSamples[a] != m_zSamples[b] )
+			if( numSamples )
 			{
-				return m_zSamples[a] < m_zSamples[b];
+				result[prevOffset] = prevOffset;
 			}
-			else if( m_zBackSamples[a] != m_zBackSamples[b] )
+			prevOffset = offset;
+			continue;
+		}
+
+		keys.resize( numSamples );
+		bool sorted = true;
+		for( int i = 0; i < numSamples; ++i )
+		{
+			const int sample = prevOffset + i;
+			keys[i].depth = ( uint64_t( sortableBits( z[sample] ) ) << 32 ) | sortableBits( zBack[sample] );
+			keys[i].index = sample;
+			sorted = sorted && ( i == 0 || keys[i-1].depth <= keys[i].depth );
+		}
+
+		if( !sorted )
+		{
+			if( numSamples <= g_insertionSortThreshold )
 			{
-				return m_zBackSamples[a] < m_zBackSamples[b];
+				for( int i = 1; i < numSamples; ++i )
+				{
+					const SampleSortKey key = keys[i];
+					int j = i;
+					for( ; j > 0 && key < keys[j-1]; --j )
+					{
+						keys[j] = keys[j-1];
+					}
+					keys[j] = key;
+				}
 			}
 			else
 			{
-				// If everything is equal, preserve initial order
-				return a < b;
+				std::sort( keys.begin(), keys.end() );
 			}
 		}
-	};
 
-	IntVectorDataPtr resultData = new IntVectorData();
-	std::vector<int> &result = resultData->writable();
-	result.resize( sampleOffsets.back() );
-	for( unsigned int i = 0; i < result.size(); i++ )
-	{
-		result[i] = i;
-	}
-
-	CompareDepth compare( z, zBack );
-
-	int prevOffset = 0;
-	for( int offset : sampleOffsets )
-	{
-		if( offset > prevOffset )
+		for( int i = 0; i < numSamples; ++i )
 		{
-			std::sort( &result[prevOffset], &result[offset], compare );
-			prevOffset = offset;
+			result[prevOffset + i] = keys[i].index;
 		}
+
+		prevOffset = offset;
 	}
 
 	return resultData;
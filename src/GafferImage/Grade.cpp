@@ -282,6 +282,11 @@ void Grade::processChannelData( const Gaffer::Context *context, const ImagePlug
 	}
 }
 
+bool Grade::processesUniformTiles() const
+{
+	return true;
+}
+
 void Grade::parameters( size_t channelIndex, float &a, float &b, float &gamma ) const
 {
 	gamma = gammaPlug()->getChild( channelIndex )->getValue();
@@ -285,6 +285,20 @@ void ImageNode::compute( ValuePlug *output, const Context *context ) const
 	}
 }
 
+const Gaffer::ValuePlug::CacheCodec *ImageNode::computeCacheCodec( const Gaffer::ValuePlug *output ) const
+{
+	if( output == outPlug()->channelDataPlug() )
+	{
+		return ImagePlug::channelDataCacheCodec();
+	}
+	return ComputeNode::computeCacheCodec( output );
+}
+
+bool ImageNode::computeCacheShareable( const Gaffer::ValuePlug *output ) const
+{
+	return output == outPlug()->channelDataPlug() || ComputeNode::computeCacheShareable( output );
+}
+
 IECore::ConstStringVectorDataPtr ImageNode::computeViewNames( const Gaffer::Context *context, const ImagePlug *parent ) const
 {
 	throw IECore::NotImplementedException( string( typeName() ) + "::computeViewNames" );
@@ -46,6 +46,15 @@
 #include "Gaffer/Context.h"
 #include "Gaffer/ContextAlgo.h"
 
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
+#include "IECore/VectorTypedData.h"
+
+#include <zlib.h>
+
+#include <atomic>
+#include <cmath>
+
 using namespace std;
 using namespace tbb;
 using namespace Imath;
@@ -200,6 +209,83 @@ const IECore::FloatVectorData *ImagePlug::blackTile()
 	return g_blackTile.get();
 };
 
+namespace
+{
+
+uint32_t uniformTileKey( float value )
+{
+	uint32_t key;
+	memcpy( &key, &value, sizeof( key ) );
+	return key;
+}
+
+// Uniform tiles are stored against the bit pattern of their value, so
+// that `isUniformTile()` can find the only candidate from the first pixel
+// of the tile, and then verify it by pointer comparison. The tiles are
+// shared by every node that outputs the same value, so we only need a
+// modest number of them, and evicted tiles remain valid - they just stop
+// being recognised as uniform.
+using UniformTileCache = IECorePreview::LRUCache<uint32_t, ConstFloatVectorDataPtr>;
+
+UniformTileCache &uniformTileCache()
+{
+	static UniformTileCache g_cache(
+		[] ( uint32_t key, size_t &cost, const IECore::Canceller *canceller ) {
+			cost = 1;
+			float value;
+			memcpy( &value, &key, sizeof( value ) );
+			return ConstFloatVectorDataPtr( new FloatVectorData( std::vector<float>( ImagePlug::tilePixels(), value ) ) );
+		},
+		256
+	);
+	return g_cache;
+}
+
+} // namespace
+
+IECore::ConstFloatVectorDataPtr ImagePlug::uniformTile( float value )
+{
+	const uint32_t key = uniformTileKey( value );
+	if( key == uniformTileKey( 0.0f ) )
+	{
+		return blackTile();
+	}
+	else if( key == uniformTileKey( 1.0f ) )
+	{
+		return whiteTile();
+	}
+	return uniformTileCache().get( key );
+}
+
+bool ImagePlug::isUniformTile( const IECore::FloatVectorData *tile, float &value )
+{
+	if( tile == blackTile() )
+	{
+		value = 0.0f;
+		return true;
+	}
+	else if( tile == whiteTile() )
+	{
+		value = 1.0f;
+		return true;
+	}
+
+	const std::vector<float> &data = tile->readable();
+	if( (int)data.size() != tilePixels() )
+	{
+		return false;
+	}
+
+	const std::optional<ConstFloatVectorDataPtr> cached = uniformTileCache().getIfCached( uniformTileKey( data[0] ) );
+	if( !cached || cached->get() != tile )
+	{
+		return false;
+	}
+
+	value = data[0];
+	return true;
+}
+
 bool ImagePlug::acceptsChild( const GraphComponent *potentialChild ) const
 {
 	if( !ValuePlug::acceptsChild( potentialChild ) )
@@ -544,3 +630,218 @@ IECore::MurmurHash ImagePlug::sampleOffsetsHash( const Imath::V2i &tile, const s
 
 	return sampleOffsetsPlug()->hash();
 }
+
+//////////////////////////////////////////////////////////////////////////
+// Cache compression
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+std::atomic<ImagePlug::CacheCompression> g_cacheCompression( ImagePlug::CacheCompression::None );
+
+const FloatVectorData *compressibleTile( const Object *value )
+{
+	if( value->typeId() != FloatVectorDataTypeId )
+	{
+		return nullptr;
+	}
+
+	// The shared constant and uniform tiles are referenced by many cache
+	// entries, so cost nothing to store, and downstream nodes identify
+	// them by pointer comparison.
+	const FloatVectorData *tile = static_cast<const FloatVectorData *>( value );
+	float uniformValue;
+	if( tile == ImagePlug::emptyTile() || ImagePlug::isUniformTile( tile, uniformValue ) )
+	{
+		return nullptr;
+	}
+
+	return tile;
+}
+
+// Shuffles the bytes of each float into separate planes, so that the
+// slowly varying sign and exponent bytes are adjacent to one another,
+// and then deflates the result at the fastest compression level.
+// Tiles are stored as a UCharVectorData, prefixed with the number of
+// floats.
+ConstObjectPtr compressTile( const FloatVectorData *tile )
+{
+	const std::vector<float> &data = tile->readable();
+	const size_t size = data.size();
+	const size_t numBytes = size * sizeof( float );
+
+	// Scratch space is reused between calls, to avoid a 64KB allocation
+	// for every tile.
+	thread_local std::vector<unsigned char> shuffled;
+	shuffled.resize( numBytes );
+	const unsigned char *bytes = reinterpret_cast<const unsigned char *>( data.data() );
+	for( size_t i = 0; i < size; ++i )
+	{
+		for( size_t b = 0; b < sizeof( float ); ++b )
+		{
+			shuffled[b * size + i] = bytes[i * sizeof( float ) + b];
+		}
+	}
+
+	thread_local std::vector<unsigned char> compressed;
+	compressed.resize( compressBound( numBytes ) );
+	uLongf compressedSize = compressed.size();
+	if(
+		compress2( compressed.data(), &compressedSize, shuffled.data(), numBytes, Z_BEST_SPEED ) != Z_OK ||
+		compressedSize + sizeof( uint32_t ) >= numBytes
+	)
+	{
+		// Not worth compressing.
+		return nullptr;
+	}
+
+	UCharVectorDataPtr result = new UCharVectorData;
+	std::vector<unsigned char> &resultData = result->writable();
+	resultData.resize( sizeof( uint32_t ) + compressedSize );
+	const uint32_t size32 = size;
+	memcpy( resultData.data(), &size32, sizeof( uint32_t ) );
+	memcpy( resultData.data() + sizeof( uint32_t ), compressed.data(), compressedSize );
+
+	return result;
+}
+
+ConstObjectPtr decompressTile( const UCharVectorData *compressedTile )
+{
+	const std::vector<unsigned char> &compressed = compressedTile->readable();
+	uint32_t size;
+	memcpy( &size, compressed.data(), sizeof( uint32_t ) );
+
+	thread_local std::vector<unsigned char> shuffled;
+	shuffled.resize( size * sizeof( float ) );
+	uLongf shuffledSize = shuffled.size();
+	if(
+		uncompress( shuffled.data(), &shuffledSize, compressed.data() + sizeof( uint32_t ), compressed.size() - sizeof( uint32_t ) ) != Z_OK ||
+		shuffledSize != shuffled.size()
+	)
+	{
+		throw IECore::Exception( "Failed to decompress cached tile" );
+	}
+
+	FloatVectorDataPtr result = new FloatVectorData;
+	std::vector<float> &data = result->writable();
+	data.resize( size );
+	unsigned char *bytes = reinterpret_cast<unsigned char *>( data.data() );
+	for( size_t i = 0; i < size; ++i )
+	{
+		for( size_t b = 0; b < sizeof( float ); ++b )
+		{
+			bytes[i * sizeof( float ) + b] = shuffled[b * size + i];
+		}
+	}
+
+	return result;
+}
+
+ConstObjectPtr halfTile( const FloatVectorData *tile )
+{
+	const std::vector<float> &data = tile->readable();
+
+	HalfVectorDataPtr result = new HalfVectorData;
+	std::vector<half> &halfData = result->writable();
+	halfData.resize( data.size() );
+	for( size_t i = 0, e = data.size(); i < e; ++i )
+	{
+		const float f = data[i];
+		if( std::isfinite( f ) && std::abs( f ) > HALF_MAX )
+		{
+			// Can't be represented, so fall back to lossless compression.
+			return compressTile( tile );
+		}
+		halfData[i] = half( f );
+	}
+
+	return result;
+}
+
+ConstObjectPtr decodeTile( const Object *encodedTile )
+{
+	if( auto halfData = runTimeCast<const HalfVectorData>( encodedTile ) )
+	{
+		const std::vector<half> &h = halfData->readable();
+		FloatVectorDataPtr result = new FloatVectorData;
+		result->writable().assign( h.begin(), h.end() );
+		return result;
+	}
+
+	return decompressTile( static_cast<const UCharVectorData *>( encodedTile ) );
+}
+
+class LosslessCodec : public ValuePlug::CacheCodec
+{
+
+	public :
+
+		ConstObjectPtr encode( const Object *value ) const override
+		{
+			const FloatVectorData *tile = compressibleTile( value );
+			return tile ? compressTile( tile ) : nullptr;
+		}
+
+		ConstObjectPtr decode( const Object *encodedValue ) const override
+		{
+			return decodeTile( encodedValue );
+		}
+
+};
+
+class HalfCodec : public ValuePlug::CacheCodec
+{
+
+	public :
+
+		ConstObjectPtr encode( const Object *value ) const override
+		{
+			const FloatVectorData *tile = compressibleTile( value );
+			return tile ? halfTile( tile ) : nullptr;
+		}
+
+		ConstObjectPtr decode( const Object *encodedValue ) const override
+		{
+			return decodeTile( encodedValue );
+		}
+
+};
+
+} // namespace
+
+void ImagePlug::setCacheCompression( CacheCompression compression )
+{
+	if( g_cacheCompression.exchange( compression ) != compression )
+	{
+		// Cache entries are keyed only by hash, so we must remove tiles
+		// encoded using the previous mode. Otherwise switching from `Half`
+		// to `Lossless` or `None` would continue to return lossy tiles.
+		ValuePlug::clearCache();
+	}
+}
+
+ImagePlug::CacheCompression ImagePlug::getCacheCompression()
+{
+	return g_cacheCompression;
+}
+
+const Gaffer::ValuePlug::CacheCodec *ImagePlug::channelDataCacheCodec()
+{
+	static ValuePlug::ConstCacheCodecPtr g_losslessCodec = new LosslessCodec;
+	static ValuePlug::ConstCacheCodecPtr g_halfCodec = new HalfCodec;
+
+	switch( g_cacheCompression.load( std::memory_order_relaxed ) )
+	{
+		case CacheCompression::None :
+			return nullptr;
+		case CacheCompression::Lossless :
+			return g_losslessCodec.get();
+		case CacheCompression::Half : {
+			const std::string *channelName = Context::current()->getIfExists<std::string>( channelNameContextName );
+			return channelName && ImageAlgo::colorIndex( *channelName ) != -1 ? g_halfCodec.get() : g_losslessCodec.get();
+		}
+	}
+
+	return nullptr;
+}
@@ -52,6 +52,7 @@
 #include "Gaffer/Metadata.h"
 #include "Gaffer/ScriptNode.h"
 #include "Gaffer/StringPlug.h"
+#include "Gaffer/ThreadState.h"
 #include "Gaffer/Version.h"
 
 #include "IECoreImage/OpenImageIOAlgo.h"
@@ -66,13 +67,22 @@
 
 #include "boost/algorithm/string.hpp"
 #include "boost/functional/hash.hpp"
+#include "boost/noncopyable.hpp"
 
+#include "tbb/global_control.h"
 #include "tbb/spin_mutex.h"
+#include "tbb/task_arena.h"
 
 #include "fmt/format.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <filesystem>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
 
 #ifndef _MSC_VER
 #include <sys/utsname.h>
@@ -138,6 +148,40 @@ void copyBufferArea( const float *inData, const Imath::Box2i &inArea, float *out
 	}
 }
 
+// Equivalent to `copyBufferArea()`, but taking advantage of tiles created by
+// `ImagePlug::uniformTile()`. Assumes that the output buffer has been cleared
+// to black, as is the case for both the tile and scanline writers.
+void copyTileArea( const FloatVectorData *tile, const Imath::Box2i &inArea, float *outData, const Imath::Box2i &outArea, const size_t outOffset, const size_t outInc, const bool outYDown, Imath::Box2i copyArea )
+{
+	float uniformValue;
+	if( !ImagePlug::isUniformTile( tile, uniformValue ) )
+	{
+		copyBufferArea( &tile->readable()[0], inArea, outData, outArea, outOffset, outInc, outYDown, copyArea );
+		return;
+	}
+
+	if( tile == ImagePlug::blackTile() )
+	{
+		// Output is already black.
+		return;
+	}
+
+	if( BufferAlgo::empty( copyArea ) )
+	{
+		copyArea = BufferAlgo::intersection( inArea, outArea );
+	}
+
+	for( int y = copyArea.min.y; y < copyArea.max.y; ++y )
+	{
+		size_t yOffsetOut = outYDown ? outArea.max.y - y - 1 : y - outArea.min.y;
+		float *outPtr = outData + ( ( ( yOffsetOut * outArea.size().x ) + ( copyArea.min.x - outArea.min.x ) ) * outInc ) + outOffset;
+		for( int x = copyArea.min.x; x < copyArea.max.x; x++, outPtr += outInc )
+		{
+			*outPtr = uniformValue;
+		}
+	}
+}
+
 void copyDeepArea(
 	const int *offsetData, const float *tileData, const int inOffsetPos, const Imath::V2i &size,
 	DeepData &outData, const int outStartIndex, const int outStride, const int channel
@@ -238,6 +282,135 @@ class SampleOffsetsAccumulator
 		Result m_sampleOffsets;
 };
 
+// OpenImageIO compresses EXR chunks using OpenEXR's global thread pool, which
+// is typically disabled via the `exr_threads` attribute because our ExrCore-based
+// reads don't need it. Without it, compression on a single thread becomes
+// the bottleneck when writing, so while writing we size the pool to match the
+// concurrency available to us. Note that OpenImageIO applies the attribute when
+// the output is opened. The attribute is global, so concurrent writes share a
+// single override, and the original value is restored when the last one completes.
+class EXRThreadsScope : boost::noncopyable
+{
+
+	public :
+
+		EXRThreadsScope()
+		{
+			std::lock_guard<std::mutex> lock( g_mutex );
+			if( g_count++ == 0 )
+			{
+				OIIO::getattribute( "exr_threads", g_previousThreads );
+				const int threads = std::min<int>(
+					tbb::this_task_arena::max_concurrency(),
+					tbb::global_control::active_value( tbb::global_control::max_allowed_parallelism )
+				);
+				OIIO::attribute( "exr_threads", threads );
+			}
+		}
+
+		~EXRThreadsScope()
+		{
+			std::lock_guard<std::mutex> lock( g_mutex );
+			if( --g_count == 0 )
+			{
+				OIIO::attribute( "exr_threads", g_previousThreads );
+			}
+		}
+
+	private :
+
+		static std::mutex g_mutex;
+		static int g_count;
+		static int g_previousThreads;
+
+};
+
+std::mutex EXRThreadsScope::g_mutex;
+int EXRThreadsScope::g_count = 0;
+int EXRThreadsScope::g_previousThreads = 0;
+
+size_t defaultMemoryLimit()
+{
+	if( const char *e = getenv( "GAFFERIMAGE_IMAGEWRITER_MEMORY_LIMIT" ) )
+	{
+		// Megabytes
+		return std::strtoull( e, nullptr, 10 ) * 1024 * 1024;
+	}
+	return size_t( 2048 ) * 1024 * 1024;
+}
+
+// The limit specified by `ImageWriter::setMemoryLimit()`.
+std::atomic_size_t g_memoryLimit( defaultMemoryLimit() );
+
+// Equivalent to calling `parallelGatherTiles()` with `TopToBottom` order, but
+// limiting the number of tiles in flight so that their total size stays within
+// `g_memoryLimit`. The pipeline in `parallelGatherTiles()` holds one tile in
+// flight for each thread in the current arena, so we apply back-pressure by
+// gathering bands of tile rows in arenas of reduced concurrency. `tileBytes`
+// estimates the size of all channels of the tile at a particular origin, and
+// `rowBufferBytes` estimates the memory held by the writer itself while
+// assembling the row of tiles at a particular y origin. The latter is deducted
+// from the budget before deciding how many tiles may be in flight.
+template<typename GatherFunctor, typename TileBytesFunctor, typename RowBufferBytesFunctor>
+void gatherTilesWithinMemoryLimit(
+	const ImagePlug *image, const std::vector<std::string> &channels, const TileChannelDataProcessor &processor,
+	GatherFunctor &gatherFunctor, const Box2i &processWindow, TileBytesFunctor &&tileBytes, RowBufferBytesFunctor &&rowBufferBytes
+)
+{
+	const size_t limit = g_memoryLimit;
+	const int maxConcurrency = tbb::this_task_arena::max_concurrency();
+	if( !limit || BufferAlgo::empty( processWindow ) )
+	{
+		ImageAlgo::parallelGatherTiles( image, channels, processor, gatherFunctor, processWindow, ImageAlgo::TopToBottom );
+		return;
+	}
+
+	const ThreadState &threadState = ThreadState::current();
+	auto gatherBand = [&] ( int concurrency, int yBegin, int yEnd ) {
+
+		const Box2i band( V2i( processWindow.min.x, yBegin ), V2i( processWindow.max.x, yEnd ) );
+		if( concurrency >= maxConcurrency )
+		{
+			ImageAlgo::parallelGatherTiles( image, channels, processor, gatherFunctor, band, ImageAlgo::TopToBottom );
+			return;
+		}
+
+		tbb::task_arena arena( concurrency );
+		arena.execute(
+			[&] {
+				ThreadState::Scope threadStateScope( threadState );
+				ImageAlgo::parallelGatherTiles( image, channels, processor, gatherFunctor, band, ImageAlgo::TopToBottom );
+			}
+		);
+	};
+
+	const V2i minTileOrigin = ImagePlug::tileOrigin( processWindow.min );
+	const V2i maxTileOrigin = ImagePlug::tileOrigin( processWindow.max - V2i( 1 ) );
+
+	int bandConcurrency = 0;
+	int bandEnd = processWindow.max.y;
+	for( int y = maxTileOrigin.y; y >= minTileOrigin.y; y -= ImagePlug::tileSize() )
+	{
+		size_t rowTileBytes = 1;
+		for( int x = minTileOrigin.x; x <= maxTileOrigin.x; x += ImagePlug::tileSize() )
+		{
+			rowTileBytes = std::max( rowTileBytes, tileBytes( V2i( x, y ) ) );
+		}
+
+		const size_t bufferBytes = rowBufferBytes( y );
+		const size_t tileBudget = limit > bufferBytes ? limit - bufferBytes : 0;
+		const int concurrency = std::clamp<size_t>( tileBudget / rowTileBytes, 1, maxConcurrency );
+		if( bandConcurrency && concurrency != bandConcurrency )
+		{
+			gatherBand( bandConcurrency, y + ImagePlug::tileSize(), bandEnd );
+			bandEnd = y + ImagePlug::tileSize();
+		}
+		bandConcurrency = concurrency;
+	}
+
+	gatherBand( bandConcurrency, processWindow.min.y, bandEnd );
+}
+
 class FlatTileWriter
 {
 	// This class is created to be used by parallelGatherTiles, and called
@@ -359,7 +532,7 @@ class FlatTileWriter
 
 					Imath::Box2i copyArea( BufferAlgo::intersection( m_processWindow, BufferAlgo::intersection( inTileBounds, outTileBnds ) ) );
 
-					copyBufferArea( &data->readable()[0], inTileBounds, &tile[0], outTileBnds, channelIndex, m_channels.size(), true, copyArea );
+					copyTileArea( data.get(), inTileBounds, &tile[0], outTileBnds, channelIndex, m_channels.size(), true, copyArea );
 				}
 			}
 
@@ -484,6 +657,97 @@ class FlatTileWriter
 		ConstFloatVectorDataPtr m_blackTile;
 };
 
+// Runs writes on a single long-lived thread, so that compression and I/O for
+// one chunk can overlap with the gathering of the next. We use a dedicated thread
+// rather than a TBB task because the writes block on I/O, and must not be
+// stolen by threads waiting in the gather pipeline. Only one write may be
+// pending at a time.
+class BackgroundWriter : boost::noncopyable
+{
+
+	public :
+
+		BackgroundWriter()
+			:	m_stop( false ), m_thread( [this] { run(); } )
+		{
+		}
+
+		~BackgroundWriter()
+		{
+			{
+				std::lock_guard<std::mutex> lock( m_mutex );
+				m_stop = true;
+			}
+			m_condition.notify_all();
+			m_thread.join();
+		}
+
+		// Waits for any previous write to complete, and then
+		// schedules `function` to be run on the background thread.
+		void write( std::function<void ()> &&function )
+		{
+			wait();
+			{
+				std::lock_guard<std::mutex> lock( m_mutex );
+				m_write = std::move( function );
+			}
+			m_condition.notify_all();
+		}
+
+		// Waits for any pending write to complete, rethrowing any
+		// exception from it.
+		void wait()
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			m_condition.wait( lock, [this] { return !m_write; } );
+			if( m_exception )
+			{
+				std::exception_ptr e;
+				std::swap( e, m_exception );
+				std::rethrow_exception( e );
+			}
+		}
+
+	private :
+
+		void run()
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			while( true )
+			{
+				m_condition.wait( lock, [this] { return m_write || m_stop; } );
+				if( !m_write )
+				{
+					return;
+				}
+
+				lock.unlock();
+				try
+				{
+					m_write();
+				}
+				catch( ... )
+				{
+					m_exception = std::current_exception();
+				}
+				lock.lock();
+
+				m_write = nullptr;
+				m_condition.notify_all();
+			}
+		}
+
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::function<void ()> m_write;
+		std::exception_ptr m_exception;
+		bool m_stop;
+		// Declared last, so that it is started after the
+		// members above have been initialised.
+		std::thread m_thread;
+
+};
+
 class FlatScanlineWriter
 {
 	// This class is created to be used by parallelGatherTiles and called in
@@ -496,8 +760,9 @@ class FlatScanlineWriter
 	// It stores a vector of floats big enough to hold ImagePlug::tileSize()
 	// scanlines. As it receives each tile, it copies the data into the
 	// appropriate location in the buffer. When it's copied the last channel
-	// of the last tile of each row, it writes all of the data from the buffer
-	// into the ImageOutput object.
+	// of the last tile of each row, it hands the buffer to a separate thread
+	// to be compressed and written to the ImageOutput object, and continues
+	// with the next row in a second buffer.
 	public:
 		FlatScanlineWriter(
 				ImageOutputPtr out,
@@ -515,12 +780,15 @@ class FlatScanlineWriter
 				m_tilesBounds( Imath::Box2i( ImagePlug::tileOrigin( processWindow.min ), ImagePlug::tileOrigin( processWindow.max - Imath::V2i( 1 ) ) + Imath::V2i( ImagePlug::tileSize() ) ) )
 		{
 			m_scanlinesData.resize( m_spec.width * ImagePlug::tileSize() * m_channels.size(), 0.0 );
+			m_writeData.resize( m_scanlinesData.size() );
 
 			writeInitialBlankScanlines();
 		}
 
 		void finish()
 		{
+			m_backgroundWriter.wait();
+
 			if( BufferAlgo::empty( m_processWindow ) )
 			{
 				// If the source data window is empty, we handle everything during construct
@@ -551,14 +819,20 @@ class FlatScanlineWriter
 
 			Imath::Box2i copyArea( BufferAlgo::intersection( m_processWindow, BufferAlgo::intersection( inTileBounds, scanlinesBounds ) ) );
 
-			copyBufferArea( &data->readable()[0], inTileBounds, &m_scanlinesData[0], scanlinesBounds, channelIndex, m_channels.size(), true, copyArea );
+			copyTileArea( data.get(), inTileBounds, &m_scanlinesData[0], scanlinesBounds, channelIndex, m_channels.size(), true, copyArea );
 
 			if( lastTileOfRow( channelIndex, tileOrigin ) )
 			{
-				writeScanlines(
-					std::max( exrInTileBounds.min.y, m_spec.y ),
-					std::min( exrInTileBounds.max.y + 1, m_spec.y + m_spec.height ),
-					std::max( m_spec.y - exrInTileBounds.min.y, 0 )
+				const int exrYBegin = std::max( exrInTileBounds.min.y, m_spec.y );
+				const int exrYEnd = std::min( exrInTileBounds.max.y + 1, m_spec.y + m_spec.height );
+				const int scanlinesYOffset = std::max( m_spec.y - exrInTileBounds.min.y, 0 );
+
+				m_backgroundWriter.wait();
+				std::swap( m_scanlinesData, m_writeData );
+				m_backgroundWriter.write(
+					[this, exrYBegin, exrYEnd, scanlinesYOffset] {
+						writeScanlines( m_writeData, exrYBegin, exrYEnd, scanlinesYOffset );
+					}
 				);
 			}
 		}
@@ -575,9 +849,9 @@ class FlatScanlineWriter
 			return channelIndex == ( m_channels.size() - 1 ) && tileOrigin.x == ( m_tilesBounds.max.x - ImagePlug::tileSize() ) ;
 		}
 
-		void writeScanlines( const int exrYBegin, const int exrYEnd, const int scanlinesYOffset = 0 ) const
+		void writeScanlines( const vector<float> &scanlinesData, const int exrYBegin, const int exrYEnd, const int scanlinesYOffset = 0 ) const
 		{
-			if ( !m_out->write_scanlines( exrYBegin, exrYEnd, 0, TypeDesc::FLOAT, &m_scanlinesData[0] + ( scanlinesYOffset * m_spec.width * m_channels.size() ) ) )
+			if ( !m_out->write_scanlines( exrYBegin, exrYEnd, 0, TypeDesc::FLOAT, &scanlinesData[0] + ( scanlinesYOffset * m_spec.width * m_channels.size() ) ) )
 			{
 				throw IECore::Exception( fmt::format( "Could not write scanline to \"{}\", error = {}", m_fileName, m_out->geterror() ) );
 			}
@@ -590,7 +864,7 @@ class FlatScanlineWriter
 			while( yBegin < yEnd )
 			{
 				const int numLines = std::min( yEnd - yBegin, ImagePlug::tileSize() );
-				writeScanlines( yBegin, yBegin + numLines );
+				writeScanlines( m_scanlinesData, yBegin, yBegin + numLines );
 				yBegin += numLines;
 			}
 		}
@@ -620,6 +894,10 @@ class FlatScanlineWriter
 		const Imath::Box2i &m_processWindow;
 		const Imath::Box2i m_tilesBounds;
 		vector<float> m_scanlinesData;
+		vector<float> m_writeData;
+		// Declared last, so that it is destroyed first, waiting
+		// for any write that uses the members above.
+		BackgroundWriter m_backgroundWriter;
 };
 
 class DeepTileWriter
@@ -895,8 +1173,9 @@ class DeepScanlineWriter
 	// It stores an OpenImageIO::DeepData big enough to hold ImagePlug::tileSize()
 	// scanlines. As it receives each tile, it copies the data into the
 	// appropriate location in the buffer. When it's copied the last channel
-	// of the last tile of each row, it writes all of the data from the buffer
-	// into the ImageOutput object.
+	// of the last tile of each row, it writes the buffer to the ImageOutput
+	// object. Unlike FlatScanlineWriter, we don't double-buffer, because deep
+	// chunks can be very large.
 
 	public:
 		DeepScanlineWriter(
@@ -913,7 +1192,8 @@ class DeepScanlineWriter
 				m_channels( channels ),
 				m_spec( m_out->spec() ),
 				m_processWindow( processWindow ),
-				m_sampleOffsets( sampleOffsets )
+				m_sampleOffsets( sampleOffsets ),
+				m_deepData( new DeepData )
 		{
 			if( BufferAlgo::empty( m_processWindow ) )
 			{
@@ -952,7 +1232,7 @@ class DeepScanlineWriter
 			// Copy into the chunk the region of this tile that overlaps the process window ( which for
 			// deep is always the data window )
 			copyDeepArea(
-				&sampleOffsets[0], &data->readable()[0], inOffsetPos, copyArea.size(), m_deepData,
+				&sampleOffsets[0], &data->readable()[0], inOffsetPos, copyArea.size(), *m_deepData,
 				copyArea.min.x - m_processWindow.min.x, m_spec.width, channelIndex
 			);
 
@@ -986,7 +1266,7 @@ class DeepScanlineWriter
 			if (int(m_spec.channelformats.size()) == m_spec.nchannels)
 			{
 				// Init with format specified per channel
-				m_deepData.init(
+				m_deepData->init(
 					m_spec.width * nextScanlines, m_channels.size(),
 					m_spec.channelformats, m_channels
 				);
@@ -994,7 +1274,7 @@ class DeepScanlineWriter
 			else
 			{
 				// Init with global format
-				m_deepData.init(
+				m_deepData->init(
 					m_spec.width * nextScanlines, m_channels.size(),
 					m_spec.format, m_channels
 				);
@@ -1029,7 +1309,7 @@ class DeepScanlineWriter
 					for( int j = 0; j < subScanlineLength; j++ )
 					{
 						int offset = offsets[ pixelIndex + j ];
-						m_deepData.set_samples( i, offset - prevOffset);
+						m_deepData->set_samples( i, offset - prevOffset);
 						prevOffset = offset;
 						i++;
 					}
@@ -1040,8 +1320,8 @@ class DeepScanlineWriter
 
 		void writeDeepScanlines()
 		{
-			auto range = scanlineRange();
-			if ( !m_out->write_deep_scanlines( range.first, range.second, 0, m_deepData ) )
+			const auto range = scanlineRange();
+			if ( !m_out->write_deep_scanlines( range.first, range.second, 0, *m_deepData ) )
 			{
 				throw IECore::Exception( fmt::format( "Could not write scanline to \"{}\", error = {}", m_fileName, m_out->geterror() ) );
 			}
@@ -1059,7 +1339,7 @@ class DeepScanlineWriter
 		const Imath::Box2i m_processWindow;
 		const SampleOffsetsAccumulator::Result &m_sampleOffsets;
 		int m_chunkY;
-		DeepData m_deepData;
+		std::unique_ptr<DeepData> m_deepData;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -1811,6 +2091,16 @@ ImageWriter::DefaultColorSpaceFunction ImageWriter::getDefaultColorSpaceFunction
 	return defaultColorSpaceFunction();
 }
 
+void ImageWriter::setMemoryLimit( size_t bytes )
+{
+	g_memoryLimit = bytes;
+}
+
+size_t ImageWriter::getMemoryLimit()
+{
+	return g_memoryLimit;
+}
+
 ImageWriter::DefaultColorSpaceFunction &ImageWriter::defaultColorSpaceFunction()
 {
 	// We deliberately make no attempt to free this, because typically a python
@@ -1882,6 +2172,10 @@ void ImageWriter::execute() const
 
 	const std::string fileName = fileNamePlug()->getValue();
 
+	// Declared before `out`, so that it remains in effect until the
+	// file has been closed.
+	std::optional<EXRThreadsScope> exrThreadsScope;
+
 	ImageOutputPtr out( ImageOutput::create( fileName.c_str() ) );
 	if( !out )
 	{
@@ -2143,6 +2437,11 @@ void ImageWriter::execute() const
 
 	}
 
+	if( out->format_name() == std::string( "openexr" ) )
+	{
+		exrThreadsScope.emplace();
+	}
+
 	bool success;
 	if( parts.size() > 1 )
 	{
@@ -2187,17 +2486,35 @@ void ImageWriter::execute() const
 		TileChannelDataProcessor channelDataProcessor( colorSpaceByView );
 		if( !part.spec.deep )
 		{
+			const size_t tileBytes = ImagePlug::tilePixels() * part.channels.size() * sizeof( float );
+			auto flatTileBytes = [tileBytes] ( const V2i &tileOrigin ) {
+				return tileBytes;
+			};
+
+			// The writers buffer a full row of scanlines, sized to the output
+			// width. FlatScanlineWriter double-buffers so that it can write one row
+			// while assembling the next, and FlatTileWriter buffers at least one
+			// row of output tiles.
+			const size_t rowBytes = part.spec.width * part.channels.size() * sizeof( float );
 
 			if ( part.spec.tile_width == 0 )
 			{
+				const size_t bufferBytes = 2 * rowBytes * ImagePlug::tileSize();
 				FlatScanlineWriter flatScanlineWriter( out, fileName, part.processDataWindow, part.imageFormat, part.channels );
-				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, flatScanlineWriter, part.processDataWindow, ImageAlgo::TopToBottom );
+				gatherTilesWithinMemoryLimit(
+					colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, flatScanlineWriter, part.processDataWindow, flatTileBytes,
+					[bufferBytes] ( int tileOriginY ) { return bufferBytes; }
+				);
 				flatScanlineWriter.finish();
 			}
 			else
 			{
+				const size_t bufferBytes = rowBytes * std::max( part.spec.tile_height, ImagePlug::tileSize() );
 				FlatTileWriter flatTileWriter( out, fileName, part.processDataWindow, part.imageFormat, part.channels );
-				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, flatTileWriter, part.processDataWindow, ImageAlgo::TopToBottom );
+				gatherTilesWithinMemoryLimit(
+					colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, flatTileWriter, part.processDataWindow, flatTileBytes,
+					[bufferBytes] ( int tileOriginY ) { return bufferBytes; }
+				);
 				flatTileWriter.finish();
 			}
 
@@ -2214,15 +2531,35 @@ void ImageWriter::execute() const
 				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), sampleOffsetsProcessor, sampleOffsetsAccumulator, part.processDataWindow );
 			}
 
+			// Deep tiles vary enormously in size, but having gathered the sample offsets,
+			// we know exactly how big each one will be.
+			auto deepTileBytes = [&] ( const V2i &tileOrigin ) {
+				const size_t numSamples = sampleOffsetsAccumulator.m_sampleOffsets.at( tileOrigin )->readable().back();
+				return numSamples * part.channels.size() * sizeof( float );
+			};
+
+			// Both deep writers accumulate the samples for a whole row of tiles
+			// before writing them.
+			const int minTileOriginX = ImagePlug::tileOrigin( part.processDataWindow.min ).x;
+			const int maxTileOriginX = ImagePlug::tileOrigin( part.processDataWindow.max - V2i( 1 ) ).x;
+			auto deepRowBufferBytes = [&] ( int tileOriginY ) {
+				size_t result = 0;
+				for( int x = minTileOriginX; x <= maxTileOriginX; x += ImagePlug::tileSize() )
+				{
+					result += deepTileBytes( V2i( x, tileOriginY ) );
+				}
+				return result;
+			};
+
 			if( part.spec.tile_width == 0 )
 			{
 				DeepScanlineWriter deepScanlineWriter( out, fileName, part.processDataWindow, part.imageFormat, part.channels, sampleOffsetsAccumulator.m_sampleOffsets );
-				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, deepScanlineWriter, part.processDataWindow, ImageAlgo::TopToBottom );
+				gatherTilesWithinMemoryLimit( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, deepScanlineWriter, part.processDataWindow, deepTileBytes, deepRowBufferBytes );
 			}
 			else
 			{
 				DeepTileWriter deepTileWriter( out, fileName, part.processDataWindow, part.imageFormat, part.channels, sampleOffsetsAccumulator.m_sampleOffsets );
-				ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, deepTileWriter, part.processDataWindow, ImageAlgo::TopToBottom );
+				gatherTilesWithinMemoryLimit( colorSpaceNode()->outPlug(), part.channels, channelDataProcessor, deepTileWriter, part.processDataWindow, deepTileBytes, deepRowBufferBytes );
 			}
 		}
 	}
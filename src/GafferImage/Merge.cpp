@@ -44,6 +44,10 @@
 #include "IECore/BoxOps.h"
 
 #include "fmt/format.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <limits>
 
 using namespace std;
@@ -55,6 +59,15 @@ using namespace GafferImage;
 namespace
 {
 
+// The operations below must not have their multiplies and adds contracted into
+// FMA instructions, because those are only available to the AVX-512 kernels, and
+// would give different results to the other kernels (see `mergeSpan()`).
+// Contraction happens in Clang's frontend, so the pragma must be in effect where
+// the operations are defined.
+#ifdef __clang__
+#pragma clang fp contract( off )
+#endif
+
 enum SingleInputMode
 {
 	Operate,
@@ -148,16 +161,13 @@ struct OpDifference
 {
 	static float operate( float A, float B, float a, float b)
 	{
-		if( memcmp( &A, &B, 4 ) == 0 )
-		{
-			return 0.0f;
-		}
-		float ret = fabs( A - B );
-		if( std::isnan( ret ) )
-		{
-			ret = std::numeric_limits<float>::infinity();
-		}
-		return ret;
+		// Written branch-free so that `mergeSpan()` can be vectorised.
+		// Identical values return 0 even if they are infinite or NaN.
+		uint32_t aBits, bBits;
+		memcpy( &aBits, &A, sizeof( float ) );
+		memcpy( &bBits, &B, sizeof( float ) );
+		const float ret = fabs( A - B );
+		return aBits == bBits ? 0.0f : ( std::isnan( ret ) ? std::numeric_limits<float>::infinity() : ret );
 	}
 	static const SingleInputMode onlyA = Operate;
 	static const SingleInputMode onlyB = Operate;
@@ -303,6 +313,140 @@ inline MergeRegion tileRegion( int i, const Box2i &boundA, const Box2i &boundB,
 	return (MergeRegion)(( InsideA * inA ) | ( InsideB * inB ));
 }
 
+// Merge kernels
+// =============
+//
+// `mergeSpan()` runs `Op::operate()` for a run of pixels within a single
+// MergeRegion, substituting zero for any input we're outside of. Pixels are
+// processed in small blocks via local buffers. This allows the outputs to
+// alias the B inputs, as they do when we're accumulating in the merge
+// buffers, while still proving to the compiler that the inner loop is free
+// of aliasing, so that it can be vectorised.
+//
+// On x86-64 we compile additional AVX2 and AVX-512 versions of each kernel
+// and choose between them at runtime, since the default build only targets
+// SSE2. On ARM, NEON is part of the baseline, so the default kernel is
+// already vectorised. Every version performs exactly the same arithmetic,
+// so results are identical regardless of the instruction set used. This
+// requires FP contraction to be disabled, since `avx512f` implies FMA and GCC
+// contracts by default. GCC contracts after inlining, so the `optimize` pragma
+// must be in effect for the kernels rather than the operations. The instruction
+// set may be limited using the `GAFFERIMAGE_MERGE_INSTRUCTION_SET` environment
+// variable, which is used to test that the kernels agree.
+
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && defined( __x86_64__ )
+#define GAFFERIMAGE_MERGE_DISPATCH
+#define GAFFERIMAGE_MERGE_INLINE inline __attribute__(( always_inline ))
+#else
+#define GAFFERIMAGE_MERGE_INLINE inline
+#endif
+
+#if defined( __GNUC__ ) && !defined( __clang__ )
+#pragma GCC push_options
+#pragma GCC optimize( "fp-contract=off" )
+#endif
+
+template<typename Op, MergeRegion region>
+GAFFERIMAGE_MERGE_INLINE void mergeSpanInternal( const float *A, const float *a, const float *B, const float *b, float *R, float *r, int length )
+{
+	constexpr int blockSize = 64;
+	float blockR[blockSize];
+	float blockr[blockSize];
+
+	for( int i = 0; i < length; i += blockSize )
+	{
+		const int n = std::min( blockSize, length - i );
+		for( int j = 0; j < n; ++j )
+		{
+			const float Aj = region & InsideA ? A[i+j] : 0.0f;
+			const float aj = region & InsideA ? a[i+j] : 0.0f;
+			const float Bj = region & InsideB ? B[i+j] : 0.0f;
+			const float bj = region & InsideB ? b[i+j] : 0.0f;
+			blockR[j] = Op::operate( Aj, Bj, aj, bj );
+			blockr[j] = Op::operate( aj, bj, aj, bj );
+		}
+		memcpy( R + i, blockR, n * sizeof( float ) );
+		memcpy( r + i, blockr, n * sizeof( float ) );
+	}
+}
+
+#ifdef GAFFERIMAGE_MERGE_DISPATCH
+
+template<typename Op, MergeRegion region>
+__attribute__(( target( "avx2" ) )) void mergeSpanAVX2( const float *A, const float *a, const float *B, const float *b, float *R, float *r, int length )
+{
+	mergeSpanInternal<Op, region>( A, a, B, b, R, r, length );
+}
+
+template<typename Op, MergeRegion region>
+__attribute__(( target( "avx512f" ) )) void mergeSpanAVX512( const float *A, const float *a, const float *B, const float *b, float *R, float *r, int length )
+{
+	mergeSpanInternal<Op, region>( A, a, B, b, R, r, length );
+}
+
+enum class InstructionSet
+{
+	Default,
+	AVX2,
+	AVX512
+};
+
+InstructionSet instructionSet()
+{
+	static const InstructionSet g_instructionSet = [] {
+
+		InstructionSet limit = InstructionSet::AVX512;
+		if( const char *e = getenv( "GAFFERIMAGE_MERGE_INSTRUCTION_SET" ) )
+		{
+			if( !strcmp( e, "Default" ) )
+			{
+				limit = InstructionSet::Default;
+			}
+			else if( !strcmp( e, "AVX2" ) )
+			{
+				limit = InstructionSet::AVX2;
+			}
+		}
+
+		__builtin_cpu_init();
+		if( limit >= InstructionSet::AVX512 && __builtin_cpu_supports( "avx512f" ) )
+		{
+			return InstructionSet::AVX512;
+		}
+		else if( limit >= InstructionSet::AVX2 && __builtin_cpu_supports( "avx2" ) )
+		{
+			return InstructionSet::AVX2;
+		}
+		return InstructionSet::Default;
+	}();
+	return g_instructionSet;
+}
+
+#endif // GAFFERIMAGE_MERGE_DISPATCH
+
+template<typename Op, MergeRegion region>
+void mergeSpan( const float *A, const float *a, const float *B, const float *b, float *R, float *r, int length )
+{
+#ifdef GAFFERIMAGE_MERGE_DISPATCH
+	switch( instructionSet() )
+	{
+		case InstructionSet::AVX512 :
+			mergeSpanAVX512<Op, region>( A, a, B, b, R, r, length );
+			return;
+		case InstructionSet::AVX2 :
+			mergeSpanAVX2<Op, region>( A, a, B, b, R, r, length );
+			return;
+		default :
+			break;
+	}
+#endif
+	mergeSpanInternal<Op, region>( A, a, B, b, R, r, length );
+}
+
+#if defined( __GNUC__ ) && !defined( __clang__ )
+#pragma GCC pop_options
+#endif
+
 struct MergeFunctor
 {
 	using ReturnType = void;
@@ -381,6 +525,23 @@ struct MergeFunctor
 			return;
 		}
 
+		// If both inputs are uniform across the whole tile, then so is the
+		// result, and we only need to operate on a single value.
+		const Box2i fullBound( V2i( 0 ), V2i( ImagePlug::tileSize() ) );
+		float uniformA, uniformAlphaA, uniformB, uniformAlphaB;
+		if(
+			boundA == fullBound && boundB == fullBound &&
+			ImagePlug::isUniformTile( channelDataA.get(), uniformA ) &&
+			ImagePlug::isUniformTile( alphaDataA.get(), uniformAlphaA ) &&
+			ImagePlug::isUniformTile( channelDataB.get(), uniformB ) &&
+			ImagePlug::isUniformTile( alphaDataB.get(), uniformAlphaB )
+		)
+		{
+			channelDataB = ImagePlug::uniformTile( Op::operate( uniformA, uniformB, uniformAlphaA, uniformAlphaB ) );
+			alphaDataB = ImagePlug::uniformTile( Op::operate( uniformAlphaA, uniformAlphaB, uniformAlphaA, uniformAlphaB ) );
+			return;
+		}
+
 		// The base layer (B) with the current result
 		const float *B = &channelDataB->readable().front();
 		const float *b = &alphaDataB->readable().front();
@@ -459,14 +620,10 @@ struct MergeFunctor
 				else
 				{
 					// Outside A dataWindow, so call operator with 0 substituted for A and a
-					for( int j = 0; j < length; j++ )
-					{
-						*R = Op::operate( 0.0f, *B, 0.0f, *b );
-						*r = Op::operate( 0.0f, *b, 0.0f, *b );
-						++B; ++b;
-						++R; ++r;
-					}
+					mergeSpan<Op, InsideB>( A, a, B, b, R, r, length );
 					A += length; a += length;
+					B += length; b += length;
+					R += length; r += length;
 				}
 			}
 			else if( region == InsideA )
@@ -484,27 +641,19 @@ struct MergeFunctor
 				else
 				{
 					// Outside B dataWindow, so call operator with 0 substituted for B and b
-					for( int j = 0; j < length; j++ )
-					{
-						*R = Op::operate( *A, 0.0f, *a, 0.0f );
-						*r = Op::operate( *a, 0.0f, *a, 0.0f );
-						++A; ++a;
-						++R; ++r;
-					}
+					mergeSpan<Op, InsideA>( A, a, B, b, R, r, length );
+					A += length; a += length;
 					B += length; b += length;
+					R += length; r += length;
 				}
 			}
 			else
 			{
 				// Within both data windows, this is when we actually need to run the full operate()
-				for( int j = 0; j < length; j++ )
-				{
-					*R = Op::operate( *A, *B, *a, *b );
-					*r = Op::operate( *a, *b, *a, *b );
-					++A; ++a;
-					++B; ++b;
-					++R; ++r;
-				}
+				mergeSpan<Op, InsideBoth>( A, a, B, b, R, r, length );
+				A += length; a += length;
+				B += length; b += length;
+				R += length; r += length;
 			}
 			i += length;
 		}
@@ -45,6 +45,7 @@
 #include "GafferImage/ImageReader.h"
 
 #include "Gaffer/Context.h"
+#include "Gaffer/MemoryPressure.h"
 #include "Gaffer/StringPlug.h"
 
 #include "IECoreImage/OpenImageIOAlgo.h"
@@ -63,8 +64,14 @@
 
 #include "tbb/parallel_for.h"
 #include "tbb/enumerable_thread_specific.h"
+#include "tbb/task_arena.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <tuple>
 
 using namespace std;
 using namespace boost::placeholders;
@@ -118,6 +125,51 @@ const IECore::InternedString g_noView( "" );
 
 const std::string g_oiioCompression( "compression" );
 
+// The limit specified by `setReadAheadMemoryLimit()`, and the memory
+// currently held by speculative tile batch reads that have not yet been
+// claimed by a compute.
+std::atomic_size_t g_readAheadMemoryLimit( 256 * 1024 * 1024 );
+std::atomic_size_t g_readAheadMemoryUsage( 0 );
+
+// The maximum number of batches we will read ahead of the most recently
+// requested one.
+const int g_readAheadDepth = 4;
+
+// The number of recently requested batches we remember per file. We don't
+// read these ahead, because they are likely to still be in the compute cache.
+// The window is bounded so that batches that have since been evicted may be
+// read ahead again, and so that memory usage doesn't grow with the number of
+// batches requested.
+const size_t g_recentRequestsSize = 8 * g_readAheadDepth;
+
+bool reserveReadAheadMemory( size_t bytes )
+{
+	const size_t limit = g_readAheadMemoryLimit;
+	size_t usage = g_readAheadMemoryUsage;
+	do
+	{
+		if( usage + bytes > limit )
+		{
+			return false;
+		}
+	} while( !g_readAheadMemoryUsage.compare_exchange_weak( usage, usage + bytes ) );
+	return true;
+}
+
+void releaseReadAheadMemory( size_t bytes )
+{
+	g_readAheadMemoryUsage -= bytes;
+}
+
+// Read-ahead tasks are enqueued in their own arena rather than the one we
+// happen to be called from, since that may be a short-lived arena belonging
+// to a TaskCollaboration compute.
+tbb::task_arena &readAheadArena()
+{
+	static tbb::task_arena *a = new tbb::task_arena();
+	return *a;
+}
+
 struct ChannelMapEntry
 {
 	ChannelMapEntry( int subImage, int channelIndex )
@@ -736,9 +788,13 @@ Box2i expandToGrid( Box2i region, V2i gridOrigin, V2i gridSize )
 // Tile batches are selected using V3i "tileBatchOrigin".  The Z component is the subimage to load channels from.
 // The X and Y components are the pixel coordinates of the origin of the first tile.
 //
-class File
+class File : public std::enable_shared_from_this<File>
 {
 
+	private :
+
+		struct View;
+
 	public:
 
 		// Create a File handle object for an image input and image spec
@@ -970,11 +1026,34 @@ class File
 			}
 		}
 
-		// Read a chunk of data from the file, formatted as a tile batch that will be stored on the tile batch plug
+		~File()
+		{
+			for( const auto &[key, readAhead] : m_readAheads )
+			{
+				releaseReadAheadMemory( readAhead.cost );
+			}
+		}
+
+		// Returns the tile batch that will be stored on the tile batch plug, using the result of a
+		// previous read-ahead if one is available. Also schedules background reads for the batches
+		// we expect to be requested next.
 		ConstObjectVectorPtr readTileBatch( const Context *c, V3i tileBatchOrigin )
 		{
 			const View& view = lookupView( c );
 
+			ConstObjectVectorPtr result = claimReadAhead( view, tileBatchOrigin );
+			scheduleReadAhead( view, tileBatchOrigin );
+			if( !result )
+			{
+				result = loadTileBatch( view, tileBatchOrigin );
+			}
+
+			return result;
+		}
+
+		// Read a chunk of data from the file, formatted as a tile batch that will be stored on the tile batch plug
+		ConstObjectVectorPtr loadTileBatch( const View &view, V3i tileBatchOrigin )
+		{
 			const ImageSpec spec = m_imageInput->spec( tileBatchOrigin.z, 0 );
 
 			const int tileBatchNumTileChannels = spec.nchannels * view.tileBatchSize.y * view.tileBatchSize.x;
@@ -1556,6 +1635,240 @@ class File
 			return channelIndex * tilePlaneSize + subXY.y * view.tileBatchSize.x + subXY.x;
 		}
 
+		// Read-ahead
+		// ==========
+		//
+		// Consumers such as ImageWriter request tiles in a predictable order, and the Viewer
+		// requests tiles in the direction it is being panned. We track the direction of travel
+		// between successive tile batch requests, and issue background reads for the batches that
+		// lie ahead, so that on high latency storage the reads overlap with the processing of the
+		// current batch. The results are held here until claimed by `readTileBatch()`, and the
+		// memory they use is bounded globally by `OpenImageIOReader::setReadAheadMemoryLimit()`.
+
+		using ReadAheadKey = std::tuple<const View *, int, int, int>;
+
+		struct ReadAhead
+		{
+			enum class State
+			{
+				Pending,
+				Reading,
+				Done
+			};
+
+			State state = State::Pending;
+			size_t cost = 0;
+			ConstObjectVectorPtr result;
+		};
+
+		static ReadAheadKey readAheadKey( const View &view, const V3i &tileBatchOrigin )
+		{
+			return ReadAheadKey( &view, tileBatchOrigin.x, tileBatchOrigin.y, tileBatchOrigin.z );
+		}
+
+		// Returns the result of a previous read-ahead, or null if none is available.
+		ConstObjectVectorPtr claimReadAhead( const View &view, const V3i &tileBatchOrigin )
+		{
+			const ReadAheadKey key = readAheadKey( view, tileBatchOrigin );
+
+			std::unique_lock<std::mutex> lock( m_readAheadMutex );
+			m_recentRequests.push_back( key );
+			if( m_recentRequests.size() > g_recentRequestsSize )
+			{
+				m_recentRequests.pop_front();
+			}
+
+			auto it = m_readAheads.find( key );
+			if( it == m_readAheads.end() )
+			{
+				return nullptr;
+			}
+
+			if( it->second.state == ReadAhead::State::Pending )
+			{
+				// The background task hasn't started yet. Rather than wait for it, we
+				// remove the entry and do the read ourselves - the task will find nothing
+				// to do when it eventually runs.
+				releaseReadAheadMemory( it->second.cost );
+				m_readAheads.erase( it );
+				return nullptr;
+			}
+
+			// The read is underway on another thread. Waiting for it can't deadlock, because
+			// that thread is already running and doesn't depend on us.
+			m_readAheadCondition.wait(
+				lock, [&] {
+					it = m_readAheads.find( key );
+					return it == m_readAheads.end() || it->second.state == ReadAhead::State::Done;
+				}
+			);
+
+			if( it == m_readAheads.end() )
+			{
+				// Background read failed. We'll read again ourselves, and report the error
+				// to the caller.
+				return nullptr;
+			}
+
+			ConstObjectVectorPtr result = it->second.result;
+			releaseReadAheadMemory( it->second.cost );
+			m_readAheads.erase( it );
+			return result;
+		}
+
+		void scheduleReadAhead( const View &view, const V3i &tileBatchOrigin )
+		{
+			if( !g_readAheadMemoryLimit )
+			{
+				return;
+			}
+
+			const ImageSpec spec = m_imageInput->spec_dimensions( tileBatchOrigin.z, 0 );
+			if( spec.deep )
+			{
+				// We can't know how much memory a deep batch will need until we've read it.
+				return;
+			}
+
+			const V2i fileDataOrigin( spec.x, spec.y );
+			const Box2i gafferDataWindow = flopDisplayWindow( Box2i( fileDataOrigin, fileDataOrigin + V2i( spec.width, spec.height ) ), spec );
+			const V2i batchExtent = view.tileBatchSize * ImagePlug::tileSize();
+			const size_t cost = (size_t)spec.nchannels * view.tileBatchSize.x * view.tileBatchSize.y * ImagePlug::tilePixels() * sizeof( float );
+
+			std::vector<V3i> toRead;
+			{
+				std::lock_guard<std::mutex> lock( m_readAheadMutex );
+
+				// Determine the direction of travel from the previous request.
+
+				const V2i origin( tileBatchOrigin.x, tileBatchOrigin.y );
+				auto [lastIt, inserted] = m_lastRequestedBatches.try_emplace( std::make_pair( &view, tileBatchOrigin.z ), origin );
+				if( inserted )
+				{
+					return;
+				}
+
+				const V2i delta = origin - lastIt->second;
+				lastIt->second = origin;
+
+				const V2i direction(
+					view.tiled ? ( delta.x > 0 ) - ( delta.x < 0 ) : 0,
+					( delta.y > 0 ) - ( delta.y < 0 )
+				);
+
+				if( direction == V2i( 0 ) )
+				{
+					return;
+				}
+
+				// Find the batches ahead of us.
+
+				std::vector<V3i> ahead;
+				for( int i = 1; i <= g_readAheadDepth; ++i )
+				{
+					const V2i o = origin + direction * batchExtent * i;
+					if( !BufferAlgo::intersects( gafferDataWindow, Box2i( o, o + batchExtent ) ) )
+					{
+						break;
+					}
+					ahead.push_back( V3i( o.x, o.y, tileBatchOrigin.z ) );
+				}
+
+				// Discard any previous reads that are no longer ahead of us, since they
+				// are unlikely to be requested now.
+
+				for( auto it = m_readAheads.begin(); it != m_readAheads.end(); )
+				{
+					const auto &[keyView, x, y, subImage] = it->first;
+					if(
+						keyView == &view && subImage == tileBatchOrigin.z &&
+						it->second.state != ReadAhead::State::Reading &&
+						std::find( ahead.begin(), ahead.end(), V3i( x, y, subImage ) ) == ahead.end()
+					)
+					{
+						releaseReadAheadMemory( it->second.cost );
+						it = m_readAheads.erase( it );
+					}
+					else
+					{
+						++it;
+					}
+				}
+
+				// Register new reads, for as long as we have memory available.
+
+				for( const V3i &o : ahead )
+				{
+					const ReadAheadKey key = readAheadKey( view, o );
+					if(
+						m_readAheads.count( key ) ||
+						std::find( m_recentRequests.begin(), m_recentRequests.end(), key ) != m_recentRequests.end()
+					)
+					{
+						continue;
+					}
+
+					if( !reserveReadAheadMemory( cost ) )
+					{
+						break;
+					}
+
+					m_readAheads[key].cost = cost;
+					toRead.push_back( o );
+				}
+			}
+
+			for( const V3i &o : toRead )
+			{
+				readAheadArena().enqueue(
+					[file = shared_from_this(), view = &view, o] {
+						file->readAhead( *view, o );
+					}
+				);
+			}
+		}
+
+		void readAhead( const View &view, const V3i &tileBatchOrigin )
+		{
+			const ReadAheadKey key = readAheadKey( view, tileBatchOrigin );
+			{
+				std::lock_guard<std::mutex> lock( m_readAheadMutex );
+				auto it = m_readAheads.find( key );
+				if( it == m_readAheads.end() || it->second.state != ReadAhead::State::Pending )
+				{
+					// Claimed or discarded before we got going.
+					return;
+				}
+				it->second.state = ReadAhead::State::Reading;
+			}
+
+			ConstObjectVectorPtr result;
+			try
+			{
+				result = loadTileBatch( view, tileBatchOrigin );
+			}
+			catch( ... )
+			{
+				// Errors are reported if and when the batch is actually requested.
+			}
+
+			{
+				std::lock_guard<std::mutex> lock( m_readAheadMutex );
+				auto it = m_readAheads.find( key );
+				if( result )
+				{
+					it->second.state = ReadAhead::State::Done;
+					it->second.result = result;
+				}
+				else
+				{
+					releaseReadAheadMemory( it->second.cost );
+					m_readAheads.erase( it );
+				}
+			}
+			m_readAheadCondition.notify_all();
+		}
+
 		inline const View &lookupView( const Context *c ) const
 		{
 			std::string viewName = c->get<std::string>( ImagePlug::viewNameContextName, ImagePlug::defaultViewName );
@@ -1607,6 +1920,12 @@ class File
 		std::string m_filePath;
 		StringVectorDataPtr m_viewNamesData;
 		std::map<std::string, std::unique_ptr< View > > m_views;
+
+		std::mutex m_readAheadMutex;
+		std::condition_variable m_readAheadCondition;
+		std::map<ReadAheadKey, ReadAhead> m_readAheads;
+		std::deque<ReadAheadKey> m_recentRequests;
+		std::map<std::pair<const View *, int>, V2i> m_lastRequestedBatches;
 };
 
 using FilePtr = std::shared_ptr<File>;
@@ -1649,9 +1968,48 @@ CacheEntry fileCacheGetter( const std::pair< std::string, ImageReader::ChannelIn
 
 using FileHandleCache = IECorePreview::LRUCache< std::pair< std::string, ImageReader::ChannelInterpretation >, CacheEntry>;
 
+// The limit specified by `setOpenFilesLimit()`. The cache itself
+// may be held below this when under memory pressure.
+std::atomic_size_t g_openFilesLimit( 200 );
+
+void adaptOpenFilesLimit( FileHandleCache *cache, size_t usage, size_t target )
+{
+	const size_t upperBound = g_openFilesLimit;
+	size_t limit = cache->getMaxCost();
+	if( !target )
+	{
+		limit = upperBound;
+	}
+	else if( usage > target )
+	{
+		// We have no way of knowing how much memory each file is
+		// using, so simply halve the limit, evicting immediately.
+		limit = std::max<size_t>( limit / 2, std::max<size_t>( upperBound / 16, 1 ) );
+	}
+	else
+	{
+		limit = limit + std::max<size_t>( upperBound / 16, 1 );
+	}
+
+	limit = std::min( limit, upperBound );
+	if( limit != cache->getMaxCost() )
+	{
+		cache->setMaxCost( limit );
+	}
+}
+
 FileHandleCache *fileCache()
 {
-	static FileHandleCache *c = new FileHandleCache( fileCacheGetter, 200 );
+	static FileHandleCache *c = [] {
+		FileHandleCache *result = new FileHandleCache( fileCacheGetter, g_openFilesLimit );
+		Gaffer::MemoryPressure::registerHandler(
+			"OpenImageIOReader",
+			[result] ( size_t usage, size_t target ) {
+				adaptOpenFilesLimit( result, usage, target );
+			}
+		);
+		return result;
+	} ();
 	return c;
 }
 
@@ -1787,12 +2145,23 @@ const Gaffer::ObjectVectorPlug *OpenImageIOReader::tileBatchPlug() const
 
 void OpenImageIOReader::setOpenFilesLimit( size_t maxOpenFiles )
 {
+	g_openFilesLimit = maxOpenFiles;
 	fileCache()->setMaxCost( maxOpenFiles );
 }
 
 size_t OpenImageIOReader::getOpenFilesLimit()
 {
-	return fileCache()->getMaxCost();
+	return g_openFilesLimit;
+}
+
+void OpenImageIOReader::setReadAheadMemoryLimit( size_t bytes )
+{
+	g_readAheadMemoryLimit = bytes;
+}
+
+size_t OpenImageIOReader::getReadAheadMemoryLimit()
+{
+	return g_readAheadMemoryLimit;
 }
 
 size_t OpenImageIOReader::supportedExtensions( std::vector<std::string> &extensions )
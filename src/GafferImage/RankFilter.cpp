@@ -42,6 +42,8 @@
 
 #include <algorithm>
 #include <climits>
+#include <cstdint>
+#include <cstring>
 #include <boost/heap/d_ary_heap.hpp>
 
 using namespace std;
@@ -716,6 +718,347 @@ void processTileIndices( Sampler &sampler, const V2i &radius, const Box2i &tileB
 	}
 }
 
+// For large radii, the row buffers above become expensive, because every output pixel
+// must resample and reprocess a complete row of its support. The following implementations
+// instead read the full support of the tile once up front, and then compute the results with
+// a cost per pixel that is independent of the radius ( for Erode and Dilate ) or grows only
+// linearly with it ( for Median ).
+
+// Reads the pixels of `region` into a row-major buffer, replacing NaNs with `nanValue`
+// to match the treatment by the buffers above.
+void sampleRegion( Sampler &sampler, const Box2i &region, float nanValue, vector<float> &values )
+{
+	const int width = region.size().x;
+	values.resize( width * region.size().y );
+	sampler.visitPixels( region,
+		[&values, &region, width, nanValue] ( float v, int x, int y )
+		{
+			values[ ( y - region.min.y ) * width + x - region.min.x ] = std::isnan( v ) ? nanValue : v;
+		}
+	);
+}
+
+struct MinOperation
+{
+	static constexpr float nanValue = std::numeric_limits<float>::infinity();
+	float operator()( float a, float b ) const { return std::min( a, b ); }
+};
+
+struct MaxOperation
+{
+	static constexpr float nanValue = -std::numeric_limits<float>::infinity();
+	float operator()( float a, float b ) const { return std::max( a, b ); }
+};
+
+// Computes `out[i] = op( in[i], ..., in[i + window - 1] )` for `0 <= i < outSize` using the
+// van Herk/Gil-Werman algorithm, which requires just three applications of `op` per element
+// regardless of the window size. The input is divided into blocks of `window` elements, and
+// for each block we compute a prefix and a suffix accumulation. Every output window then
+// spans exactly one block boundary, so is the combination of a suffix and a prefix.
+//
+// Each element is actually a contiguous span of `width` floats, allowing the same code to
+// perform both the horizontal pass ( `width == 1` ) and a vectorisable vertical pass ( where
+// each element is a whole row ).
+template<typename Operation>
+void vanHerkGilWerman( const float *in, int inSize, int window, int width, float *prefix, float *suffix, float *out, int outSize )
+{
+	Operation op;
+	for( int blockStart = 0; blockStart < inSize; blockStart += window )
+	{
+		const int blockEnd = std::min( blockStart + window, inSize );
+
+		std::copy( in + blockStart * width, in + ( blockStart + 1 ) * width, prefix + blockStart * width );
+		for( int i = blockStart + 1; i < blockEnd; ++i )
+		{
+			for( int c = 0; c < width; ++c )
+			{
+				prefix[i * width + c] = op( prefix[(i - 1) * width + c], in[i * width + c] );
+			}
+		}
+
+		std::copy( in + ( blockEnd - 1 ) * width, in + blockEnd * width, suffix + ( blockEnd - 1 ) * width );
+		for( int i = blockEnd - 2; i >= blockStart; --i )
+		{
+			for( int c = 0; c < width; ++c )
+			{
+				suffix[i * width + c] = op( suffix[(i + 1) * width + c], in[i * width + c] );
+			}
+		}
+	}
+
+	for( int i = 0; i < outSize; ++i )
+	{
+		for( int c = 0; c < width; ++c )
+		{
+			out[i * width + c] = op( suffix[i * width + c], prefix[(i + window - 1) * width + c] );
+		}
+	}
+}
+
+// Separable Erode/Dilate : the minimum or maximum over a rectangle is the minimum or maximum
+// over the columns of the minimum or maximum over the rows.
+template<typename Operation>
+void processTileSeparable( Sampler &sampler, const V2i &radius, const Box2i &tileBound, vector<float> &result, const Canceller *canceller )
+{
+	const int tileSize = ImagePlug::tileSize();
+	const Box2i inputBound( tileBound.min - radius, tileBound.max + radius );
+	const V2i inputSize = inputBound.size();
+	const V2i s = 2 * radius + V2i( 1 );
+
+	vector<float> input;
+	sampleRegion( sampler, inputBound, Operation::nanValue, input );
+
+	IECore::Canceller::check( canceller );
+
+	// Horizontal pass, reducing each row of the input to the width of the tile.
+	vector<float> prefix( inputSize.x );
+	vector<float> suffix( prefix.size() );
+	vector<float> rows( tileSize * inputSize.y );
+	for( int y = 0; y < inputSize.y; ++y )
+	{
+		vanHerkGilWerman<Operation>(
+			&input[y * inputSize.x], inputSize.x, s.x, 1,
+			prefix.data(), suffix.data(), &rows[y * tileSize], tileSize
+		);
+	}
+
+	IECore::Canceller::check( canceller );
+
+	// Vertical pass, operating on whole rows at a time.
+	prefix.resize( rows.size() );
+	suffix.resize( rows.size() );
+	vanHerkGilWerman<Operation>(
+		rows.data(), inputSize.y, s.y, tileSize,
+		prefix.data(), suffix.data(), result.data(), tileSize
+	);
+}
+
+// Median using a sliding histogram, in the manner of Huang's algorithm. To get exact results
+// for floating point data, the histogram is not over quantised pixel values but over the ranks
+// of the pixels within the support of the whole tile, which we get with a single sort up front.
+// Each rank is then unique, and the histogram just records which ranks are within the current
+// filter support. We track the rank of the median and the number of pixels below it, so that
+// moving the support by one pixel requires only one row or column of updates, and a ( typically
+// very short ) walk to the new median. The walk skips empty blocks of ranks using a coarse
+// count per block.
+class RankMedianHistogram
+{
+public:
+
+	RankMedianHistogram( int numRanks, int supportSize )
+		:	m_present( ( numRanks / g_blockSize + 1 ) * g_blockSize, 0 ), m_blockCounts( numRanks / g_blockSize + 1, 0 ),
+			m_target( supportSize / 2 ), m_median( 0 ), m_numBelow( 0 )
+	{
+	}
+
+	inline void add( uint32_t rank )
+	{
+		m_present[rank] = 1;
+		m_blockCounts[rank / g_blockSize]++;
+		m_numBelow += rank < m_median;
+	}
+
+	inline void remove( uint32_t rank )
+	{
+		m_present[rank] = 0;
+		m_blockCounts[rank / g_blockSize]--;
+		m_numBelow -= rank < m_median;
+	}
+
+	// Returns the rank of the median, which is the rank that is present,
+	// and has exactly `m_target` present ranks below it.
+	inline uint32_t median()
+	{
+		while( m_numBelow > m_target )
+		{
+			m_median = previous( m_median );
+			m_numBelow--;
+		}
+
+		while( true )
+		{
+			m_median = next( m_median );
+			if( m_numBelow == m_target )
+			{
+				return m_median;
+			}
+			m_numBelow++;
+			m_median++;
+		}
+	}
+
+private :
+
+	static constexpr uint32_t g_blockSize = 32;
+
+	// Returns the highest present rank less than `rank`. Such a rank must exist.
+	inline uint32_t previous( uint32_t rank ) const
+	{
+		uint32_t block = rank / g_blockSize;
+		if( m_blockCounts[block] )
+		{
+			for( uint32_t r = rank; r > block * g_blockSize; )
+			{
+				if( m_present[--r] )
+				{
+					return r;
+				}
+			}
+		}
+
+		do
+		{
+			--block;
+		} while( !m_blockCounts[block] );
+
+		rank = ( block + 1 ) * g_blockSize - 1;
+		while( !m_present[rank] )
+		{
+			--rank;
+		}
+		return rank;
+	}
+
+	// Returns the lowest present rank greater than or equal to `rank`. Such a rank must exist.
+	inline uint32_t next( uint32_t rank ) const
+	{
+		uint32_t block = rank / g_blockSize;
+		if( m_blockCounts[block] )
+		{
+			for( uint32_t r = rank; r < ( block + 1 ) * g_blockSize; ++r )
+			{
+				if( m_present[r] )
+				{
+					return r;
+				}
+			}
+		}
+
+		do
+		{
+			++block;
+		} while( !m_blockCounts[block] );
+
+		rank = block * g_blockSize;
+		while( !m_present[rank] )
+		{
+			++rank;
+		}
+		return rank;
+	}
+
+	std::vector<uint8_t> m_present;
+	std::vector<int> m_blockCounts;
+	const int m_target;
+	uint32_t m_median;
+	int m_numBelow;
+
+};
+
+void processTileMedianHistogram( Sampler &sampler, const V2i &radius, const Box2i &tileBound, vector<float> &result, const Canceller *canceller )
+{
+	const int tileSize = ImagePlug::tileSize();
+	const Box2i inputBound( tileBound.min - radius, tileBound.max + radius );
+	const int inputWidth = inputBound.size().x;
+	const V2i s = 2 * radius + V2i( 1 );
+
+	// Sort the input pixels, to get the rank of each one. We sort 64 bit keys with the value
+	// in the upper bits, mapped to an unsigned integer with the same ordering, and the pixel
+	// index in the lower bits.
+
+	vector<float> input;
+	sampleRegion( sampler, inputBound, -infinity, input );
+
+	vector<uint64_t> keys( input.size() );
+	for( size_t i = 0; i < input.size(); ++i )
+	{
+		uint32_t bits;
+		std::memcpy( &bits, &input[i], sizeof( bits ) );
+		bits = ( bits & 0x80000000 ) ? ~bits : ( bits | 0x80000000 );
+		keys[i] = ( uint64_t( bits ) << 32 ) | i;
+	}
+	std::sort( keys.begin(), keys.end() );
+
+	vector<uint32_t> ranks( input.size() );
+	vector<float> sortedValues( input.size() );
+	for( size_t i = 0; i < keys.size(); ++i )
+	{
+		const uint32_t index = keys[i] & 0xFFFFFFFF;
+		ranks[index] = i;
+		sortedValues[i] = input[index];
+	}
+
+	IECore::Canceller::check( canceller );
+
+	// Slide the support through the tile, boustrophedon style, so that each step
+	// only needs to update a single row or column.
+
+	RankMedianHistogram histogram( ranks.size(), s.x * s.y );
+
+	auto updateRow = [&] ( int y, int x, bool add ) {
+		const uint32_t *r = &ranks[y * inputWidth + x];
+		for( int i = 0; i < s.x; ++i )
+		{
+			add ? histogram.add( r[i] ) : histogram.remove( r[i] );
+		}
+	};
+
+	auto updateColumn = [&] ( int x, int y, bool add ) {
+		const uint32_t *r = &ranks[y * inputWidth + x];
+		for( int i = 0; i < s.y; ++i )
+		{
+			add ? histogram.add( r[i * inputWidth] ) : histogram.remove( r[i * inputWidth] );
+		}
+	};
+
+	for( int y = 0; y < s.y; ++y )
+	{
+		updateRow( y, 0, true );
+	}
+
+	for( int x = 0; x < tileSize; ++x )
+	{
+		IECore::Canceller::check( canceller );
+
+		if( x )
+		{
+			const int y = x % 2 ? tileSize - 1 : 0;
+			updateColumn( x - 1, y, false );
+			updateColumn( x - 1 + s.x, y, true );
+		}
+
+		for( int i = 0; i < tileSize; ++i )
+		{
+			int y;
+			if( x % 2 )
+			{
+				y = tileSize - 1 - i;
+				if( i )
+				{
+					updateRow( y + s.y, x, false );
+					updateRow( y, x, true );
+				}
+			}
+			else
+			{
+				y = i;
+				if( i )
+				{
+					updateRow( y - 1, x, false );
+					updateRow( y - 1 + s.y, x, true );
+				}
+			}
+			result[y * tileSize + x] = sortedValues[ histogram.median() ];
+		}
+	}
+}
+
+// Radii at or above which we switch from the row buffers to the implementations
+// above. These were chosen by benchmarking, and are the points at which the new
+// implementations become faster.
+const int g_minRadiusSeparable = 2;
+const int g_minRadiusHistogram = 3;
+
 } // namespace
 
 void RankFilter::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
@@ -877,16 +1220,38 @@ IECore::ConstFloatVectorDataPtr RankFilter::computeChannelData( const std::strin
 
 	result.resize( ImagePlug::tileSize() * ImagePlug::tileSize() );
 
+	const int maxRadius = std::max( radius.x, radius.y );
 	switch( m_mode )
 	{
 		case MedianRank:
-			processTile<RankMedianBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			if( maxRadius >= g_minRadiusHistogram )
+			{
+				processTileMedianHistogram( sampler, radius, tileBound, result, context->canceller() );
+			}
+			else
+			{
+				processTile<RankMedianBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			}
 			break;
 		case ErodeRank:
-			processTile<RankMinBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			if( maxRadius >= g_minRadiusSeparable )
+			{
+				processTileSeparable<MinOperation>( sampler, radius, tileBound, result, context->canceller() );
+			}
+			else
+			{
+				processTile<RankMinBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			}
 			break;
 		case DilateRank:
-			processTile<RankMaxBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			if( maxRadius >= g_minRadiusSeparable )
+			{
+				processTileSeparable<MaxOperation>( sampler, radius, tileBound, result, context->canceller() );
+			}
+			else
+			{
+				processTile<RankMaxBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			}
 			break;
 	}
 
@@ -221,6 +221,18 @@ IECore::FloatVectorDataPtr whiteTile( bool copy )
 	return copy ? d->copy() : boost::const_pointer_cast<IECore::FloatVectorData>( d );
 }
 
+IECore::FloatVectorDataPtr uniformTile( float value, bool copy )
+{
+	IECore::ConstFloatVectorDataPtr d = ImagePlug::uniformTile( value );
+	return copy ? d->copy() : boost::const_pointer_cast<IECore::FloatVectorData>( d );
+}
+
+bool isUniformTile( const IECore::FloatVectorData *tile )
+{
+	float value;
+	return ImagePlug::isUniformTile( tile, value );
+}
+
 boost::python::list registeredFormats()
 {
 	std::vector<std::string> names;
@@ -312,7 +324,7 @@ class FormatPlugSerialiser : public GafferBindings::ValuePlugSerialiser
 void GafferImageModule::bindCore()
 {
 
-	PlugClass<ImagePlug>()
+	object imagePlugClass = PlugClass<ImagePlug>()
 		.def(
 			init< const std::string &, Gaffer::Plug::Direction, unsigned >
 			(
@@ -351,8 +363,22 @@ void GafferImageModule::bindCore()
 		.def( "emptyTile", &emptyTile, ( arg( "_copy" ) = true ) ).staticmethod( "emptyTile" )
 		.def( "blackTile", &blackTile, ( arg( "_copy" ) = true ) ).staticmethod( "blackTile" )
 		.def( "whiteTile", &whiteTile, ( arg( "_copy" ) = true ) ).staticmethod( "whiteTile" )
+		.def( "uniformTile", &uniformTile, ( arg( "value" ), arg( "_copy" ) = true ) ).staticmethod( "uniformTile" )
+		.def( "isUniformTile", &isUniformTile ).staticmethod( "isUniformTile" )
+		.def( "setCacheCompression", &ImagePlug::setCacheCompression ).staticmethod( "setCacheCompression" )
+		.def( "getCacheCompression", &ImagePlug::getCacheCompression ).staticmethod( "getCacheCompression" )
 	;
 
+	{
+		scope s = imagePlugClass;
+		enum_<ImagePlug::CacheCompression>( "CacheCompression" )
+			.value( "None", ImagePlug::CacheCompression::None )
+			.value( "None_", ImagePlug::CacheCompression::None )
+			.value( "Lossless", ImagePlug::CacheCompression::Lossless )
+			.value( "Half", ImagePlug::CacheCompression::Half )
+		;
+	}
+
 	using ImageNodeWrapper = ComputeNodeWrapper<ImageNode>;
 	GafferBindings::DependencyNodeClass<ImageNode, ImageNodeWrapper>();
 
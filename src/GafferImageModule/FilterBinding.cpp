@@ -52,7 +52,14 @@ using namespace GafferImage;
 
 void GafferImageModule::bindFilters()
 {
-	DependencyNodeClass<Blur>();
+	{
+		scope s = DependencyNodeClass<Blur>();
+		enum_<Blur::Method>( "Method" )
+			.value( "Convolution", Blur::Method::Convolution )
+			.value( "Recursive", Blur::Method::Recursive )
+		;
+	}
+
 	DependencyNodeClass<RankFilter>( nullptr, no_init );
 	DependencyNodeClass<Median>();
 	DependencyNodeClass<Dilate>();
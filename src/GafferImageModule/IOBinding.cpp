@@ -134,6 +134,10 @@ void GafferImageModule::bindIO()
 			.staticmethod( "setOpenFilesLimit" )
 			.def( "getOpenFilesLimit", &OpenImageIOReader::getOpenFilesLimit )
 			.staticmethod( "getOpenFilesLimit" )
+			.def( "setReadAheadMemoryLimit", &OpenImageIOReader::setReadAheadMemoryLimit )
+			.staticmethod( "setReadAheadMemoryLimit" )
+			.def( "getReadAheadMemoryLimit", &OpenImageIOReader::getReadAheadMemoryLimit )
+			.staticmethod( "getReadAheadMemoryLimit" )
 			.def( "supportedExtensions", &supportedExtensions<OpenImageIOReader> )
 			.staticmethod( "supportedExtensions" )
 		;
@@ -184,6 +188,10 @@ void GafferImageModule::bindIO()
 			.staticmethod( "setDefaultColorSpaceFunction" )
 			.def( "getDefaultColorSpaceFunction", &getDefaultColorSpaceFunction<ImageWriter> )
 			.staticmethod( "getDefaultColorSpaceFunction" )
+			.def( "setMemoryLimit", &ImageWriter::setMemoryLimit )
+			.staticmethod( "setMemoryLimit" )
+			.def( "getMemoryLimit", &ImageWriter::getMemoryLimit )
+			.staticmethod( "getMemoryLimit" )
 		;
 
 		enum_<ImageWriter::Mode>( "Mode" )
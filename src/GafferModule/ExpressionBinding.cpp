@@ -42,6 +42,7 @@
 #include "GafferBindings/SignalBinding.h"
 
 #include "Gaffer/Expression.h"
+#include "Gaffer/NativeExpressionEngine.h"
 #include "Gaffer/StringPlug.h"
 
 #include "IECorePython/ExceptionAlgo.h"
@@ -50,6 +51,8 @@
 
 #include "IECore/MessageHandler.h"
 
+#include <atomic>
+
 using namespace boost::python;
 using namespace GafferBindings;
 using namespace Gaffer;
@@ -63,6 +66,12 @@ void setExpression( Expression &e, const std::string &expression, const std::str
 	e.setExpression( expression, language );
 }
 
+bool convertPythonExpression( Expression &e )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return NativeExpressionEngine::convertPythonExpression( &e );
+}
+
 tuple getExpression( Expression &e )
 {
 	std::string language;
@@ -133,6 +142,18 @@ ValuePlug::CachePolicy defaultExecuteCachePolicy()
 	return ValuePlug::CachePolicy::TaskCollaboration;
 }
 
+bool defaultNativeExecution()
+{
+	// Python expressions that can be converted to the native expression language
+	// are executed natively, so that they don't serialise on the GIL. This may be
+	// turned off as a workaround should the two languages ever disagree.
+	if( const char *e = getenv( "GAFFER_PYTHONEXPRESSION_NATIVE" ) )
+	{
+		return strcmp( e, "0" );
+	}
+	return true;
+}
+
 
 class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 {
@@ -145,6 +166,11 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 
 		void parse( Expression *node, const std::string &expression, std::vector<ValuePlug *> &inputs, std::vector<ValuePlug *> &outputs, std::vector<IECore::InternedString> &contextVariables ) override
 		{
+			m_nativeExpression.clear();
+			m_nativeEngine = nullptr;
+			m_nativeFailed = false;
+
+			bool parsed = false;
 			if( isSubclassed() )
 			{
 				IECorePython::ScopedGILLock gilLock;
@@ -159,7 +185,7 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 						container_utils::extend_container( inputs, pythonInputs );
 						container_utils::extend_container( outputs, pythonOutputs );
 						container_utils::extend_container( contextVariables, pythonContextVariables );
-						return;
+						parsed = true;
 					}
 				}
 				catch( const error_already_set & )
@@ -168,11 +194,38 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 				}
 			}
 
-			throw IECore::Exception( "Engine::parse() python method not defined" );
+			if( !parsed )
+			{
+				throw IECore::Exception( "Engine::parse() python method not defined" );
+			}
+
+			if( !m_nativeExpression.empty() && g_nativeExecution && supportsContextVariables( contextVariables ) )
+			{
+				m_nativeEngine = nativeEngine( node, inputs, outputs );
+			}
 		}
 
 		IECore::ConstObjectVectorPtr execute( const Context *context, const std::vector<const ValuePlug *> &proxyInputs ) const override
 		{
+			if( useNativeEngine() )
+			{
+				// The native engine throws rather than produce a result that
+				// differs from Python's, for instance when reading a context
+				// variable of a type it doesn't support, or when an int is too
+				// large to be represented exactly. In that case we fall back to
+				// Python, and continue to use Python for all future evaluations,
+				// so that the cost of the failure is only paid once. This also
+				// means that genuine errors are reported in Python's terms.
+				try
+				{
+					return m_nativeEngine->execute( context, proxyInputs );
+				}
+				catch( const std::exception & )
+				{
+					m_nativeFailed = true;
+				}
+			}
+
 			if( isSubclassed() )
 			{
 				IECorePython::ScopedGILLock gilLock;
@@ -202,11 +255,23 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 
 		ValuePlug::CachePolicy executeCachePolicy() const override
 		{
+			if( useNativeEngine() )
+			{
+				return m_nativeEngine->executeCachePolicy();
+			}
 			return g_cachePolicy;
 		}
 
 		void apply( ValuePlug *proxyOutput, const ValuePlug *topLevelProxyOutput, const IECore::Object *value ) const override
 		{
+			// Python can apply values produced by either engine, so once we
+			// have fallen back to Python, we use it for everything.
+			if( useNativeEngine() )
+			{
+				m_nativeEngine->apply( proxyOutput, topLevelProxyOutput, value );
+				return;
+			}
+
 			if( isSubclassed() )
 			{
 				IECorePython::ScopedGILLock gilLock;
@@ -325,11 +390,78 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 			return boost::python::tuple( l );
 		}
 
+		static void setNativeExpression( EngineWrapper &engine, const std::string &nativeExpression )
+		{
+			engine.m_nativeExpression = nativeExpression;
+		}
+
 		static ValuePlug::CachePolicy g_cachePolicy;
+		static bool g_nativeExecution;
+
+	private :
+
+		bool useNativeEngine() const
+		{
+			return m_nativeEngine && !m_nativeFailed;
+		}
+
+		// Returns false if any of `contextVariables` are known to have types
+		// which the native language doesn't support. There's no point trying
+		// to execute such expressions natively, since they would always fall
+		// back to Python. We can't know the types of arbitrary user variables
+		// until execution, so those are dealt with in `execute()`.
+		static bool supportsContextVariables( const std::vector<IECore::InternedString> &contextVariables )
+		{
+			static const IECore::InternedString g_scenePath( "scene:path" );
+			static const IECore::InternedString g_setName( "scene:setName" );
+			for( const auto &name : contextVariables )
+			{
+				if( name == g_scenePath || name == g_setName )
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		// Parses `m_nativeExpression` with the native engine, returning it only if
+		// it reads and writes exactly the same plugs as the Python expression, so
+		// that it is a drop-in replacement for `execute()` and `apply()`.
+		Expression::EnginePtr nativeEngine( Expression *node, const std::vector<ValuePlug *> &inputs, const std::vector<ValuePlug *> &outputs ) const
+		{
+			Expression::EnginePtr result = Expression::Engine::create( "native" );
+			std::vector<ValuePlug *> nativeInputs, nativeOutputs;
+			std::vector<IECore::InternedString> nativeContextVariables;
+			try
+			{
+				result->parse( node, m_nativeExpression, nativeInputs, nativeOutputs, nativeContextVariables );
+			}
+			catch( const std::exception & )
+			{
+				return nullptr;
+			}
+
+			if( nativeInputs != inputs || nativeOutputs != outputs )
+			{
+				return nullptr;
+			}
+
+			return result;
+		}
+
+		// Set by the Python `parse()` implementation via `_setNativeExpression()`,
+		// when the expression can be converted to the native language.
+		std::string m_nativeExpression;
+		Expression::EnginePtr m_nativeEngine;
+		// Set when native execution has failed, so that we
+		// don't attempt it again.
+		mutable std::atomic_bool m_nativeFailed{ false };
+
 };
 
 
 ValuePlug::CachePolicy EngineWrapper::g_cachePolicy( defaultExecuteCachePolicy() );
+bool EngineWrapper::g_nativeExecution( defaultNativeExecution() );
 
 tuple languages()
 {
@@ -351,7 +483,7 @@ class ExpressionSerialiser : public NodeSerialiser
 		const Expression *e = static_cast<const Expression *>( graphComponent );
 		std::string language;
 		e->getExpression( language );
-		if( !language.empty() && language != "python" )
+		if( !language.empty() && language != "python" && language != "native" )
 		{
 			/// \todo Consider a virtual method on the Engine
 			/// to provide this information.
@@ -394,6 +526,15 @@ class ExpressionSerialiser : public NodeSerialiser
 void GafferModule::bindExpression()
 {
 
+	{
+		object module( borrowed( PyImport_AddModule( "Gaffer.NativeExpressionEngine" ) ) );
+		scope().attr( "NativeExpressionEngine" ) = module;
+		scope moduleScope( module );
+
+		def( "convertPythonExpression", (std::string (*)( const std::string & ))&NativeExpressionEngine::convertPythonExpression );
+		def( "convertPythonExpression", &convertPythonExpression );
+	}
+
 	scope s = DependencyNodeClass<Expression>()
 		.def( "languages", &languages ).staticmethod( "languages" )
 		.def( "defaultExpression", &Expression::defaultExpression ).staticmethod( "defaultExpression" )
@@ -407,6 +548,7 @@ void GafferModule::bindExpression()
 		.def( init<>() )
 		.def( "registerEngine", &EngineWrapper::registerEngine ).staticmethod( "registerEngine" )
 		.def( "registeredEngines", &EngineWrapper::registeredEngines ).staticmethod( "registeredEngines" )
+		.def( "_setNativeExpression", &EngineWrapper::setNativeExpression )
 	;
 
 	SignalClass<Expression::ExpressionChangedSignal, DefaultSignalCaller<Expression::ExpressionChangedSignal>, ExpressionChangedSlotCaller >( "ExpressionChangedSignal" );
@@ -82,6 +82,7 @@
 #include "NameValuePlugBinding.h"
 #include "ShufflesBinding.h"
 #include "MessagesBinding.h"
+#include "MemoryPressureBinding.h"
 #include "TweakPlugBinding.h"
 
 #include "GafferBindings/DependencyNodeBinding.h"
@@ -184,6 +185,7 @@ BOOST_PYTHON_MODULE( _Gaffer )
 	bindTweakPlugs();
 	bindOptionalValuePlug();
 	bindCollect();
+	bindMemoryPressure();
 
 	NodeClass<Backdrop>();
 	DependencyNodeClass<PatternMatch>();
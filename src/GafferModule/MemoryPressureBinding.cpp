@@ -0,0 +1,79 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "boost/python.hpp"
+
+#include "MemoryPressureBinding.h"
+
+#include "Gaffer/MemoryPressure.h"
+
+#include "IECorePython/ScopedGILRelease.h"
+
+using namespace Gaffer;
+using namespace boost::python;
+
+namespace
+{
+
+void setEnabled( bool enabled )
+{
+	// Handlers may evict items from caches.
+	IECorePython::ScopedGILRelease gilRelease;
+	MemoryPressure::setEnabled( enabled );
+}
+
+void update( bool force )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	MemoryPressure::update( force );
+}
+
+} // namespace
+
+void GafferModule::bindMemoryPressure()
+{
+	object module( borrowed( PyImport_AddModule( "Gaffer.MemoryPressure" ) ) );
+	scope().attr( "MemoryPressure" ) = module;
+	scope moduleScope( module );
+
+	def( "memoryLimit", &MemoryPressure::memoryLimit );
+	def( "memoryUsage", &MemoryPressure::memoryUsage );
+	def( "setEnabled", &setEnabled );
+	def( "getEnabled", &MemoryPressure::getEnabled );
+	def( "setTargetFraction", &MemoryPressure::setTargetFraction );
+	def( "getTargetFraction", &MemoryPressure::getTargetFraction );
+	def( "update", &update, ( arg( "force" ) = false ) );
+}
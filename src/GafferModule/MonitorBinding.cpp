@@ -38,6 +38,7 @@
 
 #include "MonitorBinding.h"
 
+#include "Gaffer/CacheMonitor.h"
 #include "Gaffer/ContextMonitor.h"
 #include "Gaffer/Monitor.h"
 #include "Gaffer/MonitorAlgo.h"
@@ -199,6 +200,24 @@ dict threadMonitorCombinedStatisticsWrapper( const ThreadMonitor &monitor )
 	return processesPerThreadToPython( monitor.combinedStatistics() );
 }
 
+std::string cacheMonitorStatisticsRepr( CacheMonitor::Statistics &s )
+{
+	return fmt::format(
+		"Gaffer.CacheMonitor.Statistics( hashHits = {}, hashMisses = {}, hashWaits = {}, computeHits = {}, computeMisses = {}, computeWaits = {} )",
+			s.hashHits, s.hashMisses, s.hashWaits, s.computeHits, s.computeMisses, s.computeWaits
+	);
+}
+
+dict cacheMonitorAllStatisticsWrapper( const CacheMonitor &monitor )
+{
+	dict result;
+	for( const auto &[nodeTypeName, statistics] : monitor.allStatistics() )
+	{
+		result[nodeTypeName] = statistics;
+	}
+	return result;
+}
+
 } // namespace
 
 void GafferModule::bindMonitor()
@@ -315,6 +334,42 @@ void GafferModule::bindMonitor()
 		;
 	}
 
+	{
+		scope s = IECorePython::RefCountedClass<CacheMonitor, Monitor>( "CacheMonitor" )
+			.def( init<>() )
+			.def( "allStatistics", &cacheMonitorAllStatisticsWrapper )
+			.def( "nodeTypeStatistics", &CacheMonitor::nodeTypeStatistics, return_value_policy<copy_const_reference>() )
+			.def( "combinedStatistics", &CacheMonitor::combinedStatistics, return_value_policy<copy_const_reference>() )
+			.def( "computeCacheEvictions", &CacheMonitor::computeCacheEvictions )
+			.def( "computeCacheEvictedMemory", &CacheMonitor::computeCacheEvictedMemory )
+			.def( "hashCacheEvictions", &CacheMonitor::hashCacheEvictions )
+		;
+
+		class_<CacheMonitor::Statistics>( "Statistics" )
+			.def(
+				init<size_t, size_t, size_t, size_t, size_t, size_t>(
+					(
+						arg( "hashHits" ) = 0,
+						arg( "hashMisses" ) = 0,
+						arg( "hashWaits" ) = 0,
+						arg( "computeHits" ) = 0,
+						arg( "computeMisses" ) = 0,
+						arg( "computeWaits" ) = 0
+					)
+				)
+			)
+			.def_readwrite( "hashHits", &CacheMonitor::Statistics::hashHits )
+			.def_readwrite( "hashMisses", &CacheMonitor::Statistics::hashMisses )
+			.def_readwrite( "hashWaits", &CacheMonitor::Statistics::hashWaits )
+			.def_readwrite( "computeHits", &CacheMonitor::Statistics::computeHits )
+			.def_readwrite( "computeMisses", &CacheMonitor::Statistics::computeMisses )
+			.def_readwrite( "computeWaits", &CacheMonitor::Statistics::computeWaits )
+			.def( self == self )
+			.def( self != self )
+			.def( "__repr__", &cacheMonitorStatisticsRepr )
+		;
+	}
+
 	{
 		scope s = IECorePython::RefCountedClass<ThreadMonitor, Monitor>( "ThreadMonitor" )
 			.def(
@@ -131,14 +131,38 @@ void GafferModule::bindValuePlug()
 		.staticmethod( "setCacheMemoryLimit" )
 		.def( "cacheMemoryUsage", &ValuePlug::cacheMemoryUsage )
 		.staticmethod( "cacheMemoryUsage" )
+		.def( "cacheEvictions", &ValuePlug::cacheEvictions )
+		.staticmethod( "cacheEvictions" )
+		.def( "cacheEvictedMemory", &ValuePlug::cacheEvictedMemory )
+		.staticmethod( "cacheEvictedMemory" )
 		.def( "clearCache", &ValuePlug::clearCache )
 		.staticmethod( "clearCache" )
+		.def( "setCacheEvictionPolicy", &ValuePlug::setCacheEvictionPolicy )
+		.staticmethod( "setCacheEvictionPolicy" )
+		.def( "getCacheEvictionPolicy", &ValuePlug::getCacheEvictionPolicy )
+		.staticmethod( "getCacheEvictionPolicy" )
+		.def( "setCacheDirectory", &ValuePlug::setCacheDirectory )
+		.staticmethod( "setCacheDirectory" )
+		.def( "getCacheDirectory", &ValuePlug::getCacheDirectory )
+		.staticmethod( "getCacheDirectory" )
+		.def( "getCacheDirectorySizeLimit", &ValuePlug::getCacheDirectorySizeLimit )
+		.staticmethod( "getCacheDirectorySizeLimit" )
+		.def( "setSharedCache", &ValuePlug::setSharedCache )
+		.staticmethod( "setSharedCache" )
+		.def( "getSharedCacheName", &ValuePlug::getSharedCacheName )
+		.staticmethod( "getSharedCacheName" )
+		.def( "getSharedCacheMemoryLimit", &ValuePlug::getSharedCacheMemoryLimit )
+		.staticmethod( "getSharedCacheMemoryLimit" )
+		.def( "removeSharedCache", &ValuePlug::removeSharedCache )
+		.staticmethod( "removeSharedCache" )
 		.def( "getHashCacheSizeLimit", &ValuePlug::getHashCacheSizeLimit )
 		.staticmethod( "getHashCacheSizeLimit" )
 		.def( "setHashCacheSizeLimit", &ValuePlug::setHashCacheSizeLimit )
 		.staticmethod( "setHashCacheSizeLimit" )
 		.def( "hashCacheTotalUsage", &ValuePlug::hashCacheTotalUsage )
 		.staticmethod( "hashCacheTotalUsage" )
+		.def( "hashCacheTotalEvictions", &ValuePlug::hashCacheTotalEvictions )
+		.staticmethod( "hashCacheTotalEvictions" )
 		.def( "clearHashCache", &ValuePlug::clearHashCache, arg( "now" ) = false )
 		.staticmethod( "clearHashCache" )
 		.def( "getHashCacheMode", &ValuePlug::getHashCacheMode )
@@ -155,6 +179,11 @@ void GafferModule::bindValuePlug()
 		.value( "Legacy", ValuePlug::HashCacheMode::Legacy )
 	;
 
+	enum_<ValuePlug::CacheEvictionPolicy>( "CacheEvictionPolicy" )
+		.value( "LRU", ValuePlug::CacheEvictionPolicy::LRU )
+		.value( "CostAware", ValuePlug::CacheEvictionPolicy::CostAware )
+	;
+
 	enum_<ValuePlug::CachePolicy>( "CachePolicy" )
 		.value( "Uncached", ValuePlug::CachePolicy::Uncached )
 		.value( "TaskCollaboration", ValuePlug::CachePolicy::TaskCollaboration )
@@ -1117,10 +1117,10 @@ Gaffer::ValuePlug::CachePolicy BranchCreator::hashCachePolicy( const Gaffer::Val
 {
 	if( output == outPlug()->setPlug() )
 	{
-		// Technically we do not _need_ TaskCollaboration because we have not yet
-		// multithreaded `hashSet()`. But we still benefit from requesting it
-		// because it means the hash is stored in the global cache, where it is
-		// shared between all threads and is almost guaranteed not to be evicted.
+		// `hashBranchSet()` implementations may hash their inputs in
+		// parallel. We also benefit from TaskCollaboration because it means
+		// the hash is stored in the global cache, where it is shared between
+		// all threads and is almost guaranteed not to be evicted.
 		return ValuePlug::CachePolicy::TaskCollaboration;
 	}
 	else if( output == branchesPlug() )
@@ -1136,6 +1136,11 @@ Gaffer::ValuePlug::CachePolicy BranchCreator::computeCachePolicy( const Gaffer::
 	{
 		return ValuePlug::CachePolicy::TaskCollaboration;
 	}
+	else if( output == outPlug()->setPlug() )
+	{
+		// Branch sets may be computed and merged in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
 	return FilteredSceneProcessor::computeCachePolicy( output );
 }
 
@@ -36,6 +36,8 @@
 
 #include "GafferScene/Private/ChildNamesMap.h"
 
+#include "GafferScene/Private/PathMatcherAlgo.h"
+
 #include "IECore/StringAlgo.h"
 
 #include "boost/lexical_cast.hpp"
@@ -43,6 +45,9 @@
 
 #include "fmt/format.h"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_reduce.h"
+
 #include <unordered_set>
 
 using namespace std;
@@ -64,6 +69,15 @@ size_t hash_value( const IECore::InternedString &v )
 
 } // namespace IECore
 
+namespace
+{
+
+// Below this number of input sets, `ChildNamesMap::set()` doesn't
+// bother with a parallel reduction.
+const size_t g_minParallelSets = 4;
+
+} // namespace
+
 namespace GafferScene
 {
 
@@ -138,50 +152,83 @@ const ChildNamesMap::Input &ChildNamesMap::input( IECore::InternedString outputN
 
 IECore::PathMatcher ChildNamesMap::set( const std::vector<IECore::ConstPathMatcherDataPtr> &inputSets ) const
 {
-	IECore::PathMatcher result;
-	size_t inputIndex = 0;
-	for( const auto &inputSetData : inputSets )
-	{
-		if( inputSetData )
+	// Renames the root children of a single input set, referencing the
+	// subtrees of the input rather than doing an expensive copy.
+	auto renamedSet = [this] ( const PathMatcher &inputSet, size_t inputIndex, PathMatcher &result ) {
+
+		for( PathMatcher::RawIterator pIt = inputSet.begin(), peIt = inputSet.end(); pIt != peIt; ++pIt )
 		{
-			const PathMatcher &inputSet = inputSetData->readable();
-			// We want our outputSet to reference the data within inputSet rather
-			// than do an expensive copy. But we may need to rename the children of
-			// the root location according to m_map. Here we do that by taking subtrees
-			// of the input and adding them to our output under a renamed prefix.
-			for( PathMatcher::RawIterator pIt = inputSet.begin(), peIt = inputSet.end(); pIt != peIt; ++pIt )
+			const vector<InternedString> &inputPath = *pIt;
+			if( !inputPath.size() )
 			{
-				const vector<InternedString> &inputPath = *pIt;
-				if( !inputPath.size() )
-				{
-					// Skip root.
-					continue;
-				}
-				assert( inputPath.size() == 1 );
+				// Skip root.
+				continue;
+			}
+			assert( inputPath.size() == 1 );
 
-				const auto &inputMap = m_map.get<1>();
-				auto it = inputMap.find( Input{ inputPath[0], inputIndex } );
-				if( it != inputMap.end() )
-				{
-					result.addPaths( inputSet.subTree( inputPath ), { it->output } );
-				}
-				else
-				{
-					// The set contains an invalid path that is not present in
-					// the scene (as defined by the `inputChildNames` passed to our
-					// constructor). We could throw an error, but since it's currently
-					// relatively easy for a user to make an invalid set via
-					// `Set::pathsPlug()`, we do the more helpful thing and just omit
-					// the invalid path from the output set.
-				}
+			const auto &inputMap = m_map.get<1>();
+			auto it = inputMap.find( Input{ inputPath[0], inputIndex } );
+			if( it != inputMap.end() )
+			{
+				result.addPaths( inputSet.subTree( inputPath ), { it->output } );
+			}
+			else
+			{
+				// The set contains an invalid path that is not present in
+				// the scene (as defined by the `inputChildNames` passed to our
+				// constructor). We could throw an error, but since it's currently
+				// relatively easy for a user to make an invalid set via
+				// `Set::pathsPlug()`, we do the more helpful thing and just omit
+				// the invalid path from the output set.
+			}
+
+			pIt.prune(); // We only want to visit the first level
+		}
+	};
 
-				pIt.prune(); // We only want to visit the first level
+	// With only a few sets the overhead of spawning tasks outweighs
+	// any benefit, so we simply combine them in series.
+	if( inputSets.size() <= g_minParallelSets )
+	{
+		PathMatcher result;
+		for( size_t i = 0; i < inputSets.size(); ++i )
+		{
+			if( inputSets[i] && !inputSets[i]->readable().isEmpty() )
+			{
+				renamedSet( inputSets[i]->readable(), i, result );
 			}
 		}
-		inputIndex++;
+		return result;
 	}
 
-	return result;
+	// Otherwise renamed sets are combined using a tree reduction, so that
+	// inputs with many sets don't serialise on a single growing PathMatcher.
+	using SizeRange = tbb::blocked_range<size_t>;
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+	return tbb::parallel_reduce(
+		SizeRange( 0, inputSets.size() ),
+		PathMatcher(),
+		[&] ( const SizeRange &range, const PathMatcher &x ) {
+
+			PathMatcher result = x;
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				if( inputSets[i] && !inputSets[i]->readable().isEmpty() )
+				{
+					renamedSet( inputSets[i]->readable(), i, result );
+				}
+			}
+			return result;
+
+		},
+		[] ( const PathMatcher &x, const PathMatcher &y ) {
+
+			return PathMatcherAlgo::unite( x, y );
+
+		},
+		taskGroupContext
+	);
 }
 
 } // namespace Private
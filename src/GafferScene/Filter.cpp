@@ -168,6 +168,11 @@ unsigned Filter::computeMatch( const ScenePlug *scene, const Gaffer::Context *co
 	return IECore::PathMatcher::NoMatch;
 }
 
+IECore::ConstPathMatcherDataPtr Filter::pathMatcher( const ScenePlug *scene, const Gaffer::Context *context ) const
+{
+	return nullptr;
+}
+
 bool Filter::enabled( const Gaffer::Context *context ) const
 {
 	const BoolPlug *plug = enabledPlug();
@@ -161,6 +161,34 @@ unsigned FilterPlug::match( const ScenePlug *scene ) const
 	return getValue();
 }
 
+IECore::ConstPathMatcherDataPtr FilterPlug::pathMatcher( const ScenePlug *scene ) const
+{
+	const Plug *source = this->source();
+	const Filter *filter = runTimeCast<const Filter>( source->node() );
+	if( !filter || source != filter->outPlug() )
+	{
+		// No input, or an input we can't evaluate without a
+		// location (a Switch or ContextProcessor for instance).
+		return nullptr;
+	}
+
+	if( filter->enabledPlug()->getInput() )
+	{
+		// The enabled state may be computed, so we leave it to
+		// `match()` to evaluate it at each location.
+		return nullptr;
+	}
+
+	FilterPlug::SceneScope scope( Context::current(), scene );
+	if( !filter->enabled( scope.context() ) )
+	{
+		static IECore::ConstPathMatcherDataPtr g_emptyPathMatcher = new IECore::PathMatcherData;
+		return g_emptyPathMatcher;
+	}
+
+	return filter->pathMatcher( scene, scope.context() );
+}
+
 FilterPlug::SceneScope::SceneScope( const Gaffer::Context *context, const ScenePlug *scenePlug )
 	:	EditableScope( context )
 {
@@ -49,6 +49,9 @@
 
 #include "Imath/ImathBoxAlgo.h"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
 using namespace std;
 using namespace Imath;
 using namespace IECore;
@@ -453,9 +456,26 @@ IECore::ConstInternedStringVectorDataPtr Group::computeSetNames( const Gaffer::C
 void Group::hashSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
 {
 	SceneProcessor::hashSet( setName, context, parent, h );
-	for( const auto &p : ScenePlug::Range( *inPlugs() ) )
+
+	const ThreadState &threadState = ThreadState::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+	vector<IECore::MurmurHash> inputHashes( inPlugs()->children().size() );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, inputHashes.size() ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			ThreadState::Scope threadStateScope( threadState );
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				inputHashes[i] = inPlugs()->getChild<ScenePlug>( i )->setPlug()->hash();
+			}
+		},
+		taskGroupContext
+	);
+
+	for( const auto &inputHash : inputHashes )
 	{
-		p->setPlug()->hash( h );
+		h.append( inputHash );
 	}
 
 	ScenePlug::GlobalScope s( context );
@@ -467,11 +487,21 @@ void Group::hashSet( const IECore::InternedString &setName, const Gaffer::Contex
 
 IECore::ConstPathMatcherDataPtr Group::computeSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	vector<ConstPathMatcherDataPtr> inputSets; inputSets.reserve( inPlugs()->children().size() );
-	for( const auto &p : ScenePlug::Range( *inPlugs() ) )
-	{
-		inputSets.push_back( p->setPlug()->getValue() );
-	}
+	const ThreadState &threadState = ThreadState::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+	vector<ConstPathMatcherDataPtr> inputSets( inPlugs()->children().size() );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, inputSets.size() ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			ThreadState::Scope threadStateScope( threadState );
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				inputSets[i] = inPlugs()->getChild<ScenePlug>( i )->setPlug()->getValue();
+			}
+		},
+		taskGroupContext
+	);
 
 	ScenePlug::GlobalScope s( context );
 	Private::ConstChildNamesMapPtr mapping = boost::static_pointer_cast<const Private::ChildNamesMap>( mappingPlug()->getValue() );
@@ -491,6 +521,26 @@ IECore::ConstPathMatcherDataPtr Group::computeSet( const IECore::InternedString
 	return resultData;
 }
 
+Gaffer::ValuePlug::CachePolicy Group::hashCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == outPlug()->setPlug() )
+	{
+		// Input sets are hashed in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return SceneProcessor::hashCachePolicy( output );
+}
+
+Gaffer::ValuePlug::CachePolicy Group::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == outPlug()->setPlug() )
+	{
+		// Input sets are computed and merged in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return SceneProcessor::computeCachePolicy( output );
+}
+
 SceneNode::ScenePath Group::sourcePath( const ScenePath &outputPath, const ScenePlug **source ) const
 {
 	ScenePlug::GlobalScope s( Context::current() );
@@ -36,12 +36,17 @@
 
 #include "GafferScene/MergeScenes.h"
 
+#include "GafferScene/Private/PathMatcherAlgo.h"
 #include "GafferScene/SceneAlgo.h"
 
 #include "Gaffer/ArrayPlug.h"
 
 #include "IECore/NullObject.h"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_reduce.h"
+
 #include "unordered_set"
 
 using namespace std;
@@ -864,56 +869,116 @@ void MergeScenes::hashSet( const IECore::InternedString &setName, const Gaffer::
 {
 	/// \todo It might be a good idea to implement a pass-through for
 	/// the cases where the set only exists in one of the inputs.
+	vector<const ScenePlug *> inputs;
 	visit(
 		connectedInputs(),
 		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
-			switch( type )
-			{
-				case InputType::Sole :
-					// Pass hash through unchanged.
-					h = scene->setPlug()->hash();
-					break;
-				case InputType::First :
-					// Initialise hash and fall through.
-					SceneProcessor::hashSet( setName, context, parent, h );
-					[[fallthrough]];
-				case InputType::Other :
-					// Merge input hash.
-					scene->setPlug()->hash( h );
-			}
+			inputs.push_back( scene );
 			return true;
 		}
 	);
+
+	if( inputs.size() == 1 )
+	{
+		// Pass hash through unchanged.
+		h = inputs[0]->setPlug()->hash();
+		return;
+	}
+
+	// Hash inputs in parallel, but merge the hashes in order
+	// so that the result is deterministic.
+
+	const ThreadState &threadState = ThreadState::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+	vector<IECore::MurmurHash> inputHashes( inputs.size() );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, inputs.size() ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			ThreadState::Scope threadStateScope( threadState );
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				inputHashes[i] = inputs[i]->setPlug()->hash();
+			}
+		},
+		taskGroupContext
+	);
+
+	SceneProcessor::hashSet( setName, context, parent, h );
+	for( const auto &inputHash : inputHashes )
+	{
+		h.append( inputHash );
+	}
 }
 
 IECore::ConstPathMatcherDataPtr MergeScenes::computeSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	ConstPathMatcherDataPtr result;
-	PathMatcherDataPtr merged;
+	vector<const ScenePlug *> inputs;
 	visit(
 		connectedInputs(),
 		[&] ( InputType type, size_t index, const ScenePlug *scene ) {
-			switch( type )
-			{
-				case InputType::Sole :
-					// Pass input through unchanged.
-					result = scene->setPlug()->getValue();
-					break;
-				case InputType::First :
-					// Initialise merged result and
-					// fall through.
-					merged = new PathMatcherData();
-					result = merged;
-					[[fallthrough]];
-				case InputType::Other :
-					ConstPathMatcherDataPtr paths = scene->setPlug()->getValue();
-					merged->writable().addPaths( paths->readable() );
-			}
+			inputs.push_back( scene );
 			return true;
 		}
 	);
 
-	return result;
+	if( inputs.size() == 1 )
+	{
+		// Pass input through unchanged.
+		return inputs[0]->setPlug()->getValue();
+	}
+
+	// Fetch and merge the input sets in parallel, combining
+	// them with a tree reduction.
+
+	const ThreadState &threadState = ThreadState::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	using SizeRange = tbb::blocked_range<size_t>;
+
+	PathMatcher merged = tbb::parallel_reduce(
+		SizeRange( 0, inputs.size() ),
+		PathMatcher(),
+		[&] ( const SizeRange &range, const PathMatcher &x ) {
+
+			ThreadState::Scope threadStateScope( threadState );
+			PathMatcher result = x;
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				ConstPathMatcherDataPtr paths = inputs[i]->setPlug()->getValue();
+				result = Private::PathMatcherAlgo::unite( result, paths->readable() );
+			}
+			return result;
+
+		},
+		[] ( const PathMatcher &x, const PathMatcher &y ) {
+
+			return Private::PathMatcherAlgo::unite( x, y );
+
+		},
+		taskGroupContext
+	);
+
+	return new PathMatcherData( merged );
+}
+
+Gaffer::ValuePlug::CachePolicy MergeScenes::hashCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == outPlug()->setPlug() )
+	{
+		// Input sets are hashed in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return SceneProcessor::hashCachePolicy( output );
+}
+
+Gaffer::ValuePlug::CachePolicy MergeScenes::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == outPlug()->setPlug() )
+	{
+		// Input sets are computed and merged in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return SceneProcessor::computeCachePolicy( output );
 }
 
 MergeScenes::VisitOrder MergeScenes::visitOrder( Mode mode, VisitOrder replaceOrder ) const
@@ -145,6 +145,18 @@ Gaffer::ValuePlug::CachePolicy ObjectProcessor::computeCachePolicy( const Gaffer
 	}
 }
 
+bool ObjectProcessor::computeCacheShareable( const Gaffer::ValuePlug *output ) const
+{
+	if( output == processedObjectPlug() )
+	{
+		return true;
+	}
+	else
+	{
+		return FilteredSceneProcessor::computeCacheShareable( output );
+	}
+}
+
 bool ObjectProcessor::affectsProcessedObject( const Gaffer::Plug *input ) const
 {
 	return input == filterPlug() || input == inPlug()->objectPlug();
@@ -42,6 +42,9 @@
 
 #include "IECore/NullObject.h"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
 using namespace std;
 using namespace Imath;
 using namespace IECore;
@@ -416,9 +419,25 @@ void Parent::hashBranchSet( const ScenePath &sourcePath, const IECore::InternedS
 	ParentScope s( this, sourcePath, context );
 	s.set( ScenePlug::setNameContextName, &setName );
 
-	for( auto &p : ScenePlug::Range( *childrenPlug() ) )
+	const ThreadState &threadState = ThreadState::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+	vector<MurmurHash> inputHashes( childrenPlug()->children().size() );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, inputHashes.size() ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			ThreadState::Scope threadStateScope( threadState );
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				inputHashes[i] = childrenPlug()->getChild<ScenePlug>( i )->setPlug()->hash();
+			}
+		},
+		taskGroupContext
+	);
+
+	for( const auto &inputHash : inputHashes )
 	{
-		p->setPlug()->hash( h );
+		h.append( inputHash );
 	}
 
 	s.remove( ScenePlug::setNameContextName );
@@ -430,11 +449,21 @@ IECore::ConstPathMatcherDataPtr Parent::computeBranchSet( const ScenePath &sourc
 	ParentScope s( this, sourcePath, context );
 	s.set( ScenePlug::setNameContextName, &setName );
 
-	vector<ConstPathMatcherDataPtr> inputSets; inputSets.reserve( childrenPlug()->children().size() );
-	for( auto &p : ScenePlug::Range( *childrenPlug() ) )
-	{
-		inputSets.push_back( p->setPlug()->getValue() );
-	}
+	const ThreadState &threadState = ThreadState::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+	vector<ConstPathMatcherDataPtr> inputSets( childrenPlug()->children().size() );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, inputSets.size() ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			ThreadState::Scope threadStateScope( threadState );
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				inputSets[i] = childrenPlug()->getChild<ScenePlug>( i )->setPlug()->getValue();
+			}
+		},
+		taskGroupContext
+	);
 
 	s.remove( ScenePlug::setNameContextName );
 	Private::ConstChildNamesMapPtr mapping = boost::static_pointer_cast<const Private::ChildNamesMap>( mappingPlug()->getValue() );
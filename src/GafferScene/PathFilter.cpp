@@ -287,6 +287,24 @@ unsigned PathFilter::computeMatch( const ScenePlug *scene, const Gaffer::Context
 	return result;
 }
 
+IECore::ConstPathMatcherDataPtr PathFilter::pathMatcher( const ScenePlug *scene, const Gaffer::Context *context ) const
+{
+	if( rootsPlug()->getInput() )
+	{
+		// Matches are relative to roots which must be
+		// evaluated per location.
+		return nullptr;
+	}
+
+	if( m_pathMatcher )
+	{
+		return m_pathMatcher;
+	}
+
+	ScenePlug::GlobalScope globalScope( context );
+	return pathMatcherPlug()->getValue();
+}
+
 void PathFilter::hashRootSizes( const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	const ScenePlug::ScenePath &path = context->get<ScenePlug::ScenePath>( ScenePlug::scenePathContextName );
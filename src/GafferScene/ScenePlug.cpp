@@ -343,6 +343,11 @@ void ScenePlug::PathScope::setPath( const ScenePath *scenePath )
 	set( scenePathContextName, scenePath );
 }
 
+void ScenePlug::PathScope::setChildPath( const ScenePath *scenePath )
+{
+	EditableScope::setChildPath( scenePathContextName, scenePath );
+}
+
 ScenePlug::SetScope::SetScope( const Gaffer::Context *context )
 	:	EditableScope( context )
 {
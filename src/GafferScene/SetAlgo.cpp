@@ -40,6 +40,8 @@
 
 #include "GafferScene/SetAlgo.h"
 
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
 #include "IECore/MessageHandler.h"
 
 #include "boost/algorithm/string/predicate.hpp"
@@ -53,6 +55,8 @@
 
 #include "fmt/format.h"
 
+#include <memory>
+
 using namespace IECore;
 using namespace Gaffer;
 using namespace GafferScene;
@@ -170,192 +174,6 @@ std::ostream& operator<<( std::ostream& stream, const ExpressionAst& expr )
 }
 #endif
 
-// Evaluating the AST
-// ------------------
-struct AstEvaluator
-{
-	using result_type = PathMatcher;
-
-	AstEvaluator( const ScenePlug *scene )
-		: m_scene( scene )
-	{
-	}
-
-	result_type operator()( const std::string &identifier ) const
-	{
-		if( identifier[0] == '/' )
-		{
-			// Object name
-			PathMatcher result;
-			if( StringAlgo::hasWildcards( identifier ) )
-			{
-				throw IECore::Exception( fmt::format( "Object name \"{}\" contains wildcards", identifier ) );
-			}
-			result.addPath( identifier );
-			return result;
-		}
-		else
-		{
-			// Set name
-
-			if( !StringAlgo::hasWildcards( identifier ) )
-			{
-				return m_scene->set( identifier )->readable();
-			}
-
-			result_type result;
-
-			IECore::ConstInternedStringVectorDataPtr setNamesData = m_scene->setNamesPlug()->getValue();
-			const std::vector<IECore::InternedString> &setNames = setNamesData->readable();
-			if( setNames.empty() )
-			{
-				return result;
-			}
-
-			ScenePlug::SetScope setScope( Context::current() );
-			for( const IECore::InternedString &setName : setNames )
-			{
-				if( !StringAlgo::match( setName.string(), identifier ) )
-				{
-					continue;
-				}
-
-				setScope.setSetName( &setName );
-				ConstPathMatcherDataPtr setData = m_scene->setPlug()->getValue();
-				result.addPaths( setData->readable() );
-			}
-			return result;
-		}
-	}
-
-	result_type operator()( const Nil &nil ) const
-	{
-		PathMatcher result;
-		return result;
-	}
-
-	result_type operator()( const BinaryOp &expr ) const
-	{
-		PathMatcher left = boost::apply_visitor( *this, expr.left );
-		PathMatcher right = boost::apply_visitor( *this, expr.right );
-
-		switch( expr.op )
-		{
-			case Union :
-			{
-				PathMatcher result = PathMatcher( left );
-				result.addPaths( right );
-				return result;
-			}
-			case Intersection :
-			{
-				return left.intersection( right );
-			}
-			case Difference :
-			{
-				PathMatcher result = PathMatcher( left );
-				result.removePaths( right );
-				return result;
-			}
-			case In :
-			{
-				PathMatcher result;
-				for( PathMatcher::Iterator it = right.begin(), eIt = right.end(); it != eIt; ++it )
-				{
-					result.addPaths( left.subTree( *it ), *it );
-					it.prune();
-				}
-				return result;
-			}
-			case Containing :
-			{
-				PathMatcher result;
-				for( PathMatcher::Iterator it = left.begin(), eIt = left.end(); it != eIt; ++it )
-				{
-					if( right.match( *it ) & ( PathMatcher::ExactMatch | PathMatcher::DescendantMatch ) )
-					{
-						result.addPath( *it );
-					}
-				}
-				return result;
-			}
-			default :
-				return PathMatcher();
-		}
-	}
-
-	const ScenePlug *m_scene;
-
-};
-
-// Hashing the AST
-// ---------------
-struct AstHasher
-{
-	using result_type = void;
-
-	AstHasher( const ScenePlug *scene, IECore::MurmurHash &h ) : m_scene( scene ), m_hash( h )
-	{
-	}
-
-	void operator()( const std::string &identifier )
-	{
-		if( identifier[0] == '/' )
-		{
-			// Object name
-			m_hash.append( identifier );
-		}
-		else
-		{
-			// Set name
-			if( !m_scene )
-			{
-				throw IECore::Exception( "SetAlgo: Invalid scene given. Can not hash set expression." );
-			}
-
-			if( !StringAlgo::hasWildcards( identifier ) )
-			{
-				m_hash.append( m_scene->setHash( identifier ) );
-				return;
-			}
-
-			IECore::ConstInternedStringVectorDataPtr setNamesData = m_scene->setNamesPlug()->getValue();
-			const std::vector<IECore::InternedString> &setNames = setNamesData->readable();
-			if( setNames.empty() )
-			{
-				return;
-			}
-
-			ScenePlug::SetScope setScope( Context::current() );
-			for( const IECore::InternedString &setName : setNames )
-			{
-				if( !StringAlgo::match( setName.string(), identifier ) )
-				{
-					continue;
-				}
-
-				setScope.setSetName( &setName );
-				m_hash.append( m_scene->setPlug()->hash() );
-			}
-		}
-	}
-
-	void operator()( const BinaryOp &expr )
-	{
-		m_hash.append( expr.op );
-		boost::apply_visitor( *this, expr.left );
-		boost::apply_visitor( *this, expr.right );
-	}
-
-	void operator()( const Nil &nil )
-	{
-	}
-
-	const ScenePlug* m_scene;
-	IECore::MurmurHash &m_hash;
-
-};
-
 template <typename Iterator>
 struct ExpressionGrammar : qi::grammar<Iterator, ExpressionAst(), ascii::space_type>
 {
@@ -482,6 +300,278 @@ void expressionToAST( const std::string &setExpression, ExpressionAst &ast)
 	}
 }
 
+// Compiled expressions
+// --------------------
+//
+// The AST is converted into a simpler tree of nodes which can be hashed
+// and evaluated independently. Compiled expressions are immutable, and
+// are cached by expression string so that nodes which evaluate the same
+// expression repeatedly only parse it once.
+
+struct CompiledExpression
+{
+
+	enum class Type
+	{
+		Empty,
+		ObjectName,
+		SetName,
+		SetNameWildcard,
+		Operation
+	};
+
+	Type type = Type::Empty;
+	// Used by all types except `Empty` and `Operation`.
+	std::string identifier;
+	// Used by `Operation`.
+	Op op = Union;
+	std::unique_ptr<const CompiledExpression> left;
+	std::unique_ptr<const CompiledExpression> right;
+
+};
+
+using ConstCompiledExpressionPtr = std::shared_ptr<const CompiledExpression>;
+
+struct AstCompiler
+{
+	using result_type = std::unique_ptr<CompiledExpression>;
+
+	result_type operator()( const std::string &identifier )
+	{
+		auto result = std::make_unique<CompiledExpression>();
+		if( identifier[0] == '/' )
+		{
+			result->type = CompiledExpression::Type::ObjectName;
+		}
+		else if( StringAlgo::hasWildcards( identifier ) )
+		{
+			result->type = CompiledExpression::Type::SetNameWildcard;
+		}
+		else
+		{
+			result->type = CompiledExpression::Type::SetName;
+		}
+		result->identifier = identifier;
+		return result;
+	}
+
+	result_type operator()( const Nil &nil )
+	{
+		return std::make_unique<CompiledExpression>();
+	}
+
+	result_type operator()( const BinaryOp &expr )
+	{
+		auto result = std::make_unique<CompiledExpression>();
+		result->type = CompiledExpression::Type::Operation;
+		result->op = expr.op;
+		result->left = boost::apply_visitor( *this, expr.left );
+		result->right = boost::apply_visitor( *this, expr.right );
+		return result;
+	}
+
+};
+
+ConstCompiledExpressionPtr compiledExpressionGetter( const std::string &setExpression, size_t &cost, const IECore::Canceller *canceller )
+{
+	cost = 1;
+	ExpressionAst ast;
+	expressionToAST( setExpression, ast );
+
+	AstCompiler compiler;
+	std::unique_ptr<CompiledExpression> result = boost::apply_visitor( compiler, ast );
+	return ConstCompiledExpressionPtr( std::move( result ) );
+}
+
+using CompiledExpressionCache = IECorePreview::LRUCache<std::string, ConstCompiledExpressionPtr>;
+CompiledExpressionCache g_compiledExpressionCache( compiledExpressionGetter, 10000 );
+
+ConstCompiledExpressionPtr compiledExpression( const std::string &setExpression )
+{
+	return g_compiledExpressionCache.get( setExpression );
+}
+
+// Hashing
+// -------
+
+// Appends the hash of the sets referenced by a leaf node.
+void appendLeafHash( const CompiledExpression &expression, const ScenePlug *scene, IECore::MurmurHash &h )
+{
+	switch( expression.type )
+	{
+		case CompiledExpression::Type::ObjectName :
+			h.append( expression.identifier );
+			break;
+		case CompiledExpression::Type::SetName :
+			if( !scene )
+			{
+				throw IECore::Exception( "SetAlgo: Invalid scene given. Can not hash set expression." );
+			}
+			h.append( scene->setHash( expression.identifier ) );
+			break;
+		case CompiledExpression::Type::SetNameWildcard : {
+			if( !scene )
+			{
+				throw IECore::Exception( "SetAlgo: Invalid scene given. Can not hash set expression." );
+			}
+			IECore::ConstInternedStringVectorDataPtr setNamesData = scene->setNamesPlug()->getValue();
+			const std::vector<IECore::InternedString> &setNames = setNamesData->readable();
+			if( setNames.empty() )
+			{
+				break;
+			}
+
+			ScenePlug::SetScope setScope( Context::current() );
+			for( const IECore::InternedString &setName : setNames )
+			{
+				if( !StringAlgo::match( setName.string(), expression.identifier ) )
+				{
+					continue;
+				}
+
+				setScope.setSetName( &setName );
+				h.append( scene->setPlug()->hash() );
+			}
+			break;
+		}
+		default :
+			break;
+	}
+}
+
+// Hash of the whole expression, as returned by `setExpressionHash()`.
+void appendExpressionHash( const CompiledExpression &expression, const ScenePlug *scene, IECore::MurmurHash &h )
+{
+	if( expression.type == CompiledExpression::Type::Operation )
+	{
+		h.append( expression.op );
+		appendExpressionHash( *expression.left, scene, h );
+		appendExpressionHash( *expression.right, scene, h );
+	}
+	else
+	{
+		appendLeafHash( expression, scene, h );
+	}
+}
+
+// Evaluation
+// ----------
+
+PathMatcher evaluate( const CompiledExpression &expression, const ScenePlug *scene );
+
+PathMatcher applyOp( Op op, const PathMatcher &left, const PathMatcher &right )
+{
+	switch( op )
+	{
+		case Union :
+		{
+			if( left.isEmpty() )
+			{
+				return right;
+			}
+			PathMatcher result = PathMatcher( left );
+			result.addPaths( right );
+			return result;
+		}
+		case Intersection :
+		{
+			return left.intersection( right );
+		}
+		case Difference :
+		{
+			PathMatcher result = PathMatcher( left );
+			result.removePaths( right );
+			return result;
+		}
+		case In :
+		{
+			PathMatcher result;
+			for( PathMatcher::Iterator it = right.begin(), eIt = right.end(); it != eIt; ++it )
+			{
+				result.addPaths( left.subTree( *it ), *it );
+				it.prune();
+			}
+			return result;
+		}
+		case Containing :
+		{
+			PathMatcher result;
+			for( PathMatcher::Iterator it = left.begin(), eIt = left.end(); it != eIt; ++it )
+			{
+				if( right.match( *it ) & ( PathMatcher::ExactMatch | PathMatcher::DescendantMatch ) )
+				{
+					result.addPath( *it );
+				}
+			}
+			return result;
+		}
+		default :
+			return PathMatcher();
+	}
+}
+
+PathMatcher evaluateWildcard( const CompiledExpression &expression, const ScenePlug *scene )
+{
+	PathMatcher result;
+
+	IECore::ConstInternedStringVectorDataPtr setNamesData = scene->setNamesPlug()->getValue();
+	const std::vector<IECore::InternedString> &setNames = setNamesData->readable();
+	if( setNames.empty() )
+	{
+		return result;
+	}
+
+	ScenePlug::SetScope setScope( Context::current() );
+	for( const IECore::InternedString &setName : setNames )
+	{
+		if( !StringAlgo::match( setName.string(), expression.identifier ) )
+		{
+			continue;
+		}
+
+		setScope.setSetName( &setName );
+		ConstPathMatcherDataPtr setData = scene->setPlug()->getValue();
+		result.addPaths( setData->readable() );
+	}
+	return result;
+}
+
+PathMatcher evaluateOperation( const CompiledExpression &expression, const ScenePlug *scene )
+{
+	// We evaluate serially, because spawning tasks would require every
+	// caller to use a task-based cache policy (see ComputeNode.h), and
+	// `evaluateSetExpression()` is called from many computes which don't.
+	const PathMatcher left = evaluate( *expression.left, scene );
+	const PathMatcher right = evaluate( *expression.right, scene );
+
+	IECore::Canceller::check( Context::current()->canceller() );
+	return applyOp( expression.op, left, right );
+}
+
+PathMatcher evaluate( const CompiledExpression &expression, const ScenePlug *scene )
+{
+	switch( expression.type )
+	{
+		case CompiledExpression::Type::Empty :
+			return PathMatcher();
+		case CompiledExpression::Type::ObjectName : {
+			if( StringAlgo::hasWildcards( expression.identifier ) )
+			{
+				throw IECore::Exception( fmt::format( "Object name \"{}\" contains wildcards", expression.identifier ) );
+			}
+			PathMatcher result;
+			result.addPath( expression.identifier );
+			return result;
+		}
+		case CompiledExpression::Type::SetName :
+			return scene->set( expression.identifier )->readable();
+		case CompiledExpression::Type::SetNameWildcard :
+			return evaluateWildcard( expression, scene );
+		default :
+			return evaluateOperation( expression, scene );
+	}
+}
+
 } // namespace
 
 namespace GafferScene
@@ -492,18 +582,14 @@ namespace SetAlgo
 
 PathMatcher evaluateSetExpression( const std::string &setExpression, const ScenePlug *scene )
 {
-	ExpressionAst ast;
-	expressionToAST( setExpression, ast );
-	return boost::apply_visitor( AstEvaluator( scene ), ast );
+	ConstCompiledExpressionPtr expression = compiledExpression( setExpression );
+	return evaluate( *expression, scene );
 }
 
 void setExpressionHash( const std::string &setExpression, const ScenePlug* scene, IECore::MurmurHash &h )
 {
-	ExpressionAst ast;
-	expressionToAST( setExpression, ast );
-
-	AstHasher hasher = AstHasher( scene, h );
-	boost::apply_visitor( hasher, ast );
+	ConstCompiledExpressionPtr expression = compiledExpression( setExpression );
+	appendExpressionHash( *expression, scene, h );
 }
 
 IECore::MurmurHash setExpressionHash( const std::string &setExpression, const ScenePlug* scene)
@@ -169,3 +169,16 @@ unsigned SetFilter::computeMatch( const ScenePlug *scene, const Gaffer::Context
 
 	return set->readable().match( path );
 }
+
+IECore::ConstPathMatcherDataPtr SetFilter::pathMatcher( const ScenePlug *scene, const Gaffer::Context *context ) const
+{
+	if( !scene )
+	{
+		return new PathMatcherData;
+	}
+
+	Gaffer::Context::EditableScope expressionResultScope( context );
+	expressionResultScope.remove( ScenePlug::scenePathContextName );
+
+	return expressionResultPlug()->getValue();
+}
@@ -69,6 +69,16 @@ int match( const FilterPlug &plug, const ScenePlug &scene )
 	return plug.match( &scene );
 }
 
+IECore::PathMatcherDataPtr pathMatcher( const FilterPlug &plug, const ScenePlug &scene )
+{
+	IECore::ConstPathMatcherDataPtr result;
+	{
+		IECorePython::ScopedGILRelease r;
+		result = plug.pathMatcher( &scene );
+	}
+	return result ? result->copy() : nullptr;
+}
+
 
 } // namespace
 
@@ -103,6 +113,7 @@ void GafferSceneModule::bindFilter()
 			)
 		)
 		.def( "match", &match )
+		.def( "pathMatcher", &pathMatcher )
 	;
 
 	GafferBindings::DependencyNodeClass<PathFilter>();
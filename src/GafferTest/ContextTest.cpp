@@ -301,6 +301,66 @@ void GafferTest::testContextHashPerformance( int numEntries, int entrySize, bool
 
 }
 
+namespace
+{
+
+// Mimics the pattern of context modification used by scene traversal, where
+// each location is visited in a context derived from its parent's, with
+// `scene:path` changed.
+void traverse( const ThreadState &threadState, const vector<InternedString> &parentPath, int depth, int branchingFactor, bool setChildPath )
+{
+	static const InternedString g_scenePath( "scene:path" );
+	static const vector<InternedString> g_childNames = [] {
+		vector<InternedString> result;
+		for( int i = 0; i < 100; ++i )
+		{
+			result.push_back( InternedString( i ) );
+		}
+		return result;
+	}();
+
+	if( !depth )
+	{
+		return;
+	}
+
+	tbb::parallel_for( 0, branchingFactor, [&]( int i ) {
+
+		vector<InternedString> path = parentPath;
+		path.push_back( g_childNames[i % g_childNames.size()] );
+
+		Context::EditableScope scope( threadState );
+		if( setChildPath )
+		{
+			scope.setChildPath( g_scenePath, &path );
+		}
+		else
+		{
+			scope.set( g_scenePath, &path );
+		}
+		// This call is relied on by ValuePlug's HashCacheKey, and is
+		// made at every location in a traversal.
+		scope.context()->hash();
+
+		traverse( ThreadState::current(), path, depth - 1, branchingFactor, setChildPath );
+
+	} );
+}
+
+} // namespace
+
+void GafferTest::testContextHashDeepTraversalPerformance( int numEntries, int depth, int branchingFactor )
+{
+	ContextPtr baseContext = new Context();
+	for( int i = 0; i < numEntries; i++ )
+	{
+		baseContext->set( InternedString( i ), std::string( 10, 'x') );
+	}
+
+	Context::Scope baseScope( baseContext.get() );
+	traverse( ThreadState::current(), vector<InternedString>(), depth, branchingFactor, /* setChildPath = */ false );
+}
+
 void GafferTest::testContextCopyPerformance( int numEntries, int entrySize )
 {
 	// We usually deal with contexts that already have some stuff in them, so adding some entries
@@ -403,3 +463,90 @@ void GafferTest::testContextHashValidation()
 
 	GAFFERTEST_ASSERTEQUAL( error, "Context variable \"value\" has an invalid hash" );
 }
+
+void GafferTest::testEditableScopeSetChildPath()
+{
+	const InternedString name( "scene:path" );
+	ContextPtr context = new Context();
+	context->set( "a", 1 );
+
+	// Every path must hash exactly as if set with `set()`, when
+	// visited via scopes derived from the parent's scope.
+
+	auto assertHashesEqual = [&] ( const Context::EditableScope &scope, const vector<InternedString> &path ) {
+
+		Context::EditableScope referenceScope( context.get() );
+		referenceScope.set( name, &path );
+		GAFFERTEST_ASSERT( scope.context()->variableHash( name ) == referenceScope.context()->variableHash( name ) );
+		GAFFERTEST_ASSERT( scope.context()->hash() == referenceScope.context()->hash() );
+		GAFFERTEST_ASSERT( scope.context()->get<vector<InternedString>>( name ) == path );
+
+	};
+
+	// Variable not set yet, so equivalent to `set()`.
+
+	const vector<InternedString> rootPath;
+	Context::EditableScope rootScope( context.get() );
+	rootScope.setChildPath( name, &rootPath );
+	assertHashesEqual( rootScope, rootPath );
+
+	const vector<InternedString> aPath = { "a" };
+	Context::EditableScope aScope( rootScope.context() );
+	aScope.setChildPath( name, &aPath );
+	assertHashesEqual( aScope, aPath );
+
+	const vector<InternedString> bPath = { "b" };
+	Context::EditableScope bScope( rootScope.context() );
+	bScope.setChildPath( name, &bPath );
+	assertHashesEqual( bScope, bPath );
+
+	const vector<InternedString> acPath = { "a", "c" };
+	Context::EditableScope acScope( aScope.context() );
+	acScope.setChildPath( name, &acPath );
+	assertHashesEqual( acScope, acPath );
+
+	const vector<InternedString> bcPath = { "b", "c" };
+	Context::EditableScope bcScope( bScope.context() );
+	bcScope.setChildPath( name, &bcPath );
+	assertHashesEqual( bcScope, bcPath );
+
+	// Paths which differ only in their parent must not
+	// share a hash.
+
+	GAFFERTEST_ASSERT( acScope.context()->hash() != bcScope.context()->hash() );
+
+	// A path which isn't a child of the current value
+	// is equivalent to `set()`.
+
+	const vector<InternedString> xyzPath = { "x", "y", "z" };
+	Context::EditableScope xyzScope( aScope.context() );
+	xyzScope.setChildPath( name, &xyzPath );
+	assertHashesEqual( xyzScope, xyzPath );
+
+	// A regular context copy must agree too.
+
+	ContextPtr copy = new Context( *acScope.context() );
+	GAFFERTEST_ASSERT( copy->hash() == acScope.context()->hash() );
+
+	// And variables excluded from the hash must remain so.
+
+	const InternedString uiName( "ui:path" );
+	Context::EditableScope uiRootScope( context.get() );
+	uiRootScope.set( uiName, &aPath );
+	Context::EditableScope uiChildScope( uiRootScope.context() );
+	uiChildScope.setChildPath( uiName, &acPath );
+	GAFFERTEST_ASSERT( uiChildScope.context()->variableHash( uiName ) == IECore::MurmurHash( 0, 0 ) );
+	GAFFERTEST_ASSERT( uiChildScope.context()->hash() == context->hash() );
+}
+
+void GafferTest::testEditableScopeSetChildPathPerformance( int numEntries, int depth, int branchingFactor )
+{
+	ContextPtr baseContext = new Context();
+	for( int i = 0; i < numEntries; i++ )
+	{
+		baseContext->set( InternedString( i ), std::string( 10, 'x') );
+	}
+
+	Context::Scope baseScope( baseContext.get() );
+	traverse( ThreadState::current(), vector<InternedString>(), depth, branchingFactor, /* setChildPath = */ true );
+}
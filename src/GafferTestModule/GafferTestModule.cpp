@@ -105,9 +105,12 @@ BOOST_PYTHON_MODULE( _GafferTest )
 	def( "testEditableScope", &testEditableScope );
 	def( "countContextHash32Collisions", &countContextHash32CollisionsWrapper );
 	def( "testContextHashPerformance", &testContextHashPerformance );
+	def( "testContextHashDeepTraversalPerformance", &testContextHashDeepTraversalPerformance );
 	def( "testContextCopyPerformance", &testContextCopyPerformance );
 	def( "testCopyEditableScope", &testCopyEditableScope );
 	def( "testContextHashValidation", &testContextHashValidation );
+	def( "testEditableScopeSetChildPath", &testEditableScopeSetChildPath );
+	def( "testEditableScopeSetChildPathPerformance", &testEditableScopeSetChildPathPerformance );
 	def( "testComputeNodeThreading", &testComputeNodeThreading );
 	def( "testDownstreamIterator", &testDownstreamIterator );
 	def( "testRandomPerf", &testRandomPerf );
@@ -45,6 +45,7 @@
 #include "IECore/Canceller.h"
 
 #include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
 
 using namespace IECorePreview;
 using namespace boost::python;
@@ -75,6 +76,10 @@ struct DispatchTest
 		{
 			F<LRUCachePolicy::Parallel> f( std::forward<Args>( args )... ); f();
 		}
+		else if( policy == "parallelLockFreeRead" )
+		{
+			F<LRUCachePolicy::ParallelLockFreeRead> f( std::forward<Args>( args )... ); f();
+		}
 		else if( policy == "taskParallel" )
 		{
 			F<LRUCachePolicy::TaskParallel> f( std::forward<Args>( args )... ); f();
@@ -244,6 +249,61 @@ void testLRUCacheContentionForOneItem( const std::string &policy, bool withCance
 	DispatchTest<TestLRUCacheContentionForOneItem>()( policy, withCanceller );
 }
 
+template<template<typename> class Policy>
+struct TestLRUCacheContentionForGetIfCached
+{
+
+	TestLRUCacheContentionForGetIfCached( int numThreads )
+		:	m_numThreads( numThreads ? numThreads : tbb::this_task_arena::max_concurrency() )
+	{
+	}
+
+	void operator()()
+	{
+		using Cache = LRUCache<int, int, Policy>;
+		Cache cache(
+			[]( int key, size_t &cost, const IECore::Canceller *canceller ) { cost = 1; return key; },
+			1000
+		);
+
+		// A small number of items shared by all threads, as when
+		// hashing the same upstream plugs from many locations.
+		const int numValues = 16;
+		for( int i = 0; i < numValues; ++i )
+		{
+			cache.get( i );
+		}
+
+		// Work is proportional to the number of threads, so the
+		// run time remains constant if lookups scale linearly.
+		tbb::task_arena arena( m_numThreads );
+		arena.execute(
+			[&] {
+				tbb::parallel_for(
+					tbb::blocked_range<size_t>( 0, 2000000 * m_numThreads ),
+					[&]( const tbb::blocked_range<size_t> &r ) {
+						for( size_t i = r.begin(); i < r.end(); ++i )
+						{
+							const int k = i % numValues;
+							GAFFERTEST_ASSERTEQUAL( *cache.getIfCached( k ), k );
+						}
+					}
+				);
+			}
+		);
+	}
+
+	private :
+
+		const int m_numThreads;
+
+};
+
+void testLRUCacheContentionForGetIfCached( const std::string &policy, int numThreads )
+{
+	DispatchTest<TestLRUCacheContentionForGetIfCached>()( policy, numThreads );
+}
+
 template<template<typename> class Policy>
 struct TestLRUCacheRecursion
 {
@@ -799,6 +859,57 @@ void testLRUCacheSetIfUncached( const std::string &policy )
 	DispatchTest<TestLRUCacheSetIfUncached>()( policy );
 }
 
+template<template<typename> class Policy>
+struct TestLRUCacheCostAwareEviction
+{
+
+	void operator()()
+	{
+		using Cache = IECorePreview::LRUCache<int, int, Policy>;
+
+		Cache cache(
+			[]( int key, size_t &cost, const IECore::Canceller *canceller ) {
+				cost = 1;
+				return key;
+			},
+			10
+		);
+
+		// Returns the number of cheap items that can be added
+		// before an expensive item is evicted.
+		auto numItemsToEvictExpensiveItem = [&] () {
+			cache.clear();
+			cache.set( -1, -1, 1, std::chrono::milliseconds( 50 ) );
+			for( int i = 0; i < 1000; ++i )
+			{
+				cache.set( i, i, 1 );
+				if( !cache.cached( -1 ) )
+				{
+					return i;
+				}
+			}
+			return 1000;
+		};
+
+		GAFFERTEST_ASSERT( cache.getEvictionPolicy() == Cache::EvictionPolicy::LRU );
+		const int numLRU = numItemsToEvictExpensiveItem();
+		GAFFERTEST_ASSERT( numLRU < 50 );
+
+		cache.setEvictionPolicy( Cache::EvictionPolicy::CostAware );
+		GAFFERTEST_ASSERT( cache.getEvictionPolicy() == Cache::EvictionPolicy::CostAware );
+		const int numCostAware = numItemsToEvictExpensiveItem();
+		GAFFERTEST_ASSERT( numCostAware > 20 );
+		GAFFERTEST_ASSERT( numCostAware > numLRU );
+	}
+
+};
+
+void testLRUCacheCostAwareEviction( const std::string &policy )
+{
+	GAFFERTEST_ASSERT( policy != "serial" ); // Serial policy always uses exact LRU order.
+	DispatchTest<TestLRUCacheCostAwareEviction>()( policy );
+}
+
 } // namespace
 
 void GafferTestModule::bindLRUCacheTest()
@@ -806,6 +917,7 @@ void GafferTestModule::bindLRUCacheTest()
 	def( "testLRUCache", &testLRUCache, ( arg( "numIterations" ), arg( "numValues" ), arg( "maxCost" ), arg( "clearFrequency" ) = 0 ) );
 	def( "testLRUCacheRemovalCallback", &testLRUCacheRemovalCallback );
 	def( "testLRUCacheContentionForOneItem", &testLRUCacheContentionForOneItem, arg( "withCanceller" ) = false );
+	def( "testLRUCacheContentionForGetIfCached", &testLRUCacheContentionForGetIfCached, arg( "numThreads" ) = 0 );
 	def( "testLRUCacheRecursion", &testLRUCacheRecursion, ( arg( "numIterations" ), arg( "numValues" ), arg( "maxCost" ) ) );
 	def( "testLRUCacheClearFromGet", &testLRUCacheClearFromGet );
 	def( "testLRUCacheExceptions", &testLRUCacheExceptions );
@@ -814,4 +926,5 @@ void GafferTestModule::bindLRUCacheTest()
 	def( "testLRUCacheUncacheableItem", &testLRUCacheUncacheableItem );
 	def( "testLRUCacheGetIfCached", &testLRUCacheGetIfCached );
 	def( "testLRUCacheSetIfUncached", &testLRUCacheSetIfUncached );
+	def( "testLRUCacheCostAwareEviction", &testLRUCacheCostAwareEviction );
 }
@@ -84,12 +84,14 @@ class TestProcess : public Process
 	public :
 
 		TestProcess( const Plug *plug, int result, const Dependencies::ConstPtr &dependencies )
-			:	Process( g_staticType, plug, plug ), m_result( result ), m_dependencies( dependencies )
+			:	Process( staticType, plug, plug ), m_result( result ), m_dependencies( dependencies )
 		{
 		}
 
 		using ResultType = int;
 
+		static const IECore::InternedString staticType;
+
 		ResultType run() const
 		{
 			const ThreadState &threadState = ThreadState::current();
@@ -148,13 +150,11 @@ class TestProcess : public Process
 		const int m_result;
 		const Dependencies::ConstPtr m_dependencies;
 
-		static const IECore::InternedString g_staticType;
-
 };
 
 TestProcess::CacheType TestProcess::g_cache( TestProcess::CacheType::GetterFunction(), 100000 );
 // Spoof type so that we can use PerformanceMonitor to check we get the processes we expect in ProcessTest.py.
-const IECore::InternedString TestProcess::g_staticType( "computeNode:compute" );
+const IECore::InternedString TestProcess::staticType( "computeNode:compute" );
 
 Dependencies::ConstPtr dependenciesFromDict( dict dependenciesDict, std::unordered_map<const PyObject *, Dependencies::ConstPtr> &converted )
 {
@@ -34,13 +34,53 @@
 #
 ##########################################################################
 
+import os
 import psutil
 
 import Gaffer
 
-# Set cache memory limit to 8 gigs, capped at 3/4 of the total
-# physical memory.
+# Set cache memory limit to 8 gigs, capped at 3/4 of the memory
+# available to the process. This accounts for cgroup limits where
+# possible, falling back to the total physical memory.
 
 Gaffer.ValuePlug.setCacheMemoryLimit(
-	min( 1024**3 * 8, psutil.virtual_memory().total * 3 // 4 )
+	min( 1024**3 * 8, ( Gaffer.MemoryPressure.memoryLimit() or psutil.virtual_memory().total ) * 3 // 4 )
 )
+
+# Enable adaptive cache limits if a target fraction of the available
+# memory has been specified via the environment.
+
+if os.environ.get( "GAFFER_MEMORY_PRESSURE_TARGET" ) :
+	Gaffer.MemoryPressure.setTargetFraction( float( os.environ["GAFFER_MEMORY_PRESSURE_TARGET"] ) )
+	Gaffer.MemoryPressure.setEnabled( True )
+
+# Allow the eviction policy to be chosen via the environment,
+# to facilitate comparisons in production.
+
+if os.environ.get( "GAFFER_CACHE_EVICTION_POLICY" ) :
+	Gaffer.ValuePlug.setCacheEvictionPolicy(
+		getattr( Gaffer.ValuePlug.CacheEvictionPolicy, os.environ["GAFFER_CACHE_EVICTION_POLICY"] )
+	)
+
+# Enable the persistent disk cache if a directory has been
+# specified via the environment. The size limit is specified
+# in megabytes, and defaults to 16 gigs.
+
+if os.environ.get( "GAFFER_CACHE_DIRECTORY" ) :
+	Gaffer.ValuePlug.setCacheDirectory(
+		os.environ["GAFFER_CACHE_DIRECTORY"],
+		int( os.environ["GAFFER_CACHE_DIRECTORY_SIZE_LIMIT"] ) * 1024**2 if os.environ.get( "GAFFER_CACHE_DIRECTORY_SIZE_LIMIT" )
+		else 1024**3 * 16
+	)
+
+# Enable the shared memory cache if a segment name has been
+# specified via the environment. The size is specified in
+# megabytes, and defaults to 4 gigs, capped at 1/4 of the total
+# physical memory.
+
+if os.environ.get( "GAFFER_SHARED_CACHE_NAME" ) :
+	Gaffer.ValuePlug.setSharedCache(
+		os.environ["GAFFER_SHARED_CACHE_NAME"],
+		int( os.environ["GAFFER_SHARED_CACHE_MEMORY_LIMIT"] ) * 1024**2 if os.environ.get( "GAFFER_SHARED_CACHE_MEMORY_LIMIT" )
+		else min( 1024**3 * 4, psutil.virtual_memory().total // 4 )
+	)
@@ -47,6 +47,9 @@ import OpenImageIO
 # to enable the default behaviour, and if Tiff performance is really important to you,
 # you may want to override this completely back to the default behaviour by setting both
 # to zero.
+#
+# Note that while writing EXRs, the ImageWriter temporarily sets "exr_threads" to match
+# the number of threads Gaffer is using, so that compression doesn't become a bottleneck.
 
 OpenImageIO.attribute( "threads", 1 )
 OpenImageIO.attribute( "exr_threads", -1 )